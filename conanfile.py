@@ -74,9 +74,6 @@ class EndstoneRecipe(ConanFile):
         self.requires("spdlog/1.14.1")
         self.requires("tomlplusplus/3.3.0")
 
-        if self.settings.os == "Linux":
-            self.requires("libelf/0.8.13")
-
         if self._with_devtools:
             self.requires("glew/2.2.0")
             self.requires("glfw/3.4")
@@ -1,4 +1,13 @@
-from endstone._internal.endstone_python import ColorFormat, GameMode, Logger, OfflinePlayer, Player, Server, Skin
+from endstone._internal.endstone_python import (
+    ColorFormat,
+    GameMode,
+    Logger,
+    OfflinePlayer,
+    Player,
+    Server,
+    Skin,
+    ViewDistanceHintSettings,
+)
 from endstone._internal.version import __version__
 
 __minecraft_version__ = "1.21.50"
@@ -13,4 +22,5 @@ __all__ = [
     "Player",
     "Server",
     "Skin",
+    "ViewDistanceHintSettings",
 ]
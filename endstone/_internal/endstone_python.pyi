@@ -1,10 +1,11 @@
 from __future__ import annotations
+import concurrent.futures
 import datetime
 import numpy
 import os
 import typing
 import uuid
-__all__ = ['ActionForm', 'Actor', 'ActorDamageEvent', 'ActorDeathEvent', 'ActorEvent', 'ActorExplodeEvent', 'ActorKnockbackEvent', 'ActorRemoveEvent', 'ActorSpawnEvent', 'ActorTeleportEvent', 'BanEntry', 'BarColor', 'BarFlag', 'BarStyle', 'Block', 'BlockBreakEvent', 'BlockData', 'BlockEvent', 'BlockFace', 'BlockPlaceEvent', 'BlockState', 'BossBar', 'BroadcastMessageEvent', 'Cancellable', 'Chunk', 'ColorFormat', 'Command', 'CommandExecutor', 'CommandSender', 'CommandSenderWrapper', 'ConsoleCommandSender', 'Criteria', 'DamageSource', 'Dimension', 'DisplaySlot', 'Dropdown', 'Event', 'EventPriority', 'GameMode', 'Inventory', 'IpBanEntry', 'IpBanList', 'ItemStack', 'Label', 'Language', 'Level', 'Location', 'Logger', 'MessageForm', 'Mob', 'MobEvent', 'ModalForm', 'Objective', 'ObjectiveSortOrder', 'OfflinePlayer', 'Packet', 'PacketType', 'Permissible', 'Permission', 'PermissionAttachment', 'PermissionAttachmentInfo', 'PermissionDefault', 'Player', 'PlayerBanEntry', 'PlayerBanList', 'PlayerChatEvent', 'PlayerCommandEvent', 'PlayerDeathEvent', 'PlayerEmoteEvent', 'PlayerEvent', 'PlayerGameModeChangeEvent', 'PlayerInteractActorEvent', 'PlayerInteractEvent', 'PlayerInventory', 'PlayerJoinEvent', 'PlayerKickEvent', 'PlayerLoginEvent', 'PlayerQuitEvent', 'PlayerRespawnEvent', 'PlayerTeleportEvent', 'Plugin', 'PluginCommand', 'PluginDescription', 'PluginDisableEvent', 'PluginEnableEvent', 'PluginLoadOrder', 'PluginLoader', 'PluginManager', 'Position', 'ProxiedCommandSender', 'RenderType', 'Scheduler', 'Score', 'Scoreboard', 'ScriptMessageEvent', 'Server', 'ServerCommandEvent', 'ServerEvent', 'ServerListPingEvent', 'ServerLoadEvent', 'Skin', 'Slider', 'SocketAddress', 'SpawnParticleEffectPacket', 'StepSlider', 'Task', 'TextInput', 'ThunderChangeEvent', 'Toggle', 'Translatable', 'Vector', 'WeatherChangeEvent', 'WeatherEvent']
+__all__ = ['ActionForm', 'Actor', 'ActorDamageEvent', 'ActorDeathEvent', 'ActorEvent', 'ActorExplodeEvent', 'ActorKnockbackEvent', 'ActorRemoveEvent', 'ActorSnapshot', 'ActorSpawnEvent', 'ActorTeleportEvent', 'AsyncPlayerChatEvent', 'AsyncPlayerPreLoginEvent', 'BanEntry', 'BarColor', 'BarFlag', 'BarStyle', 'Block', 'BlockBreakEvent', 'BlockData', 'BlockEvent', 'BlockFace', 'BlockPlaceEvent', 'BlockState', 'BossBar', 'BroadcastMessageEvent', 'Cancellable', 'Chunk', 'ChunkSnapshot', 'ColorFormat', 'Command', 'CommandExecutor', 'CommandSender', 'CommandSenderWrapper', 'ConsoleCommandSender', 'Criteria', 'DamageSource', 'Dimension', 'DisplaySlot', 'Dropdown', 'Event', 'EventPriority', 'FormTemplate', 'GameMode', 'Inventory', 'IpBanEntry', 'IpBanList', 'ItemStack', 'Label', 'Language', 'Level', 'Location', 'Logger', 'MessageForm', 'Mob', 'MobEvent', 'ModalForm', 'Objective', 'ObjectiveSortOrder', 'OfflinePlayer', 'Packet', 'PacketType', 'Permissible', 'Permission', 'PermissionAttachment', 'PermissionAttachmentInfo', 'PermissionDefault', 'Player', 'PlayerBanEntry', 'PlayerBanList', 'PlayerChatEvent', 'PlayerCommandEvent', 'PlayerDeathEvent', 'PlayerEmoteEvent', 'PlayerEvent', 'PlayerGameModeChangeEvent', 'PlayerInteractActorEvent', 'PlayerInteractEvent', 'PlayerInventory', 'PlayerJoinEvent', 'PlayerKickEvent', 'PlayerLoginEvent', 'PlayerMoveEvent', 'PlayerMoveThreshold', 'PlayerQuitEvent', 'PlayerRespawnEvent', 'PlayerTeleportEvent', 'PlayerViewDistanceChangeEvent', 'Plugin', 'PluginCommand', 'PluginDescription', 'PluginDisableEvent', 'PluginEnableEvent', 'PluginLoadOrder', 'PluginLoader', 'PluginManager', 'Position', 'ProxiedCommandSender', 'RenderType', 'Scheduler', 'Score', 'Scoreboard', 'ScriptMessageEvent', 'Server', 'ServerCommandEvent', 'ServerEvent', 'ServerListPingEvent', 'ServerLoadEvent', 'Skin', 'Slider', 'SocketAddress', 'SpawnParticleEffectPacket', 'StepSlider', 'Task', 'TextInput', 'ThunderChangeEvent', 'Toggle', 'Translatable', 'Vector', 'ViewDistanceHintSettings', 'VirtualScoreboard', 'WeatherChangeEvent', 'WeatherEvent']
 class ActionForm:
     """
     Represents a form with buttons that let the player take action.
@@ -316,6 +317,64 @@ class ActorRemoveEvent(ActorEvent):
     @staticmethod
     def _pybind11_conduit_v1_(*args, **kwargs):
         ...
+class ActorSnapshot:
+    """
+    Represents a structure-of-arrays snapshot of the actors in a level. Arrays are read-only copies that keep their values when the snapshot is filled again.
+    """
+    ALL_FIELDS: typing.ClassVar[int] = 63
+    DEAD: typing.ClassVar[int] = 8
+    DIMENSION_IDS: typing.ClassVar[int] = 16
+    FLAGS: typing.ClassVar[int] = 32
+    IN_LAVA: typing.ClassVar[int] = 4
+    IN_WATER: typing.ClassVar[int] = 2
+    IS_PLAYER: typing.ClassVar[int] = 16
+    ON_GROUND: typing.ClassVar[int] = 1
+    POSITIONS: typing.ClassVar[int] = 2
+    ROTATIONS: typing.ClassVar[int] = 8
+    RUNTIME_IDS: typing.ClassVar[int] = 1
+    VELOCITIES: typing.ClassVar[int] = 4
+    @staticmethod
+    def _pybind11_conduit_v1_(*args, **kwargs):
+        ...
+    def __init__(self) -> None:
+        ...
+    def __len__(self) -> int:
+        ...
+    @property
+    def dimension_ids(self) -> numpy.ndarray[numpy.int32]:
+        """
+        Gets a copy of the runtime ids of the dimensions the actors reside in, with shape (n,).
+        """
+    @property
+    def fields(self) -> int:
+        """
+        Gets the fields captured by this snapshot.
+        """
+    @property
+    def flags(self) -> numpy.ndarray[numpy.uint8]:
+        """
+        Gets a copy of the state flags of the actors, with shape (n,).
+        """
+    @property
+    def positions(self) -> numpy.ndarray[numpy.float32]:
+        """
+        Gets a copy of the feet positions of the actors, with shape (n, 3).
+        """
+    @property
+    def rotations(self) -> numpy.ndarray[numpy.float32]:
+        """
+        Gets a copy of the rotations (pitch, yaw) of the actors in degrees, with shape (n, 2).
+        """
+    @property
+    def runtime_ids(self) -> numpy.ndarray[numpy.uint64]:
+        """
+        Gets a copy of the runtime ids of the actors, with shape (n,).
+        """
+    @property
+    def velocities(self) -> numpy.ndarray[numpy.float32]:
+        """
+        Gets a copy of the velocities of the actors, with shape (n, 3).
+        """
 class ActorSpawnEvent(ActorEvent, Cancellable):
     """
     Called when an Actor is spawned into a world.
@@ -346,6 +405,74 @@ class ActorTeleportEvent(ActorEvent, Cancellable):
     @to_location.setter
     def to_location(self, arg1: Location) -> None:
         ...
+class AsyncPlayerChatEvent(Event, Cancellable):
+    """
+    Called on a worker thread when a player sends a chat message.
+    """
+    @staticmethod
+    def _pybind11_conduit_v1_(*args, **kwargs):
+        ...
+    @property
+    def message(self) -> str:
+        """
+        Gets or sets the message that the player will send.
+        """
+    @message.setter
+    def message(self, arg1: str) -> None:
+        ...
+    @property
+    def player_name(self) -> str:
+        """
+        Gets the name of the player who sent the message.
+        """
+    @property
+    def player_unique_id(self) -> uuid.UUID:
+        """
+        Gets the unique ID of the player who sent the message.
+        """
+    @property
+    def recipients(self) -> list[uuid.UUID]:
+        """
+        Gets or sets the unique IDs of the players who will receive the message.
+        """
+    @recipients.setter
+    def recipients(self, arg1: list[uuid.UUID]) -> None:
+        ...
+class AsyncPlayerPreLoginEvent(Event, Cancellable):
+    """
+    Called on a worker thread when a player attempts to log in, before PlayerLoginEvent.
+    """
+    @staticmethod
+    def _pybind11_conduit_v1_(*args, **kwargs):
+        ...
+    @property
+    def address(self) -> SocketAddress:
+        """
+        Gets the socket address of the player.
+        """
+    @property
+    def kick_message(self) -> str:
+        """
+        Gets or sets kick message to display if event is cancelled
+        """
+    @kick_message.setter
+    def kick_message(self, arg1: str) -> None:
+        ...
+    @property
+    def name(self) -> str:
+        """
+        Gets the player's name.
+        """
+    @property
+    def unique_id(self) -> uuid.UUID:
+        """
+        Gets the player's unique ID.
+        """
+    @property
+    def xuid(self) -> str:
+        """
+        Gets the player's XUID.
+        """
 class BanEntry:
     """
     A single entry from a ban list.
@@ -860,6 +987,10 @@ class Chunk:
     @staticmethod
     def _pybind11_conduit_v1_(*args, **kwargs):
         ...
+    def get_snapshot(self) -> ChunkSnapshot:
+        """
+        Captures an immutable snapshot of the blocks in this chunk. Must be called from the server thread.
+        """
     @property
     def dimension(self) -> Dimension:
         """
@@ -880,6 +1011,56 @@ class Chunk:
         """
         Gets the Z-coordinate of this chunk
         """
+class ChunkSnapshot:
+    """
+    Represents an immutable copy of the blocks in a chunk, which can be read from any thread. Coordinates are relative to the chunk.
+    """
+    @staticmethod
+    def _pybind11_conduit_v1_(*args, **kwargs):
+        ...
+    def get_block_data(self, x: int, y: int, z: int) -> BlockData:
+        """
+        Gets the block data of the block at the given coordinates
+        """
+    def get_highest_block_y_at(self, x: int, z: int) -> int:
+        """
+        Gets the y-coordinate of the highest non-air block at the given coordinates
+        """
+    @property
+    def blocks(self) -> numpy.ndarray[numpy.uint16]:
+        """
+        Gets the palette indices of all blocks, with shape (height, 16, 16) indexed by [y - min_height, z, x].
+        """
+    @property
+    def heightmap(self) -> numpy.ndarray[numpy.int16]:
+        """
+        Gets the highest non-air block of each column, with shape (16, 16) indexed by [z, x].
+        """
+    @property
+    def max_height(self) -> int:
+        """
+        Gets the maximum height (exclusive) covered by this snapshot
+        """
+    @property
+    def min_height(self) -> int:
+        """
+        Gets the minimum height (inclusive) covered by this snapshot
+        """
+    @property
+    def palette(self) -> list[BlockData]:
+        """
+        Gets the distinct block data found in the chunk
+        """
+    @property
+    def x(self) -> int:
+        """
+        Gets the X-coordinate of the chunk this snapshot was taken from
+        """
+    @property
+    def z(self) -> int:
+        """
+        Gets the Z-coordinate of the chunk this snapshot was taken from
+        """
 class ColorFormat:
     """
     All supported color and format codes.
@@ -1169,6 +1350,10 @@ class Dimension:
     @staticmethod
     def _pybind11_conduit_v1_(*args, **kwargs):
         ...
+    def for_each_loaded_chunk(self, visitor: typing.Callable[[Chunk], None]) -> None:
+        """
+        Visits all loaded Chunks without allocating a list. The chunk is only valid during the call.
+        """
     @typing.overload
     def get_block_at(self, location: Location) -> Block:
         """
@@ -1185,6 +1370,11 @@ class Dimension:
         Gets the level to which this dimension belongs
         """
     @property
+    def loaded_chunk_count(self) -> int:
+        """
+        Gets the number of loaded Chunks.
+        """
+    @property
     def loaded_chunks(self) -> list[Chunk]:
         """
         Gets a list of all loaded Chunks
@@ -1330,6 +1520,18 @@ class EventPriority:
     @property
     def value(self) -> int:
         ...
+class FormTemplate:
+    """
+    Represents a form that is serialized once and then sent to any number of players.
+    """
+    @staticmethod
+    def _pybind11_conduit_v1_(*args, **kwargs):
+        ...
+    @property
+    def placeholders(self) -> list[str]:
+        """
+        Gets the names of the placeholders in the form, in the order they first appear.
+        """
 class GameMode:
     """
     Represents the various type of game modes that Players may have.
@@ -1391,6 +1593,10 @@ class Inventory:
         """
         Stores the given ItemStacks in the inventory. This will try to fill existing stacks and empty slots as well as it can.
         """
+    def batch_update(self, callback: typing.Callable[[Inventory], None]) -> None:
+        """
+        Runs several changes to the inventory as one update. For player inventories, the changes are sent to the player once, after the callback returns.
+        """
     def clear(self) -> None:
         """
         Clears out the whole Inventory.
@@ -1543,6 +1749,10 @@ class Level:
         """
         Gets the dimension with the given name.
         """
+    def snapshot_actors(self, snapshot: typing.Any = None, fields: int = 63, dimension: Dimension = None, type: str = '', players_only: bool = False) -> typing.Any:
+        """
+        Captures the state of all actors in this level into a structure-of-arrays snapshot. Pass the previous snapshot to reuse its storage.
+        """
     @property
     def actors(self) -> list[Actor]:
         """
@@ -1554,6 +1764,38 @@ class Level:
         Gets a list of all dimensions within this level.
         """
     @property
+    def experience_merge_radius(self) -> float:
+        """
+        Gets or sets the radius within which experience orbs are merged, or 0 to disable merging.
+        """
+    @experience_merge_radius.setter
+    def experience_merge_radius(self, arg1: float) -> None:
+        ...
+    @property
+    def item_merge_radius(self) -> float:
+        """
+        Gets or sets the radius within which dropped items are merged, or 0 to disable merging.
+        """
+    @item_merge_radius.setter
+    def item_merge_radius(self, arg1: float) -> None:
+        ...
+    @property
+    def merge_budget(self) -> int:
+        """
+        Gets or sets the maximum number of actors a merge pass may examine per tick.
+        """
+    @merge_budget.setter
+    def merge_budget(self, arg1: int) -> None:
+        ...
+    @property
+    def merge_interval(self) -> int:
+        """
+        Gets or sets the interval, in ticks, between two merge passes.
+        """
+    @merge_interval.setter
+    def merge_interval(self, arg1: int) -> None:
+        ...
+    @property
     def name(self) -> str:
         """
         Gets the unique name of this level
@@ -1847,6 +2089,10 @@ class Objective:
         """
         Sets the display slot and sort order for this objective. This will remove it from any other display slot.
         """
+    def set_scores(self, scores: list[tuple[Player | Actor | str, int]]) -> None:
+        """
+        Sets the scores of many entries for this objective at once, sending a single packet to clients.
+        """
     def unregister(self) -> None:
         """
         Unregisters this objective from the associated Scoreboard.
@@ -2274,10 +2520,16 @@ class Player(Mob, OfflinePlayer):
         """
         Resets the title displayed to the player. This will clear the displayed title / subtitle and reset timings to their default values.
         """
+    @typing.overload
     def send_form(self, form: MessageForm | ActionForm | ModalForm) -> None:
         """
         Sends a form to the player.
         """
+    @typing.overload
+    def send_form(self, form: FormTemplate, values: dict[str, str] | None = None) -> None:
+        """
+        Sends a form template to the player, filling in its placeholders.
+        """
     def send_packet(self, packet: Packet) -> None:
         """
         Sends a packet to the player.
@@ -2452,6 +2704,16 @@ class Player(Mob, OfflinePlayer):
         Returns the UUID of this player
         """
     @property
+    def view_distance(self) -> int:
+        """
+        Gets the view distance last sent to the player, including any reduction hinted under heavy load.
+        """
+    @property
+    def virtual_scoreboard(self) -> VirtualScoreboard:
+        """
+        Gets the VirtualScoreboard of this player, whose displays are only shown to this player.
+        """
+    @property
     def walk_speed(self) -> float:
         """
         Gets or sets the current allowed speed that a client can walk.
@@ -2698,6 +2960,64 @@ class PlayerLoginEvent(PlayerEvent, Cancellable):
     @kick_message.setter
     def kick_message(self, arg1: str) -> None:
         ...
+class PlayerMoveEvent(PlayerEvent, Cancellable):
+    """
+    Called when a player moves past the threshold declared by a handler.
+    """
+    @staticmethod
+    def _pybind11_conduit_v1_(*args, **kwargs):
+        ...
+    @property
+    def from_location(self) -> Location:
+        """
+        Gets the location that this player moved from.
+        """
+    @property
+    def to_location(self) -> Location:
+        """
+        Gets the location that this player moved to.
+        """
+class PlayerMoveThreshold:
+    """
+    Declares how far a player must move before a handler of PlayerMoveEvent is called. When no criterion is enabled, any change in position or rotation counts.
+    """
+    @staticmethod
+    def _pybind11_conduit_v1_(*args, **kwargs):
+        ...
+    def __init__(self, distance: float = 0.0, rotation: float = 0.0, block: bool = False, chunk: bool = False) -> None:
+        ...
+    @property
+    def block(self) -> bool:
+        """
+        Whether entering another block counts.
+        """
+    @block.setter
+    def block(self, arg0: bool) -> None:
+        ...
+    @property
+    def chunk(self) -> bool:
+        """
+        Whether entering another chunk counts.
+        """
+    @chunk.setter
+    def chunk(self, arg0: bool) -> None:
+        ...
+    @property
+    def distance(self) -> float:
+        """
+        The minimum distance moved, in blocks, or 0 to disable.
+        """
+    @distance.setter
+    def distance(self, arg0: float) -> None:
+        ...
+    @property
+    def rotation(self) -> float:
+        """
+        The minimum change in pitch or yaw, in degrees, or 0 to disable.
+        """
+    @rotation.setter
+    def rotation(self, arg0: float) -> None:
+        ...
 class PlayerQuitEvent(PlayerEvent):
     """
     Called when a player leaves a server.
@@ -2743,6 +3063,23 @@ class PlayerTeleportEvent(PlayerEvent, Cancellable):
     @to_location.setter
     def to_location(self, arg1: Location) -> None:
         ...
+class PlayerViewDistanceChangeEvent(PlayerEvent, Cancellable):
+    """
+    Called when the view distance hint sent to a player is about to change.
+    """
+    @staticmethod
+    def _pybind11_conduit_v1_(*args, **kwargs):
+        ...
+    @property
+    def new_view_distance(self) -> int:
+        """
+        Gets the view distance the player is changed to.
+        """
+    @property
+    def old_view_distance(self) -> int:
+        """
+        Gets the view distance of the player before the change.
+        """
 class Plugin(CommandExecutor):
     """
     Represents a Plugin
@@ -3088,6 +3425,10 @@ class PluginManager:
         """
         Registers the given event
         """
+    def register_move_event(self, executor: typing.Callable[[Event], None], threshold: PlayerMoveThreshold, priority: EventPriority, plugin: Plugin, ignore_cancelled: bool) -> None:
+        """
+        Registers a handler of PlayerMoveEvent that is only called once a player has moved past the given threshold
+        """
     @typing.overload
     def remove_permission(self, perm: Permission) -> None:
         """
@@ -3219,6 +3560,14 @@ class Scheduler:
     @staticmethod
     def _pybind11_conduit_v1_(*args, **kwargs):
         ...
+    def call_async(self, plugin: Plugin, func: typing.Callable[..., typing.Any], *args) -> concurrent.futures.Future:
+        """
+        Calls a function on a worker thread and returns a future of its result.
+        """
+    def call_sync(self, plugin: Plugin, func: typing.Callable[..., typing.Any], *args) -> concurrent.futures.Future:
+        """
+        Calls a function on the server thread on the next tick and returns a future of its result.
+        """
     def cancel_task(self, id: int) -> None:
         """
         Removes task from scheduler.
@@ -3239,10 +3588,31 @@ class Scheduler:
         """
         Check if the task currently running.
         """
+    def next_tick(self) -> typing.Awaitable[None]:
+        """
+        Returns an awaitable that completes at the beginning of the next tick.
+        """
+    def post_sync(self, plugin: Plugin, callback: typing.Callable[[], None]) -> None:
+        """
+        Queues a callback to be run by the server thread on the next tick. The callbacks of a plugin are discarded once it is disabled.
+        """
+    def run_async(self, func: typing.Any, *args) -> typing.Awaitable[typing.Any]:
+        """
+        Runs a blocking function or a coroutine off the server thread and returns an awaitable of its result.
+        """
     def run_task(self, plugin: Plugin, task: typing.Callable[[], None], delay: int = 0, period: int = 0) -> Task:
         """
         Returns a task that will be executed synchronously
         """
+    def sleep_ticks(self, ticks: int) -> typing.Awaitable[None]:
+        """
+        Returns an awaitable that completes after the given number of ticks.
+        """
+    @property
+    def event_loop(self) -> typing.Any:
+        """
+        Gets the asyncio event loop run by the server thread on every tick.
+        """
 class Score:
     """
     Represents a score for an objective on a scoreboard.
@@ -3316,6 +3686,14 @@ class Scoreboard:
         Removes all scores for an entry on this Scoreboard
         """
     @property
+    def buffered(self) -> bool:
+        """
+        Gets or sets whether score changes on this Scoreboard are buffered until the end of the tick.
+        """
+    @buffered.setter
+    def buffered(self, arg1: bool) -> None:
+        ...
+    @property
     def entries(self) -> list[Player | Actor | str]:
         """
         Gets all entries tracked by this Scoreboard
@@ -3370,6 +3748,10 @@ class Server:
         """
         Creates a boss bar instance to display to players. The progress defaults to 1.0.
         """
+    def create_form_template(self, form: MessageForm | ActionForm | ModalForm) -> FormTemplate:
+        """
+        Creates a form template, serializing the form once so that it can be sent to many players.
+        """
     def create_scoreboard(self) -> Scoreboard:
         """
         Creates a new Scoreboard to be tracked by the server.
@@ -3517,6 +3899,14 @@ class Server:
         """
         Gets the version of this server implementation.
         """
+    @property
+    def view_distance_hint_settings(self) -> ViewDistanceHintSettings:
+        """
+        Gets or sets the settings of the view distance hint.
+        """
+    @view_distance_hint_settings.setter
+    def view_distance_hint_settings(self, arg1: ViewDistanceHintSettings) -> None:
+        ...
 class ServerCommandEvent(ServerEvent, Cancellable):
     """
     Called when the console runs a command, early in the process.
@@ -4056,6 +4446,106 @@ class Vector:
     @z.setter
     def z(self, arg1: float) -> None:
         ...
+class ViewDistanceHintSettings:
+    """
+    Represents the settings of the view distance hint, which asks clients to use a smaller view distance while the server is under heavy load and restores it once the load recovers. The server keeps publishing chunks within the radius each client requests.
+    """
+    @staticmethod
+    def _pybind11_conduit_v1_(*args, **kwargs):
+        ...
+    def __init__(self) -> None:
+        ...
+    @property
+    def cooldown(self) -> int:
+        """
+        The minimum number of ticks between two adjustments.
+        """
+    @cooldown.setter
+    def cooldown(self, arg0: int) -> None:
+        ...
+    @property
+    def enabled(self) -> bool:
+        """
+        Whether the view distance hint is enabled.
+        """
+    @enabled.setter
+    def enabled(self, arg0: bool) -> None:
+        ...
+    @property
+    def high_mspt(self) -> float:
+        """
+        The average MSPT above which the view distance is reduced.
+        """
+    @high_mspt.setter
+    def high_mspt(self, arg0: float) -> None:
+        ...
+    @property
+    def low_mspt(self) -> float:
+        """
+        The average MSPT below which the view distance is restored.
+        """
+    @low_mspt.setter
+    def low_mspt(self, arg0: float) -> None:
+        ...
+    @property
+    def max_view_distance(self) -> int:
+        """
+        The view distance in chunks the hint never goes above, or 0 to use the server's.
+        """
+    @max_view_distance.setter
+    def max_view_distance(self, arg0: int) -> None:
+        ...
+    @property
+    def min_view_distance(self) -> int:
+        """
+        The view distance in chunks the hint never goes below.
+        """
+    @min_view_distance.setter
+    def min_view_distance(self, arg0: int) -> None:
+        ...
+    @property
+    def step(self) -> int:
+        """
+        The number of chunks the view distance is changed by in a single adjustment.
+        """
+    @step.setter
+    def step(self, arg0: int) -> None:
+        ...
+class VirtualScoreboard:
+    """
+    Represents the scoreboard displays that are only shown to a single player.
+    """
+    @staticmethod
+    def _pybind11_conduit_v1_(*args, **kwargs):
+        ...
+    def clear_display(self, slot: DisplaySlot) -> None:
+        """
+        Removes the display and all scores of the specified slot.
+        """
+    def get_score(self, slot: DisplaySlot, entry: Player | Actor | str) -> int | None:
+        """
+        Gets the score of an entry in the specified slot.
+        """
+    def is_displayed(self, slot: DisplaySlot) -> bool:
+        """
+        Gets if an objective is displayed in the specified slot.
+        """
+    def reset_score(self, slot: DisplaySlot, entry: Player | Actor | str) -> None:
+        """
+        Removes the score of an entry in the specified slot.
+        """
+    def set_display(self, slot: DisplaySlot, display_name: str, order: ObjectiveSortOrder | None = None) -> None:
+        """
+        Displays an objective in the specified slot, replacing anything this VirtualScoreboard showed there.
+        """
+    def set_lines(self, slot: DisplaySlot, lines: list[str]) -> None:
+        """
+        Replaces all scores in the specified slot with lines of text, shown from top to bottom.
+        """
+    def set_score(self, slot: DisplaySlot, entry: Player | Actor | str, score: int) -> None:
+        """
+        Sets the score of an entry in the specified slot.
+        """
 class WeatherChangeEvent(WeatherEvent, Cancellable):
     """
     Called when the weather (rain) state in a world is changing.
@@ -0,0 +1,230 @@
+from __future__ import annotations
+
+import asyncio
+import heapq
+import itertools
+import sys
+import threading
+import time
+import typing
+from concurrent.futures import Future as ConcurrentFuture
+from concurrent.futures import InvalidStateError
+from concurrent.futures import ThreadPoolExecutor
+
+__all__ = [
+    "Future",
+    "TickEventLoop",
+    "get_event_loop",
+    "next_tick",
+    "sleep_ticks",
+    "run_async",
+    "call_sync",
+    "call_async",
+]
+
+_current: TickEventLoop | None = None
+
+_BaseEventLoop = asyncio.ProactorEventLoop if sys.platform == "win32" else asyncio.SelectorEventLoop
+
+
+class _CountingEventLoop(_BaseEventLoop):
+    """
+    An event loop that counts the callbacks scheduled on it. A callback scheduled while the loop runs an iteration is
+    ready for the next one, so the count tells whether another iteration has any work to do.
+    """
+
+    def __init__(self):
+        super().__init__()
+        self.scheduled = 0
+
+    def call_soon(self, callback, *args, context=None):
+        self.scheduled += 1
+        return super().call_soon(callback, *args, context=context)
+
+    def call_soon_threadsafe(self, callback, *args, context=None):
+        self.scheduled += 1
+        return super().call_soon_threadsafe(callback, *args, context=context)
+
+
+class Future(ConcurrentFuture):
+    """
+    A concurrent future that can also be awaited by coroutines running on the event loop of the server.
+    """
+
+    def __await__(self):
+        return asyncio.wrap_future(self, loop=get_event_loop().loop).__await__()
+
+
+class TickEventLoop:
+    """
+    Hosts the asyncio event loop shared by all Python plugins.
+
+    The loop never blocks the server. It is pumped once per tick from the server thread, running ready callbacks until
+    either none are left or the time slice of the tick is used up. Coroutines that wait for I/O or for a number of
+    ticks are simply resumed on a later tick.
+
+    Blocking functions are offloaded to a thread pool, and coroutines that must not run on the server thread are offloaded
+    to a background thread that runs its own event loop.
+    """
+
+    def __init__(self, time_slice: float = 0.005):
+        self._loop = _CountingEventLoop()
+        self._time_slice = time_slice
+        self._current_tick = 0
+        self._sleepers: list[tuple[int, int, asyncio.Future]] = []
+        self._sequence = itertools.count()
+        self._background_loop: asyncio.AbstractEventLoop | None = None
+        self._background_thread: threading.Thread | None = None
+        self._executor = ThreadPoolExecutor(thread_name_prefix="endstone-worker")
+        self._loop.set_default_executor(self._executor)
+
+    @property
+    def loop(self) -> asyncio.AbstractEventLoop:
+        return self._loop
+
+    @property
+    def time_slice(self) -> float:
+        return self._time_slice
+
+    @time_slice.setter
+    def time_slice(self, value: float) -> None:
+        if value <= 0:
+            raise ValueError(f"Time slice ({value}) must be positive.")
+        self._time_slice = value
+
+    def pump(self, current_tick: int) -> None:
+        """Runs the loop on the server thread for at most one time slice."""
+        self._current_tick = current_tick
+        while self._sleepers and self._sleepers[0][0] <= current_tick:
+            _, _, future = heapq.heappop(self._sleepers)
+            if not future.done():
+                future.set_result(None)
+
+        deadline = time.perf_counter() + self._time_slice
+        while True:
+            # one iteration of the loop: poll the selector without blocking, then run the callbacks that are ready
+            scheduled = self._loop.scheduled
+            self._loop.call_soon(self._loop.stop)
+            self._loop.run_forever()
+            # stop once the iteration has scheduled nothing besides the stop callback itself
+            if self._loop.scheduled == scheduled + 1 or time.perf_counter() >= deadline:
+                break
+
+    def sleep_ticks(self, ticks: int) -> asyncio.Future:
+        future = self._loop.create_future()
+        heapq.heappush(self._sleepers, (self._current_tick + max(1, ticks), next(self._sequence), future))
+        return future
+
+    def run_async(self, func: typing.Callable | typing.Awaitable, *args) -> asyncio.Future:
+        if asyncio.iscoroutine(func):
+            if args:
+                raise TypeError("Arguments cannot be passed along with a coroutine.")
+            return asyncio.wrap_future(
+                asyncio.run_coroutine_threadsafe(func, self._get_background_loop()), loop=self._loop
+            )
+
+        return self._loop.run_in_executor(None, func, *args)
+
+    def call_async(self, plugin, func: typing.Callable, *args) -> Future:
+        future = Future()
+        self._executor.submit(_complete, future, plugin, func, *args)
+        return future
+
+    def close(self) -> None:
+        for task in asyncio.all_tasks(self._loop):
+            task.cancel()
+        self._loop.call_soon(self._loop.stop)
+        self._loop.run_forever()
+        self._loop.run_until_complete(self._loop.shutdown_default_executor())
+        self._loop.close()
+
+        if self._background_loop is not None:
+            self._background_loop.call_soon_threadsafe(self._background_loop.stop)
+            self._background_thread.join()
+            self._background_loop.close()
+
+    def _get_background_loop(self) -> asyncio.AbstractEventLoop:
+        if self._background_loop is None:
+            self._background_loop = asyncio.new_event_loop()
+            self._background_thread = threading.Thread(
+                target=self._background_loop.run_forever, name="endstone-asyncio", daemon=True
+            )
+            self._background_thread.start()
+
+        return self._background_loop
+
+
+def _complete(future: ConcurrentFuture, plugin, func: typing.Callable, *args) -> None:
+    if not plugin.is_enabled:
+        future.cancel()
+
+    if not future.set_running_or_notify_cancel():
+        return
+
+    try:
+        result = func(*args)
+    except BaseException as e:
+        future.set_exception(e)
+    else:
+        future.set_result(result)
+
+
+class _SyncCall:
+    """
+    Completes a future on the server thread. If it is discarded before running, e.g. because the plugin was disabled,
+    the future fails instead of never completing.
+    """
+
+    def __init__(self, future: ConcurrentFuture, plugin, func: typing.Callable, *args):
+        self._future = future
+        self._plugin = plugin
+        self._func = func
+        self._args = args
+
+    def __call__(self) -> None:
+        _complete(self._future, self._plugin, self._func, *self._args)
+
+    def __del__(self) -> None:
+        try:
+            self._future.set_exception(RuntimeError("Task was cancelled before it could complete"))
+        except InvalidStateError:
+            pass  # already completed or cancelled
+
+
+def get_event_loop() -> TickEventLoop:
+    if _current is None:
+        raise RuntimeError("The event loop is not available.")
+
+    return _current
+
+
+def set_event_loop(loop: TickEventLoop | None) -> None:
+    global _current
+    _current = loop
+
+
+def next_tick() -> asyncio.Future:
+    """Returns an awaitable that completes at the beginning of the next tick."""
+    return get_event_loop().sleep_ticks(1)
+
+
+def sleep_ticks(ticks: int) -> asyncio.Future:
+    """Returns an awaitable that completes after the given number of ticks."""
+    return get_event_loop().sleep_ticks(ticks)
+
+
+def run_async(func: typing.Callable | typing.Awaitable, *args) -> asyncio.Future:
+    """Runs a blocking function or a coroutine off the server thread and returns an awaitable of its result."""
+    return get_event_loop().run_async(func, *args)
+
+
+def call_sync(scheduler, plugin, func: typing.Callable, *args) -> Future:
+    """Calls a function on the server thread on the next tick and returns a future of its result."""
+    future = Future()
+    scheduler.post_sync(plugin, _SyncCall(future, plugin, func, *args))
+    return future
+
+
+def call_async(plugin, func: typing.Callable, *args) -> Future:
+    """Calls a function on a worker thread and returns a future of its result."""
+    return get_event_loop().call_async(plugin, func, *args)
@@ -4,17 +4,17 @@ import glob
 import importlib
 import os
 import os.path
-import shutil
 import site
-import subprocess
 import sys
+import time
 import warnings
 
-import pkginfo
 from importlib_metadata import EntryPoint, distribution, entry_points, metadata
 
-from endstone import Server
+from endstone import Server, __version__
+from endstone._internal.event_loop import TickEventLoop, set_event_loop
 from endstone._internal.metrics import Metrics
+from endstone._internal.wheel_cache import WheelCache
 from endstone.command import Command
 from endstone.permissions import Permission, PermissionDefault
 from endstone.plugin import Plugin, PluginDescription, PluginLoader, PluginLoadOrder
@@ -59,17 +59,30 @@ class PythonPluginLoader(PluginLoader):
             if module.startswith("endstone_"):
                 del sys.modules[module]
 
-        # prepare the temp site-dir
-        self._prefix = os.path.join("plugins", ".local")
-        shutil.rmtree(self._prefix, ignore_errors=True)
-        for site_dir in site.getsitepackages(prefixes=[self._prefix]):
+        # prepare the site-dir, wheels installed by a previous run are kept unless their content has changed
+        self._cache = WheelCache(
+            os.path.join("plugins", ".local"), tag=f"{sys.implementation.cache_tag}-endstone-{__version__}"
+        )
+        for site_dir in self._cache.site_dirs:
             site.addsitedir(site_dir)
 
         # initialize the metrics
         self._metrics = Metrics(self.server)
 
+        # create the asyncio event loop shared by the plugins, it is pumped by the server thread on every tick
+        self._event_loop = TickEventLoop()
+        set_event_loop(self._event_loop)
+
     def __del__(self):
         self._metrics.shutdown()
+        self._event_loop.close()
+
+    def _tick(self, current_tick: int) -> None:
+        self._event_loop.pump(current_tick)
+
+    def disable_plugin(self, plugin: Plugin) -> None:
+        PluginLoader.disable_plugin(self, plugin)
+        plugin._shutdown_worker_pool()
 
     @staticmethod
     def _build_commands(commands: dict) -> list[Command]:
@@ -97,51 +110,57 @@ class PythonPluginLoader(PluginLoader):
         return results
 
     def load_plugin(self, file: str) -> Plugin | None:
-        env = os.environ.copy()
-        env.pop("LD_PRELOAD", "")
-
-        dist_name = pkginfo.Wheel(file).name
-        subprocess.run(
-            [
-                sys.executable,
-                "-m",
-                "pip",
-                "install",
-                file,
-                "--prefix",
-                self._prefix,
-                "--quiet",
-                "--no-warn-script-location",
-                "--disable-pip-version-check",
-            ],
-            env=env,
-        )
-
-        eps = distribution(dist_name).entry_points.select(group="endstone")
-        for ep in eps:
-            plugin = self._load_plugin_from_ep(ep)
-            if plugin:
-                return plugin
+        result = self._cache.sync([file])
+        if file in result.failed:
+            self.server.logger.error(f"Error occurred when trying to install plugin from '{file}'.")
+            return None
 
-        return None
+        return self._load_plugin_from_dist(result.dists[file])
 
     def load_plugins(self, directory: str) -> list[Plugin]:
+        start = time.perf_counter()
         loaded_plugins = []
 
         if not self._plugins:
             eps = entry_points(group="endstone")
             for ep in eps:
+                # plugins installed from wheels are loaded below, once their wheels are verified
+                if self._cache.contains(ep.dist):
+                    continue
+
                 plugin = self._load_plugin_from_ep(ep)
                 if plugin:
                     loaded_plugins.append(plugin)
 
-        for file in glob.glob(os.path.join(directory, "*.whl")):
-            plugin = self.load_plugin(file)
+        files = glob.glob(os.path.join(directory, "*.whl"))
+        install_start = time.perf_counter()
+        result = self._cache.sync(files, prune=True)
+        install_time = time.perf_counter() - install_start
+
+        for file in files:
+            if file in result.failed:
+                self.server.logger.error(f"Error occurred when trying to install plugin from '{file}'.")
+                continue
+
+            plugin = self._load_plugin_from_dist(result.dists[file])
             if plugin:
                 loaded_plugins.append(plugin)
 
+        self.server.logger.info(
+            f"Loaded {len(loaded_plugins)} Python plugin(s) in {(time.perf_counter() - start) * 1000:.0f} ms "
+            f"({result.cached} wheel(s) cached, {result.installed} installed in {install_time * 1000:.0f} ms)."
+        )
         return loaded_plugins
 
+    def _load_plugin_from_dist(self, dist_name: str) -> Plugin | None:
+        eps = distribution(dist_name).entry_points.select(group="endstone")
+        for ep in eps:
+            plugin = self._load_plugin_from_ep(ep)
+            if plugin:
+                return plugin
+
+        return None
+
     def _load_plugin_from_ep(self, ep: EntryPoint) -> Plugin | None:
         # enforce naming convention
         if not ep.dist.name.replace("_", "-").startswith("endstone-"):
@@ -169,6 +188,7 @@ class PythonPluginLoader(PluginLoader):
             return None
 
         # get distribution metadata
+        start = time.perf_counter()
         try:
             plugin_metadata = metadata(ep.dist.name).json
             cls = ep.load()
@@ -224,11 +244,18 @@ class PythonPluginLoader(PluginLoader):
         )
 
         # instantiate plugin
+        import_time = time.perf_counter() - start
         plugin = cls()
         if not isinstance(plugin, Plugin):
             self.server.logger.error(f"Main class {ep.value} does not extend endstone.plugin.Plugin")
             return None
 
+        total_time = time.perf_counter() - start
+        self.server.logger.debug(
+            f"Loaded plugin '{name}' in {total_time * 1000:.1f} ms (import: {import_time * 1000:.1f} ms, "
+            f"init: {(total_time - import_time) * 1000:.1f} ms)."
+        )
+
         plugin._description = plugin_description
         self._plugins.append(plugin)
         return plugin
@@ -0,0 +1,188 @@
+from __future__ import annotations
+
+import hashlib
+import importlib
+import json
+import os
+import os.path
+import shutil
+import site
+import subprocess
+import sys
+from dataclasses import dataclass, field
+from pathlib import Path
+
+import pkginfo
+from importlib_metadata import Distribution
+
+__all__ = ["WheelCache", "SyncResult"]
+
+
+@dataclass
+class SyncResult:
+    dists: dict[str, str] = field(default_factory=dict)
+    """Distribution name of each wheel that is installed, keyed by wheel path."""
+
+    cached: int = 0
+    """Number of wheels that were already installed and left untouched."""
+
+    installed: int = 0
+    """Number of wheels that were (re)installed."""
+
+    failed: list[str] = field(default_factory=list)
+    """Paths of the wheels that could not be installed."""
+
+
+class WheelCache:
+    """
+    Keeps plugin wheels installed in a persistent prefix across restarts and reloads.
+
+    Each installed wheel is recorded in a manifest together with the SHA-256 hash of its content. Wheels whose hash is
+    unchanged are not touched, new or changed wheels are installed with a single pip invocation, and the whole prefix
+    is discarded whenever the Python or Endstone version changes.
+    """
+
+    MANIFEST = "manifest.json"
+
+    def __init__(self, prefix: str, tag: str):
+        self._prefix = prefix
+        self._tag = tag
+        self._site_dirs = site.getsitepackages(prefixes=[prefix])
+        self._manifest = self._read_manifest()
+
+    @property
+    def site_dirs(self) -> list[str]:
+        return self._site_dirs
+
+    def contains(self, dist: Distribution) -> bool:
+        """Checks if the given distribution is installed in this cache."""
+        location = os.path.abspath(str(dist.locate_file("")))
+        return any(location == os.path.abspath(site_dir) for site_dir in self._site_dirs)
+
+    def sync(self, files: list[str], prune: bool = False) -> SyncResult:
+        """
+        Makes sure the given wheels are installed.
+
+        Args:
+            files: Paths of the wheels to install.
+            prune: Whether to uninstall previously installed wheels that are not in the given list.
+        """
+        result = SyncResult()
+        stale: dict[str, tuple[str, str]] = {}
+        obsolete: set[str] = set()
+
+        for file in files:
+            digest = self._hash(file)
+            entry = self._manifest.get(os.path.basename(file))
+            if entry is not None and entry["sha256"] == digest:
+                result.dists[file] = entry["name"]
+                result.cached += 1
+                continue
+
+            name = pkginfo.Wheel(file).name
+            stale[file] = (name, digest)
+            obsolete.add(name)
+
+        if prune:
+            keep = {os.path.basename(file) for file in files}
+            obsolete.update(entry["name"] for key, entry in self._manifest.items() if key not in keep)
+
+        for key, entry in list(self._manifest.items()):
+            if entry["name"] in obsolete:
+                del self._manifest[key]
+        for name in obsolete:
+            self._uninstall(name)
+
+        if stale:
+            installed = self._install(list(stale.keys()))
+            for file, (name, digest) in stale.items():
+                if file not in installed:
+                    result.failed.append(file)
+                    continue
+                self._manifest[os.path.basename(file)] = {"name": name, "sha256": digest}
+                result.dists[file] = name
+                result.installed += 1
+            importlib.invalidate_caches()
+
+        self._write_manifest()
+        return result
+
+    def _read_manifest(self) -> dict[str, dict[str, str]]:
+        try:
+            with open(os.path.join(self._prefix, self.MANIFEST), "r", encoding="utf-8") as f:
+                data = json.load(f)
+        except (OSError, ValueError):
+            data = {}
+
+        if data.get("tag") != self._tag:
+            # the cache was created by a different Python or Endstone version (or not at all), start from scratch
+            shutil.rmtree(self._prefix, ignore_errors=True)
+            return {}
+
+        return data.get("wheels", {})
+
+    def _write_manifest(self) -> None:
+        os.makedirs(self._prefix, exist_ok=True)
+        with open(os.path.join(self._prefix, self.MANIFEST), "w", encoding="utf-8") as f:
+            json.dump({"tag": self._tag, "wheels": self._manifest}, f, indent=2, sort_keys=True)
+
+    @staticmethod
+    def _hash(file: str) -> str:
+        digest = hashlib.sha256()
+        with open(file, "rb") as f:
+            for chunk in iter(lambda: f.read(1024 * 1024), b""):
+                digest.update(chunk)
+        return digest.hexdigest()
+
+    def _install(self, files: list[str]) -> set[str]:
+        if self._pip_install(files):
+            return set(files)
+
+        if len(files) == 1:
+            return set()
+
+        # one broken wheel fails the whole batch, fall back to installing them one by one
+        return {file for file in files if self._pip_install([file])}
+
+    def _pip_install(self, files: list[str]) -> bool:
+        env = os.environ.copy()
+        env.pop("LD_PRELOAD", "")
+        # let pip see what is already installed in the prefix, so shared dependencies are not installed again
+        python_path = list(self._site_dirs)
+        if "PYTHONPATH" in env:
+            python_path.append(env["PYTHONPATH"])
+        env["PYTHONPATH"] = os.pathsep.join(python_path)
+
+        find_links = sorted({os.path.dirname(os.path.abspath(file)) for file in files})
+        process = subprocess.run(
+            [
+                sys.executable,
+                "-m",
+                "pip",
+                "install",
+                *files,
+                *[arg for link in find_links for arg in ("--find-links", link)],
+                "--prefix",
+                self._prefix,
+                "--quiet",
+                "--no-warn-script-location",
+                "--disable-pip-version-check",
+            ],
+            env=env,
+        )
+        return process.returncode == 0
+
+    def _uninstall(self, name: str) -> None:
+        for dist in Distribution.discover(name=name, path=self._site_dirs):
+            directories = set()
+            for file in dist.files or []:
+                path = Path(file.locate())
+                path.unlink(missing_ok=True)
+                directories.add(path.parent)
+
+            # remove the directories left empty, deepest first
+            for directory in sorted(directories, key=lambda p: len(p.parts), reverse=True):
+                try:
+                    directory.rmdir()
+                except OSError:
+                    pass
@@ -0,0 +1,45 @@
+from __future__ import annotations
+
+import multiprocessing
+import os
+import sys
+import threading
+from concurrent.futures import Executor, Future, ProcessPoolExecutor
+
+__all__ = ["create_worker_pool"]
+
+_environ_lock = threading.Lock()
+
+
+class _WorkerProcessPoolExecutor(ProcessPoolExecutor):
+    def submit(self, fn, /, *args, **kwargs) -> Future:
+        # worker processes are started on demand by submit, keep the Endstone runtime from being preloaded into them
+        # without changing the environment that the server passes to any other process it starts
+        with _environ_lock:
+            preload = os.environ.pop("LD_PRELOAD", None)
+            try:
+                return super().submit(fn, *args, **kwargs)
+            finally:
+                if preload is not None:
+                    os.environ["LD_PRELOAD"] = preload
+
+
+def create_worker_pool(max_workers: int | None = None) -> Executor:
+    """
+    Creates a pool of workers that run Python code in parallel with the server, each with its own GIL.
+
+    On Python 3.14 and later, each worker is a sub-interpreter in the server process. On earlier versions, each worker
+    is a separate Python process, since sub-interpreters with their own GIL cannot be created through a public API.
+
+    Args:
+        max_workers: The maximum number of workers, or None to use the default of the executor.
+    """
+    if sys.version_info >= (3, 14):
+        from concurrent.futures import InterpreterPoolExecutor
+
+        return InterpreterPoolExecutor(max_workers=max_workers)
+
+    # the server process must never be forked, start a fresh interpreter for each worker instead
+    context = multiprocessing.get_context("spawn")
+    context.set_executable(sys.executable)
+    return _WorkerProcessPoolExecutor(max_workers=max_workers, mp_context=context)
@@ -1,3 +1,5 @@
+import typing
+
 from endstone._internal.endstone_python import (
     ActorDamageEvent,
     ActorDeathEvent,
@@ -7,6 +9,8 @@ from endstone._internal.endstone_python import (
     ActorRemoveEvent,
     ActorSpawnEvent,
     ActorTeleportEvent,
+    AsyncPlayerChatEvent,
+    AsyncPlayerPreLoginEvent,
     BlockBreakEvent,
     BlockEvent,
     BlockPlaceEvent,
@@ -26,9 +30,12 @@ from endstone._internal.endstone_python import (
     PlayerJoinEvent,
     PlayerKickEvent,
     PlayerLoginEvent,
+    PlayerMoveEvent,
+    PlayerMoveThreshold,
     PlayerQuitEvent,
     PlayerRespawnEvent,
     PlayerTeleportEvent,
+    PlayerViewDistanceChangeEvent,
     PluginDisableEvent,
     PluginEnableEvent,
     ScriptMessageEvent,
@@ -59,6 +66,8 @@ __all__ = [
     "EventPriority",
     "MobEvent",
     "PlayerEvent",
+    "AsyncPlayerChatEvent",
+    "AsyncPlayerPreLoginEvent",
     "PlayerChatEvent",
     "PlayerCommandEvent",
     "PlayerDeathEvent",
@@ -69,9 +78,12 @@ __all__ = [
     "PlayerJoinEvent",
     "PlayerKickEvent",
     "PlayerLoginEvent",
+    "PlayerMoveEvent",
+    "PlayerMoveThreshold",
     "PlayerQuitEvent",
     "PlayerRespawnEvent",
     "PlayerTeleportEvent",
+    "PlayerViewDistanceChangeEvent",
     "BroadcastMessageEvent",
     "PluginEnableEvent",
     "PluginDisableEvent",
@@ -86,11 +98,18 @@ __all__ = [
 ]
 
 
-def event_handler(func=None, *, priority: EventPriority = EventPriority.NORMAL, ignore_cancelled: bool = False):
+def event_handler(
+    func=None,
+    *,
+    priority: EventPriority = EventPriority.NORMAL,
+    ignore_cancelled: bool = False,
+    threshold: typing.Optional[PlayerMoveThreshold] = None,
+):
     def decorator(f):
         setattr(f, "_is_event_handler", True)
         setattr(f, "_priority", priority)
         setattr(f, "_ignore_cancelled", ignore_cancelled)
+        setattr(f, "_threshold", threshold)
         return f
 
     if func:
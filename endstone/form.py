@@ -1,6 +1,7 @@
 from endstone._internal.endstone_python import (
     ActionForm,
     Dropdown,
+    FormTemplate,
     Label,
     MessageForm,
     ModalForm,
@@ -10,4 +11,15 @@ from endstone._internal.endstone_python import (
     Toggle,
 )
 
-__all__ = ["ActionForm", "MessageForm", "ModalForm", "Dropdown", "Label", "Slider", "StepSlider", "TextInput", "Toggle"]
+__all__ = [
+    "ActionForm",
+    "FormTemplate",
+    "MessageForm",
+    "ModalForm",
+    "Dropdown",
+    "Label",
+    "Slider",
+    "StepSlider",
+    "TextInput",
+    "Toggle",
+]
@@ -1,7 +1,17 @@
-from endstone._internal.endstone_python import Chunk, Dimension, Level, Location, Position
+from endstone._internal.endstone_python import (
+    ActorSnapshot,
+    Chunk,
+    ChunkSnapshot,
+    Dimension,
+    Level,
+    Location,
+    Position,
+)
 
 __all__ = [
+    "ActorSnapshot",
     "Chunk",
+    "ChunkSnapshot",
     "Dimension",
     "Level",
     "Location",
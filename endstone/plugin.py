@@ -2,12 +2,14 @@ import inspect
 import os
 import shutil
 import typing
+from concurrent.futures import Executor, Future
 from pathlib import Path
 
 import tomlkit
 from importlib_resources import as_file, files
 
 from endstone._internal import endstone_python
+from endstone._internal.worker_pool import create_worker_pool
 from endstone._internal.endstone_python import (
     PluginCommand,
     PluginDescription,
@@ -15,7 +17,7 @@ from endstone._internal.endstone_python import (
     PluginLoadOrder,
     PluginManager,
 )
-from endstone.event import Event
+from endstone.event import Event, PlayerMoveEvent
 
 __all__ = [
     "Plugin",
@@ -59,6 +61,7 @@ class Plugin(endstone_python.Plugin):
         self._description: typing.Optional[PluginDescription] = None
         self._config = None
         self._listeners = []
+        self._worker_pool: typing.Optional[Executor] = None
 
     def _get_description(self) -> PluginDescription:
         return self._description
@@ -96,9 +99,62 @@ class Plugin(endstone_python.Plugin):
             event_cls = params[0].annotation
             priority = getattr(func, "_priority")
             ignore_cancelled = getattr(func, "_ignore_cancelled")
-            self.server.plugin_manager.register_event(
-                getattr(event_cls, "NAME", event_cls.__name__), func, priority, self, ignore_cancelled
-            )
+            threshold = getattr(func, "_threshold", None)
+            if threshold is None:
+                self.server.plugin_manager.register_event(
+                    getattr(event_cls, "NAME", event_cls.__name__), func, priority, self, ignore_cancelled
+                )
+                continue
+
+            if not issubclass(event_cls, PlayerMoveEvent):
+                self.logger.error(
+                    f"Plugin {self.name} attempted to register a threshold for an event other than "
+                    f"PlayerMoveEvent: {attr_name}: {sig}"
+                )
+                continue
+
+            self.server.plugin_manager.register_move_event(func, threshold, priority, self, ignore_cancelled)
+
+    @property
+    def worker_pool(self) -> Executor:
+        """
+        Gets the pool of workers that run CPU-bound work in parallel with the server and with other plugins.
+
+        The pool is created on first use and shut down when the plugin is disabled. Functions, arguments and results are
+        pickled to cross into a worker, so they must not reference any Endstone object, and the functions must be
+        defined in a module that can be imported without importing endstone.
+        """
+        if self._worker_pool is None:
+            self._worker_pool = create_worker_pool()
+
+        return self._worker_pool
+
+    def run_in_worker(
+        self, fn: typing.Callable[..., typing.Any], *args, callback: typing.Callable[[Future], None] = None
+    ) -> Future:
+        """
+        Runs a function in the worker pool of this plugin.
+
+        Args:
+            fn: The function to run, see worker_pool for the restrictions that apply to it.
+            *args: The arguments to pass to the function.
+            callback: A function to call on the server thread with the future once it is done.
+        """
+        future = self.worker_pool.submit(fn, *args)
+        if callback is not None:
+
+            def on_done(f: Future) -> None:
+                if self.is_enabled:
+                    self.server.scheduler.run_task(self, lambda: callback(f))
+
+            future.add_done_callback(on_done)
+
+        return future
+
+    def _shutdown_worker_pool(self) -> None:
+        if self._worker_pool is not None:
+            self._worker_pool.shutdown(wait=True, cancel_futures=True)
+            self._worker_pool = None
 
     @property
     def config(self) -> dict:
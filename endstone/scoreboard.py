@@ -1,3 +1,11 @@
-from endstone._internal.endstone_python import Criteria, DisplaySlot, Objective, ObjectiveSortOrder, Score, Scoreboard
+from endstone._internal.endstone_python import (
+    Criteria,
+    DisplaySlot,
+    Objective,
+    ObjectiveSortOrder,
+    Score,
+    Scoreboard,
+    VirtualScoreboard,
+)
 
-__all__ = ["Criteria", "DisplaySlot", "Objective", "ObjectiveSortOrder", "Score", "Scoreboard"]
+__all__ = ["Criteria", "DisplaySlot", "Objective", "ObjectiveSortOrder", "Score", "Scoreboard", "VirtualScoreboard"]
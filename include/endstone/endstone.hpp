@@ -65,6 +65,8 @@ static_assert(_ITERATOR_DEBUG_LEVEL == 0,
 #include "event/event_handler.h"
 #include "event/event_priority.h"
 #include "event/handler_list.h"
+#include "event/player/async_player_chat_event.h"
+#include "event/player/async_player_pre_login_event.h"
 #include "event/player/player_chat_event.h"
 #include "event/player/player_command_event.h"
 #include "event/player/player_death_event.h"
@@ -76,9 +78,12 @@ static_assert(_ITERATOR_DEBUG_LEVEL == 0,
 #include "event/player/player_join_event.h"
 #include "event/player/player_kick_event.h"
 #include "event/player/player_login_event.h"
+#include "event/player/player_move_event.h"
+#include "event/player/player_move_threshold.h"
 #include "event/player/player_quit_event.h"
 #include "event/player/player_respawn_event.h"
 #include "event/player/player_teleport_event.h"
+#include "event/player/player_view_distance_change_event.h"
 #include "event/server/broadcast_message_event.h"
 #include "event/server/plugin_disable_event.h"
 #include "event/server/plugin_enable_event.h"
@@ -98,15 +103,19 @@ static_assert(_ITERATOR_DEBUG_LEVEL == 0,
 #include "form/controls/text_input.h"
 #include "form/controls/toggle.h"
 #include "form/form.h"
+#include "form/form_template.h"
 #include "form/message_form.h"
 #include "form/modal_form.h"
 #include "game_mode.h"
 #include "inventory/inventory.h"
 #include "inventory/item_stack.h"
+#include "inventory/item_stack_view.h"
 #include "inventory/player_inventory.h"
 #include "lang/language.h"
 #include "lang/translatable.h"
+#include "level/actor_snapshot.h"
 #include "level/chunk.h"
+#include "level/chunk_snapshot.h"
 #include "level/dimension.h"
 #include "level/level.h"
 #include "level/location.h"
@@ -128,6 +137,8 @@ static_assert(_ITERATOR_DEBUG_LEVEL == 0,
 #include "plugin/plugin_load_order.h"
 #include "plugin/plugin_loader.h"
 #include "plugin/plugin_manager.h"
+#include "scheduler/coroutine.h"
+#include "scheduler/future.h"
 #include "scheduler/scheduler.h"
 #include "scheduler/task.h"
 #include "scoreboard/criteria.h"
@@ -138,6 +149,7 @@ static_assert(_ITERATOR_DEBUG_LEVEL == 0,
 #include "scoreboard/score.h"
 #include "scoreboard/score_entry.h"
 #include "scoreboard/scoreboard.h"
+#include "scoreboard/virtual_scoreboard.h"
 #include "server.h"
 #include "skin.h"
 #include "util/error.h"
@@ -146,3 +158,4 @@ static_assert(_ITERATOR_DEBUG_LEVEL == 0,
 #include "util/uuid.h"
 #include "util/vector.h"
 #include "variant.h"
+#include "view_distance_hint.h"
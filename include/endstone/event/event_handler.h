@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <string>
@@ -32,12 +33,22 @@ namespace endstone {
 class EventHandler {
 public:
     EventHandler(std::string event, std::function<void(Event &)> executor, EventPriority priority, Plugin &plugin,
-                 bool ignore_cancelled)
+                 bool ignore_cancelled, std::uint64_t id)
         : event_(std::move(event)), executor_(std::move(executor)), priority_(priority), plugin_(plugin),
-          ignore_cancelled_(ignore_cancelled)
+          ignore_cancelled_(ignore_cancelled), id_(id)
     {
     }
 
+    /**
+     * Gets the id of this registration, which is never reused by another registration
+     *
+     * @return Registration id
+     */
+    [[nodiscard]] std::uint64_t getId() const
+    {
+        return id_;
+    }
+
     /**
      * Gets the plugin for this registration
      *
@@ -99,6 +110,7 @@ private:
     EventPriority priority_;
     Plugin &plugin_;
     bool ignore_cancelled_;
+    std::uint64_t id_;
 };
 
 }  // namespace endstone
@@ -0,0 +1,120 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "endstone/event/cancellable.h"
+#include "endstone/event/event.h"
+#include "endstone/util/uuid.h"
+
+namespace endstone {
+
+/**
+ * @brief Called on a worker thread when a player sends a chat message.
+ *
+ * The event is given a snapshot of the sender and of the players who will receive the message, taken by the server
+ * thread when the message was sent. Messages of the same player are handled one at a time and delivered in the order
+ * they were sent. The outcome is applied by the server thread once all handlers have returned.
+ *
+ * @remark The player objects are not available from this event; handlers should never access any Endstone API.
+ */
+class AsyncPlayerChatEvent : public Cancellable<Event> {
+public:
+    AsyncPlayerChatEvent(std::string player_name, UUID player_unique_id, std::string message,
+                         std::vector<UUID> recipients)
+        : Cancellable(true), player_name_(std::move(player_name)), player_unique_id_(player_unique_id),
+          message_(std::move(message)), recipients_(std::move(recipients))
+    {
+    }
+    ~AsyncPlayerChatEvent() override = default;
+
+    inline static const std::string NAME = "AsyncPlayerChatEvent";
+    [[nodiscard]] std::string getEventName() const override
+    {
+        return NAME;
+    }
+
+    /**
+     * Gets the name of the player who sent the message.
+     *
+     * @return the name of the sender
+     */
+    [[nodiscard]] const std::string &getPlayerName() const
+    {
+        return player_name_;
+    }
+
+    /**
+     * Gets the unique ID of the player who sent the message.
+     *
+     * @return the unique ID of the sender
+     */
+    [[nodiscard]] const UUID &getPlayerUniqueId() const
+    {
+        return player_unique_id_;
+    }
+
+    /**
+     * Gets the message that the player is attempting to send.
+     *
+     * @return Message the player is attempting to send
+     */
+    [[nodiscard]] const std::string &getMessage() const
+    {
+        return message_;
+    }
+
+    /**
+     * Sets the message that the player will send.
+     *
+     * @param message New message that the player will send
+     */
+    void setMessage(std::string message)
+    {
+        message_ = std::move(message);
+    }
+
+    /**
+     * Gets the unique IDs of the players who will receive the message.
+     *
+     * @return the unique IDs of the recipients
+     */
+    [[nodiscard]] const std::vector<UUID> &getRecipients() const
+    {
+        return recipients_;
+    }
+
+    /**
+     * Sets the players who will receive the message. Players who are offline by the time the message is delivered
+     * are skipped.
+     *
+     * @param recipients the unique IDs of the recipients
+     */
+    void setRecipients(std::vector<UUID> recipients)
+    {
+        recipients_ = std::move(recipients);
+    }
+
+private:
+    std::string player_name_;
+    UUID player_unique_id_;
+    std::string message_;
+    std::vector<UUID> recipients_;
+};
+
+}  // namespace endstone
@@ -0,0 +1,121 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "endstone/event/cancellable.h"
+#include "endstone/event/event.h"
+#include "endstone/util/socket_address.h"
+#include "endstone/util/uuid.h"
+
+namespace endstone {
+
+/**
+ * @brief Called on a worker thread when a player attempts to log in, before PlayerLoginEvent.
+ *
+ * The login of the player is held until all handlers have returned, so handlers can take their time, e.g. to query
+ * a database, without stalling the server. The outcome is applied by the server thread. If the handlers do not return
+ * in time, the player is disconnected.
+ *
+ * @remark The player object is not available from this event; handlers should never access any Endstone API.
+ */
+class AsyncPlayerPreLoginEvent : public Cancellable<Event> {
+public:
+    AsyncPlayerPreLoginEvent(std::string name, UUID unique_id, std::string xuid, SocketAddress address,
+                             std::string message = "")
+        : Cancellable(true), name_(std::move(name)), unique_id_(unique_id), xuid_(std::move(xuid)),
+          address_(std::move(address)), message_(std::move(message))
+    {
+    }
+    ~AsyncPlayerPreLoginEvent() override = default;
+
+    inline static const std::string NAME = "AsyncPlayerPreLoginEvent";
+    [[nodiscard]] std::string getEventName() const override
+    {
+        return NAME;
+    }
+
+    /**
+     * Gets the player's name.
+     *
+     * @return the player's name
+     */
+    [[nodiscard]] const std::string &getName() const
+    {
+        return name_;
+    }
+
+    /**
+     * Gets the player's unique ID.
+     *
+     * @return the player's unique ID
+     */
+    [[nodiscard]] const UUID &getUniqueId() const
+    {
+        return unique_id_;
+    }
+
+    /**
+     * Gets the player's XUID.
+     *
+     * @return the player's XUID
+     */
+    [[nodiscard]] const std::string &getXuid() const
+    {
+        return xuid_;
+    }
+
+    /**
+     * Gets the socket address of the player.
+     *
+     * @return the player's address
+     */
+    [[nodiscard]] const SocketAddress &getAddress() const
+    {
+        return address_;
+    }
+
+    /**
+     * Gets the current kick message that will be used if event is cancelled
+     *
+     * @return Current kick message
+     */
+    [[nodiscard]] const std::string &getKickMessage() const
+    {
+        return message_;
+    }
+
+    /**
+     * Sets the kick message to display if event is cancelled
+     *
+     * @param message New kick message
+     */
+    void setKickMessage(const std::string &message)
+    {
+        message_ = message;
+    }
+
+private:
+    std::string name_;
+    UUID unique_id_;
+    std::string xuid_;
+    SocketAddress address_;
+    std::string message_;
+};
+
+}  // namespace endstone
@@ -0,0 +1,78 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "endstone/event/cancellable.h"
+#include "endstone/event/player/player_event.h"
+#include "endstone/event/player/player_move_threshold.h"
+#include "endstone/level/location.h"
+
+namespace endstone {
+
+/**
+ * @brief Called when a player moves past the threshold declared by a handler.
+ *
+ * Each handler is only called once the player has moved past its threshold since the last time it was called for
+ * that player. Handlers registered without a threshold are called whenever the player moves or looks around.
+ * If the event is cancelled, the player is moved back to where they were.
+ */
+class PlayerMoveEvent : public Cancellable<PlayerEvent> {
+public:
+    explicit PlayerMoveEvent(Player &player, Location from, Location to) : Cancellable(player), from_(from), to_(to) {}
+    ~PlayerMoveEvent() override = default;
+
+    inline static const std::string NAME = "PlayerMoveEvent";
+    [[nodiscard]] std::string getEventName() const override
+    {
+        return NAME;
+    }
+
+    /**
+     * @brief Gets the location that this player moved from, i.e. where the player was the last time the current
+     * handler was called
+     *
+     * @return Location this player moved from
+     */
+    [[nodiscard]] const Location &getFrom() const
+    {
+        return from_;
+    }
+
+    /**
+     * @brief Sets the location that this player moved from
+     *
+     * @param from New location this player moved from
+     */
+    void setFrom(const Location &from)
+    {
+        from_ = from;
+    }
+
+    /**
+     * @brief Gets the location that this player moved to
+     *
+     * @return Location this player moved to
+     */
+    [[nodiscard]] const Location &getTo() const
+    {
+        return to_;
+    }
+
+private:
+    Location from_;
+    Location to_;
+};
+
+}  // namespace endstone
@@ -0,0 +1,50 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace endstone {
+
+/**
+ * @brief Declares how far a player must move before a handler of PlayerMoveEvent is called.
+ *
+ * The handler is called as soon as any of the enabled criteria is met, measured from where the player was the last
+ * time the handler was called for that player. When no criterion is enabled, any change in position or rotation
+ * counts. Changing dimension always counts.
+ */
+struct PlayerMoveThreshold {
+    /**
+     * The minimum distance moved, in blocks, or 0 to disable.
+     */
+    double distance{0.0};
+
+    /**
+     * The minimum change in pitch or yaw, in degrees, or 0 to disable.
+     */
+    float rotation{0.0F};
+
+    /**
+     * Whether entering another block counts.
+     */
+    bool block{false};
+
+    /**
+     * Whether entering another chunk counts.
+     */
+    bool chunk{false};
+
+    bool operator==(const PlayerMoveThreshold &other) const = default;
+};
+
+}  // namespace endstone
@@ -0,0 +1,66 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "endstone/event/cancellable.h"
+#include "endstone/event/player/player_event.h"
+
+namespace endstone {
+
+/**
+ * @brief Called when the view distance hint sent to a player is about to change.
+ *
+ * Cancelling this event keeps the view distance last sent to the player.
+ */
+class PlayerViewDistanceChangeEvent : public Cancellable<PlayerEvent> {
+public:
+    explicit PlayerViewDistanceChangeEvent(Player &player, int old_view_distance, int new_view_distance)
+        : Cancellable(player), old_view_distance_(old_view_distance), new_view_distance_(new_view_distance)
+    {
+    }
+    ~PlayerViewDistanceChangeEvent() override = default;
+
+    inline static const std::string NAME = "PlayerViewDistanceChangeEvent";
+    [[nodiscard]] std::string getEventName() const override
+    {
+        return NAME;
+    }
+
+    /**
+     * @brief Gets the view distance of the player before the change.
+     *
+     * @return The old view distance in chunks
+     */
+    [[nodiscard]] int getOldViewDistance() const
+    {
+        return old_view_distance_;
+    }
+
+    /**
+     * @brief Gets the view distance the player is changed to.
+     *
+     * @return The new view distance in chunks
+     */
+    [[nodiscard]] int getNewViewDistance() const
+    {
+        return new_view_distance_;
+    }
+
+private:
+    int old_view_distance_;
+    int new_view_distance_;
+};
+
+}  // namespace endstone
@@ -0,0 +1,49 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "endstone/form/action_form.h"
+#include "endstone/form/message_form.h"
+#include "endstone/form/modal_form.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents a form that is serialized once and then sent to any number of players.
+ *
+ * Text in the form may contain placeholders such as `{coins}`, which are filled in with the values passed to
+ * Player::sendForm. Placeholders without a value are sent as they are. Changes made to the form after the template
+ * was created are not picked up.
+ */
+class FormTemplate {
+public:
+    using FormVariant = std::variant<MessageForm, ActionForm, ModalForm>;
+
+    virtual ~FormTemplate() = default;
+
+    /**
+     * @brief Gets the names of the placeholders in the form, in the order they first appear.
+     *
+     * @return The names of the placeholders, without the braces.
+     */
+    [[nodiscard]] virtual std::vector<std::string> getPlaceholders() const = 0;
+};
+
+}  // namespace endstone
@@ -14,10 +14,14 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "endstone/inventory/item_stack.h"
+#include "endstone/inventory/item_stack_view.h"
+#include "endstone/util/result.h"
 
 namespace endstone {
 /**
@@ -71,6 +75,36 @@ public:
      */
     [[nodiscard]] virtual std::vector<std::shared_ptr<ItemStack>> getContents() const = 0;
 
+    /**
+     * @brief Reads views of all slots of the inventory into the given vector, one per slot, with empty slots included.
+     *
+     * Reusing the same vector between calls avoids allocating.
+     *
+     * @param contents The vector to fill. Its previous contents are replaced.
+     */
+    virtual void getContents(std::vector<ItemStackView> &contents) const = 0;
+
+    /**
+     * @brief Completely replaces the inventory's contents. Slots past the end of the given views are cleared.
+     *
+     * Nothing is changed if the contents do not fit in the inventory, contain an unknown item type, or an amount above
+     * the max stack size of its item.
+     *
+     * @param contents The views of the new contents, in slot order.
+     * @return An error if the contents could not be set.
+     */
+    virtual Result<void> setContents(std::span<const ItemStackView> contents) = 0;
+
+    /**
+     * @brief Runs several changes to the inventory as one update.
+     *
+     * For player inventories, the changes made inside the callback are sent to the player once, after it returns,
+     * instead of once per change.
+     *
+     * @param callback The function that changes the inventory
+     */
+    virtual void batchUpdate(const std::function<void(Inventory &)> &callback) = 0;
+
     /**
      * @brief Returns the first slot in the inventory containing an ItemStack with the given stack.
      *
@@ -0,0 +1,57 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <string_view>
+
+namespace endstone {
+
+/**
+ * @brief A lightweight view of the type and amount of the items in an inventory slot.
+ *
+ * Unlike ItemStack, a view is a plain value that can be read and written in bulk without allocating. See
+ * Inventory::getContents(std::vector<ItemStackView> &) and Inventory::setContents.
+ */
+struct ItemStackView {
+    /**
+     * @brief The type of the items. Views read from an inventory point to the name held by the item registry and stay
+     * valid for the lifetime of the server.
+     */
+    std::string_view type = "minecraft:air";
+
+    /**
+     * @brief The amount of items.
+     */
+    int amount = 0;
+
+    /**
+     * @brief The slot this view was read from, or -1. When set and the slot still holds items of the same type,
+     * Inventory::setContents keeps the rest of that stack's data, such as its enchantments and custom name.
+     */
+    int slot = -1;
+
+    /**
+     * @brief Checks whether this view represents an empty slot.
+     *
+     * @return true if empty, false otherwise
+     */
+    [[nodiscard]] bool isEmpty() const
+    {
+        return amount <= 0 || type.empty() || type == "minecraft:air";
+    }
+};
+
+}  // namespace endstone
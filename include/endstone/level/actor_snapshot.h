@@ -0,0 +1,245 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace endstone {
+
+class Dimension;
+
+/**
+ * @brief Represents a structure-of-arrays snapshot of the actors in a level.
+ *
+ * Each requested field is stored in its own contiguous array, with the i-th element of every array describing the
+ * same actor. Vector fields are stored flattened, i.e. positions and velocities hold 3 floats per actor (x, y, z) and
+ * rotations hold 2 floats per actor (pitch, yaw).
+ *
+ * A snapshot keeps its capacity between fills, so it can be reused every tick without reallocation.
+ */
+class ActorSnapshot {
+public:
+    using Fields = std::uint32_t;
+    static constexpr Fields RuntimeIds = 1U << 0;
+    static constexpr Fields Positions = 1U << 1;
+    static constexpr Fields Velocities = 1U << 2;
+    static constexpr Fields Rotations = 1U << 3;
+    static constexpr Fields DimensionIds = 1U << 4;
+    static constexpr Fields Flags = 1U << 5;
+    static constexpr Fields AllFields = RuntimeIds | Positions | Velocities | Rotations | DimensionIds | Flags;
+
+    using Flag = std::uint8_t;
+    static constexpr Flag OnGround = 1U << 0;
+    static constexpr Flag InWater = 1U << 1;
+    static constexpr Flag InLava = 1U << 2;
+    static constexpr Flag Dead = 1U << 3;
+    static constexpr Flag IsPlayer = 1U << 4;
+
+    /**
+     * @brief Represents the criteria an actor must meet to be included in a snapshot.
+     */
+    struct Filter {
+        /**
+         * @brief Only include actors in this dimension, or any dimension if nullptr.
+         */
+        Dimension *dimension = nullptr;
+
+        /**
+         * @brief Only include actors of this type (e.g. minecraft:zombie), or any type if empty.
+         */
+        std::string type;
+
+        /**
+         * @brief Only include players.
+         */
+        bool players_only = false;
+    };
+
+    /**
+     * @brief Clears all arrays while keeping their capacity, and selects the fields to be captured.
+     *
+     * @param fields The fields to capture
+     */
+    void reset(Fields fields)
+    {
+        fields_ = fields;
+        size_ = 0;
+        runtime_ids_.clear();
+        positions_.clear();
+        velocities_.clear();
+        rotations_.clear();
+        dimension_ids_.clear();
+        flags_.clear();
+    }
+
+    /**
+     * @brief Reserves capacity for the given number of actors in every captured field.
+     *
+     * @param count The number of actors
+     */
+    void reserve(std::size_t count)
+    {
+        if (has(RuntimeIds)) {
+            runtime_ids_.reserve(count);
+        }
+        if (has(Positions)) {
+            positions_.reserve(count * 3);
+        }
+        if (has(Velocities)) {
+            velocities_.reserve(count * 3);
+        }
+        if (has(Rotations)) {
+            rotations_.reserve(count * 2);
+        }
+        if (has(DimensionIds)) {
+            dimension_ids_.reserve(count);
+        }
+        if (has(Flags)) {
+            flags_.reserve(count);
+        }
+    }
+
+    /**
+     * @brief Appends an actor to the snapshot. Values of fields that are not captured are ignored.
+     */
+    void add(std::uint64_t runtime_id, const float (&position)[3], const float (&velocity)[3],
+             const float (&rotation)[2], std::int32_t dimension_id, Flag flags)
+    {
+        if (has(RuntimeIds)) {
+            runtime_ids_.push_back(runtime_id);
+        }
+        if (has(Positions)) {
+            positions_.insert(positions_.end(), position, position + 3);
+        }
+        if (has(Velocities)) {
+            velocities_.insert(velocities_.end(), velocity, velocity + 3);
+        }
+        if (has(Rotations)) {
+            rotations_.insert(rotations_.end(), rotation, rotation + 2);
+        }
+        if (has(DimensionIds)) {
+            dimension_ids_.push_back(dimension_id);
+        }
+        if (has(Flags)) {
+            flags_.push_back(flags);
+        }
+        ++size_;
+    }
+
+    /**
+     * @brief Gets the number of actors in this snapshot.
+     *
+     * @return Number of actors
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return size_;
+    }
+
+    /**
+     * @brief Gets the fields captured by this snapshot.
+     *
+     * @return Captured fields
+     */
+    [[nodiscard]] Fields getFields() const
+    {
+        return fields_;
+    }
+
+    /**
+     * @brief Checks if the given fields are captured by this snapshot.
+     *
+     * @param fields The fields to check
+     * @return true if all the given fields are captured
+     */
+    [[nodiscard]] bool has(Fields fields) const
+    {
+        return (fields_ & fields) == fields;
+    }
+
+    /**
+     * @brief Gets the runtime ids of the actors.
+     *
+     * @return Runtime ids, one per actor
+     */
+    [[nodiscard]] const std::vector<std::uint64_t> &getRuntimeIds() const
+    {
+        return runtime_ids_;
+    }
+
+    /**
+     * @brief Gets the feet positions of the actors.
+     *
+     * @return Positions, three floats (x, y, z) per actor
+     */
+    [[nodiscard]] const std::vector<float> &getPositions() const
+    {
+        return positions_;
+    }
+
+    /**
+     * @brief Gets the velocities of the actors.
+     *
+     * @return Velocities, three floats (x, y, z) per actor
+     */
+    [[nodiscard]] const std::vector<float> &getVelocities() const
+    {
+        return velocities_;
+    }
+
+    /**
+     * @brief Gets the rotations of the actors, measured in degrees.
+     *
+     * @return Rotations, two floats (pitch, yaw) per actor
+     */
+    [[nodiscard]] const std::vector<float> &getRotations() const
+    {
+        return rotations_;
+    }
+
+    /**
+     * @brief Gets the runtime ids of the dimensions the actors reside in.
+     *
+     * @return Dimension ids, one per actor
+     */
+    [[nodiscard]] const std::vector<std::int32_t> &getDimensionIds() const
+    {
+        return dimension_ids_;
+    }
+
+    /**
+     * @brief Gets the state flags of the actors.
+     *
+     * @return Flags, one bitmask per actor
+     */
+    [[nodiscard]] const std::vector<Flag> &getFlags() const
+    {
+        return flags_;
+    }
+
+private:
+    Fields fields_ = AllFields;
+    std::size_t size_ = 0;
+    std::vector<std::uint64_t> runtime_ids_;
+    std::vector<float> positions_;
+    std::vector<float> velocities_;
+    std::vector<float> rotations_;
+    std::vector<std::int32_t> dimension_ids_;
+    std::vector<Flag> flags_;
+};
+
+}  // namespace endstone
@@ -14,7 +14,11 @@
 
 #pragma once
 
+#include <memory>
+
 #include "endstone/actor/actor.h"
+#include "endstone/level/chunk_snapshot.h"
+#include "endstone/util/result.h"
 
 namespace endstone {
 
@@ -52,6 +56,15 @@ public:
      * @return Parent Dimension
      */
     [[nodiscard]] virtual Dimension &getDimension() const = 0;
+
+    /**
+     * @brief Captures an immutable snapshot of the blocks in this chunk.
+     *
+     * This must be called from the server thread. The returned snapshot can then be read from any thread.
+     *
+     * @return The chunk snapshot, or an error if the chunk is no longer loaded
+     */
+    [[nodiscard]] virtual Result<std::shared_ptr<ChunkSnapshot>> getSnapshot() const = 0;
 };
 
 }  // namespace endstone
@@ -0,0 +1,179 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "endstone/block/block_data.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents an immutable copy of the blocks in a chunk.
+ *
+ * A snapshot is taken on the server thread and does not reference any live world state afterwards, so it can be
+ * shared with and read from any thread, e.g. from asynchronous tasks.
+ *
+ * Blocks are stored as indices into a palette of the distinct block data found in the chunk. All coordinates are
+ * relative to the chunk, i.e. x and z are in the range [0, 15] and y is in the range [min height, max height). The
+ * accessors do not check their coordinates, use contains() first if they may be out of range.
+ */
+class ChunkSnapshot {
+public:
+    static constexpr int Width = 16;
+
+    ChunkSnapshot(int x, int z, int min_height, int max_height, std::vector<std::shared_ptr<BlockData>> palette,
+                  std::vector<std::uint16_t> blocks, std::vector<std::int16_t> heightmap)
+        : x_(x), z_(z), min_height_(min_height), max_height_(max_height), palette_(std::move(palette)),
+          blocks_(std::move(blocks)), heightmap_(std::move(heightmap))
+    {
+    }
+
+    /**
+     * @brief Gets the X-coordinate of the chunk this snapshot was taken from
+     *
+     * @return X-coordinate
+     */
+    [[nodiscard]] int getX() const
+    {
+        return x_;
+    }
+
+    /**
+     * @brief Gets the Z-coordinate of the chunk this snapshot was taken from
+     *
+     * @return Z-coordinate
+     */
+    [[nodiscard]] int getZ() const
+    {
+        return z_;
+    }
+
+    /**
+     * @brief Gets the minimum height (inclusive) covered by this snapshot
+     *
+     * @return Minimum height
+     */
+    [[nodiscard]] int getMinHeight() const
+    {
+        return min_height_;
+    }
+
+    /**
+     * @brief Gets the maximum height (exclusive) covered by this snapshot
+     *
+     * @return Maximum height
+     */
+    [[nodiscard]] int getMaxHeight() const
+    {
+        return max_height_;
+    }
+
+    /**
+     * @brief Gets the distinct block data found in the chunk
+     *
+     * @return Block palette
+     */
+    [[nodiscard]] const std::vector<std::shared_ptr<BlockData>> &getPalette() const
+    {
+        return palette_;
+    }
+
+    /**
+     * @brief Gets the palette indices of all blocks, ordered by y, then z, then x.
+     *
+     * @return Palette indices, one per block
+     */
+    [[nodiscard]] const std::vector<std::uint16_t> &getBlocks() const
+    {
+        return blocks_;
+    }
+
+    /**
+     * @brief Gets the highest non-air block of each column, ordered by z, then x.
+     *
+     * @return Y-coordinates, or min height - 1 for empty columns
+     */
+    [[nodiscard]] const std::vector<std::int16_t> &getHeightmap() const
+    {
+        return heightmap_;
+    }
+
+    /**
+     * @brief Gets the palette index of the block at the given coordinates
+     *
+     * @param x X-coordinate, relative to the chunk
+     * @param y Y-coordinate
+     * @param z Z-coordinate, relative to the chunk
+     * @return Palette index
+     */
+    [[nodiscard]] std::uint16_t getPaletteIndex(int x, int y, int z) const
+    {
+        return blocks_[((y - min_height_) * Width + z) * Width + x];
+    }
+
+    /**
+     * @brief Gets the block data of the block at the given coordinates
+     *
+     * @param x X-coordinate, relative to the chunk
+     * @param y Y-coordinate
+     * @param z Z-coordinate, relative to the chunk
+     * @return Block data
+     */
+    [[nodiscard]] std::shared_ptr<BlockData> getBlockData(int x, int y, int z) const
+    {
+        return palette_[getPaletteIndex(x, y, z)];
+    }
+
+    /**
+     * @brief Gets the y-coordinate of the highest non-air block at the given coordinates
+     *
+     * @param x X-coordinate, relative to the chunk
+     * @param z Z-coordinate, relative to the chunk
+     * @return Y-coordinate, or min height - 1 if the column is empty
+     */
+    [[nodiscard]] int getHighestBlockYAt(int x, int z) const
+    {
+        return heightmap_[z * Width + x];
+    }
+
+    /**
+     * @brief Checks if the given coordinates are within this snapshot
+     *
+     * @param x X-coordinate, relative to the chunk
+     * @param y Y-coordinate
+     * @param z Z-coordinate, relative to the chunk
+     * @return true if the coordinates are within this snapshot
+     */
+    [[nodiscard]] bool contains(int x, int y, int z) const
+    {
+        return x >= 0 && x < Width && z >= 0 && z < Width && y >= min_height_ && y < max_height_;
+    }
+
+private:
+    int x_;
+    int z_;
+    int min_height_;
+    int max_height_;
+    std::vector<std::shared_ptr<BlockData>> palette_;
+    std::vector<std::uint16_t> blocks_;
+    std::vector<std::int16_t> heightmap_;
+};
+
+}  // namespace endstone
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "endstone/block/block.h"
 #include "endstone/level/chunk.h"
 #include "endstone/util/result.h"
@@ -109,5 +111,21 @@ public:
      * @return All loaded chunks
      */
     [[nodiscard]] virtual std::vector<std::unique_ptr<Chunk>> getLoadedChunks() = 0;
+
+    /**
+     * @brief Visits all loaded Chunks without allocating a list.
+     *
+     * The chunk passed to the visitor is only valid for the duration of the call.
+     *
+     * @param visitor The function to call for each loaded chunk
+     */
+    virtual void forEachLoadedChunk(const std::function<void(Chunk &)> &visitor) = 0;
+
+    /**
+     * @brief Gets the number of loaded Chunks.
+     *
+     * @return Number of loaded chunks
+     */
+    [[nodiscard]] virtual int getLoadedChunkCount() const = 0;
 };
 }  // namespace endstone
@@ -18,6 +18,8 @@
 #include <string>
 
 #include "endstone/actor/actor.h"
+#include "endstone/level/actor_snapshot.h"
+#include "endstone/util/result.h"
 
 namespace endstone {
 
@@ -42,6 +44,83 @@ public:
      */
     [[nodiscard]] virtual std::vector<Actor *> getActors() const = 0;
 
+    /**
+     * @brief Captures the state of all actors in this level into a structure-of-arrays snapshot.
+     *
+     * The snapshot is filled in a single pass without creating actor wrappers. Passing the same snapshot every tick
+     * reuses its storage, so no allocation happens once its capacity is large enough.
+     *
+     * @param snapshot The snapshot to fill, any previous content will be discarded
+     * @param fields The fields to capture
+     * @param filter The criteria an actor must meet to be captured
+     */
+    virtual void snapshotActors(ActorSnapshot &snapshot, ActorSnapshot::Fields fields = ActorSnapshot::AllFields,
+                                const ActorSnapshot::Filter &filter = {}) const = 0;
+
+    /**
+     * @brief Gets the radius within which dropped items are merged into a single stack.
+     *
+     * @return The item merge radius in blocks, or 0 if items are not merged
+     */
+    [[nodiscard]] virtual float getItemMergeRadius() const = 0;
+
+    /**
+     * @brief Sets the radius within which dropped items are merged into a single stack.
+     *
+     * Only items of the same type and data are merged, and only as long as the result fits into a single stack.
+     *
+     * @param radius The item merge radius in blocks, between 0 and 16, or 0 to disable merging
+     * @return A Result indicating success or failure
+     */
+    virtual Result<void> setItemMergeRadius(float radius) = 0;
+
+    /**
+     * @brief Gets the radius within which experience orbs are merged into a single orb.
+     *
+     * @return The experience merge radius in blocks, or 0 if experience orbs are not merged
+     */
+    [[nodiscard]] virtual float getExperienceMergeRadius() const = 0;
+
+    /**
+     * @brief Sets the radius within which experience orbs are merged into a single orb.
+     *
+     * @param radius The experience merge radius in blocks, between 0 and 16, or 0 to disable merging
+     * @return A Result indicating success or failure
+     */
+    virtual Result<void> setExperienceMergeRadius(float radius) = 0;
+
+    /**
+     * @brief Gets the interval, in ticks, between two merge passes.
+     *
+     * @return The merge interval
+     */
+    [[nodiscard]] virtual int getMergeInterval() const = 0;
+
+    /**
+     * @brief Sets the interval, in ticks, between two merge passes.
+     *
+     * @param interval The merge interval, must be at least 1
+     * @return A Result indicating success or failure
+     */
+    virtual Result<void> setMergeInterval(int interval) = 0;
+
+    /**
+     * @brief Gets the maximum number of actors a merge pass may examine per tick.
+     *
+     * @return The merge budget
+     */
+    [[nodiscard]] virtual int getMergeBudget() const = 0;
+
+    /**
+     * @brief Sets the maximum number of actors a merge pass may examine per tick.
+     *
+     * A pass that exceeds the budget is continued on the following ticks.
+     *
+     * @param budget The merge budget, must be at least 1
+     * @return A Result indicating success or failure
+     */
+    virtual Result<void> setMergeBudget(int budget) = 0;
+
     /**
      * @brief Gets the relative in-game time of this level.
      *
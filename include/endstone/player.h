@@ -15,10 +15,12 @@
 #pragma once
 
 #include <chrono>
+#include <unordered_map>
 #include <variant>
 
 #include "endstone/actor/mob.h"
 #include "endstone/form/action_form.h"
+#include "endstone/form/form_template.h"
 #include "endstone/form/message_form.h"
 #include "endstone/form/modal_form.h"
 #include "endstone/game_mode.h"
@@ -26,6 +28,7 @@
 #include "endstone/network/spawn_particle_effect_packet.h"
 #include "endstone/offline_player.h"
 #include "endstone/scoreboard/scoreboard.h"
+#include "endstone/scoreboard/virtual_scoreboard.h"
 #include "endstone/skin.h"
 #include "endstone/util/socket_address.h"
 #include "endstone/util/uuid.h"
@@ -272,6 +275,13 @@ public:
      */
     void virtual setScoreboard(Scoreboard &scoreboard) = 0;
 
+    /**
+     * @brief Gets the VirtualScoreboard of this player, whose displays are only shown to this player.
+     *
+     * @return the VirtualScoreboard of this player
+     */
+    [[nodiscard]] virtual VirtualScoreboard &getVirtualScoreboard() const = 0;
+
     /**
      * @brief Sends this player a popup message
      *
@@ -377,6 +387,13 @@ public:
      */
     [[nodiscard]] virtual std::string getLocale() const = 0;
 
+    /**
+     * @brief Gets the view distance last sent to the player, including any reduction hinted under heavy load.
+     *
+     * @return the player's view distance in chunks
+     */
+    [[nodiscard]] virtual int getViewDistance() const = 0;
+
     /**
      * @brief Send the list of commands to the client.
      *
@@ -441,6 +458,21 @@ public:
      */
     virtual void sendForm(FormVariant form) = 0;
 
+    /**
+     * @brief Sends a form template to the player.
+     *
+     * @param form The form template to send
+     */
+    virtual void sendForm(const FormTemplate &form) = 0;
+
+    /**
+     * @brief Sends a form template to the player, filling in its placeholders.
+     *
+     * @param form The form template to send
+     * @param values The values of the placeholders, keyed by their names
+     */
+    virtual void sendForm(const FormTemplate &form, const std::unordered_map<std::string, std::string> &values) = 0;
+
     /**
      * @brief Closes the forms that are currently open for the player.
      */
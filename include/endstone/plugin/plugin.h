@@ -18,17 +18,20 @@
 #include <filesystem>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "endstone/command/command_executor.h"
+#include "endstone/event/player/player_move_threshold.h"
 #include "endstone/logger.h"
 #include "endstone/permissions/permission.h"
 #include "endstone/plugin/plugin_description.h"
 #include "endstone/server.h"
 
 namespace endstone {
+class PlayerMoveEvent;
 class PluginCommand;
 class PluginLoader;
 namespace core {
@@ -174,6 +177,31 @@ public:
         }
     }
 
+    template <typename EventType, typename T>
+    void registerEvent(void (T::*func)(EventType &), T &instance, PlayerMoveThreshold threshold,
+                       EventPriority priority = EventPriority::Normal, bool ignore_cancelled = false)
+    {
+        static_assert(std::is_same_v<EventType, PlayerMoveEvent>, "Thresholds only apply to PlayerMoveEvent");
+        auto result = getServer().getPluginManager().registerMoveEvent(
+            [func, &instance](Event &e) { (instance.*func)(static_cast<EventType &>(e)); }, threshold, priority,
+            *this, ignore_cancelled);
+        if (!result) {
+            server_->getLogger().error(result.error());
+        }
+    }
+
+    template <typename EventType>
+    void registerEvent(std::function<void(EventType &)> func, PlayerMoveThreshold threshold,
+                       EventPriority priority = EventPriority::Normal, bool ignore_cancelled = false)
+    {
+        static_assert(std::is_same_v<EventType, PlayerMoveEvent>, "Thresholds only apply to PlayerMoveEvent");
+        auto result = getServer().getPluginManager().registerMoveEvent(
+            [func](Event &e) { func(static_cast<EventType &>(e)); }, threshold, priority, *this, ignore_cancelled);
+        if (!result) {
+            server_->getLogger().error(result.error());
+        }
+    }
+
 protected:
     friend class PluginLoader;
     friend class core::EndstonePluginManager;
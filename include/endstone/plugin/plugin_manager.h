@@ -21,6 +21,7 @@
 
 #include "endstone/event/event.h"
 #include "endstone/event/event_priority.h"
+#include "endstone/event/player/player_move_threshold.h"
 
 namespace endstone {
 
@@ -156,6 +157,20 @@ public:
     virtual Result<void> registerEvent(std::string event, std::function<void(Event &)> executor, EventPriority priority,
                                        Plugin &plugin, bool ignore_cancelled) = 0;
 
+    /**
+     * Registers a handler of PlayerMoveEvent that is only called once a player has moved past the given threshold
+     * since the last time the handler was called for that player.
+     *
+     * @param executor EventExecutor to register
+     * @param threshold How far a player must move before the executor is called
+     * @param priority Priority of this event
+     * @param plugin Plugin to register
+     * @param ignore_cancelled Do not call executor if event was already
+     *     cancelled
+     */
+    virtual Result<void> registerMoveEvent(std::function<void(Event &)> executor, PlayerMoveThreshold threshold,
+                                           EventPriority priority, Plugin &plugin, bool ignore_cancelled) = 0;
+
     /**
      * Gets a Permission from its fully qualified name
      *
@@ -0,0 +1,359 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace endstone {
+
+class Plugin;
+class Scheduler;
+
+template <typename T = void>
+class Coroutine;
+
+namespace detail {
+
+/**
+ * @brief Shared by all coroutines started from the same call to Scheduler::runCoroutine.
+ */
+struct CoroutineContext {
+    Scheduler *scheduler = nullptr;
+    Plugin *plugin = nullptr;
+    std::coroutine_handle<> root;
+};
+
+/**
+ * @brief Thread-local free lists of coroutine frames, bucketed by size.
+ *
+ * Frames are allocated and freed on every call to a coroutine, so they are recycled instead of going through the
+ * global allocator each time. Frames larger than the largest bucket are not pooled.
+ */
+class CoroutineFramePool {
+public:
+    static constexpr std::size_t Granularity = 64;
+    static constexpr std::size_t NumBuckets = 32;
+    static constexpr std::size_t MaxFramesPerBucket = 64;
+
+    static void *allocate(std::size_t size)
+    {
+        auto index = (size + Granularity - 1) / Granularity;
+        if (index >= NumBuckets) {
+            return ::operator new(size);
+        }
+
+        auto &bucket = buckets()[index];
+        if (auto *frame = bucket.head) {
+            bucket.head = frame->next;
+            --bucket.size;
+            return frame;
+        }
+        return ::operator new(index * Granularity);
+    }
+
+    static void deallocate(void *ptr, std::size_t size) noexcept
+    {
+        auto index = (size + Granularity - 1) / Granularity;
+        if (index >= NumBuckets) {
+            ::operator delete(ptr);
+            return;
+        }
+
+        auto &bucket = buckets()[index];
+        if (bucket.size >= MaxFramesPerBucket) {
+            ::operator delete(ptr);
+            return;
+        }
+        bucket.head = ::new (ptr) Frame{bucket.head};
+        ++bucket.size;
+    }
+
+private:
+    struct Frame {
+        Frame *next;
+    };
+
+    struct Bucket {
+        Frame *head = nullptr;
+        std::size_t size = 0;
+
+        ~Bucket()
+        {
+            while (head) {
+                auto *next = head->next;
+                ::operator delete(head);
+                head = next;
+            }
+        }
+    };
+
+    static Bucket *buckets() noexcept
+    {
+        thread_local Bucket buckets[NumBuckets];
+        return buckets;
+    }
+};
+
+template <typename Promise>
+void reportUnhandledException(Promise &promise) noexcept;  // defined in scheduler.h
+
+class CoroutineFinalAwaiter {
+public:
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+    {
+        auto &promise = handle.promise();
+        if (promise.continuation) {
+            return promise.continuation;
+        }
+        if (promise.detached) {
+            // nobody awaits a coroutine started by the scheduler, so it owns its own frame
+            if (promise.exception) {
+                reportUnhandledException(promise);
+            }
+            handle.destroy();
+        }
+        return std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept {}
+};
+
+class CoroutinePromiseBase {
+public:
+    static void *operator new(std::size_t size)
+    {
+        return CoroutineFramePool::allocate(size);
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept
+    {
+        CoroutineFramePool::deallocate(ptr, size);
+    }
+
+    std::suspend_always initial_suspend() noexcept
+    {
+        return {};
+    }
+
+    auto final_suspend() noexcept;
+
+    void unhandled_exception() noexcept
+    {
+        exception = std::current_exception();
+    }
+
+    CoroutineContext *context = nullptr;
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+    CoroutineContext root_context;
+    bool detached = false;
+};
+
+inline auto CoroutinePromiseBase::final_suspend() noexcept
+{
+    return CoroutineFinalAwaiter{};
+}
+
+template <typename T>
+class CoroutinePromise : public CoroutinePromiseBase {
+public:
+    Coroutine<T> get_return_object() noexcept;
+
+    template <typename U>
+    void return_value(U &&value)
+    {
+        result.emplace(std::forward<U>(value));
+    }
+
+    T take()
+    {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        return std::move(*result);
+    }
+
+    std::optional<T> result;
+};
+
+template <>
+class CoroutinePromise<void> : public CoroutinePromiseBase {
+public:
+    Coroutine<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    void take() const
+    {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+};
+
+/**
+ * @brief Suspends a coroutine and hands it over to the scheduler, which resumes it on the server thread after a
+ * number of ticks or on a worker thread.
+ */
+class ScheduleAwaiter {
+public:
+    ScheduleAwaiter(Scheduler &scheduler, std::uint64_t delay, bool async) noexcept
+        : scheduler_(scheduler), delay_(delay), async_(async)
+    {
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <typename Promise>
+    bool await_suspend(std::coroutine_handle<Promise> handle);  // defined in scheduler.h
+
+    void await_resume() const noexcept {}
+
+private:
+    Scheduler &scheduler_;
+    std::uint64_t delay_;
+    bool async_;
+};
+
+template <typename T>
+class CoroutineAwaiter {
+public:
+    explicit CoroutineAwaiter(std::coroutine_handle<CoroutinePromise<T>> handle) noexcept : handle_(handle) {}
+
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return !handle_ || handle_.done();
+    }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> caller) noexcept
+    {
+        // run in the context of the caller and continue the caller once done
+        handle_.promise().context = caller.promise().context;
+        handle_.promise().continuation = caller;
+        return handle_;
+    }
+
+    T await_resume()
+    {
+        return handle_.promise().take();
+    }
+
+private:
+    std::coroutine_handle<CoroutinePromise<T>> handle_;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Represents a lazily started coroutine that produces a value of type T.
+ *
+ * A coroutine does not run until it is either awaited by another coroutine, or started by Scheduler::runCoroutine.
+ * Inside a coroutine, the awaitables returned by the Scheduler (e.g. Scheduler::nextTick) can be used to wait for
+ * ticks or to move between the server thread and worker threads. When the plugin that started a coroutine is
+ * disabled, the coroutine is destroyed at its next suspension point instead of being resumed.
+ *
+ * @tparam T The type of the result
+ */
+template <typename T>
+class [[nodiscard]] Coroutine {
+public:
+    using promise_type = detail::CoroutinePromise<T>;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    Coroutine() noexcept = default;
+    explicit Coroutine(handle_type handle) noexcept : handle_(handle) {}
+    Coroutine(const Coroutine &) = delete;
+    Coroutine &operator=(const Coroutine &) = delete;
+    Coroutine(Coroutine &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    Coroutine &operator=(Coroutine &&other) noexcept
+    {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    ~Coroutine()
+    {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    /**
+     * @brief Checks if the coroutine has run to completion.
+     *
+     * @return true if the coroutine is done
+     */
+    [[nodiscard]] bool isDone() const noexcept
+    {
+        return !handle_ || handle_.done();
+    }
+
+    /**
+     * @brief Releases the ownership of the coroutine frame.
+     *
+     * @return The handle of the coroutine
+     */
+    handle_type release() noexcept
+    {
+        return std::exchange(handle_, nullptr);
+    }
+
+    auto operator co_await() && noexcept
+    {
+        return detail::CoroutineAwaiter<T>{handle_};
+    }
+
+private:
+    handle_type handle_;
+};
+
+namespace detail {
+
+template <typename T>
+Coroutine<T> CoroutinePromise<T>::get_return_object() noexcept
+{
+    return Coroutine<T>{std::coroutine_handle<CoroutinePromise<T>>::from_promise(*this)};
+}
+
+inline Coroutine<void> CoroutinePromise<void>::get_return_object() noexcept
+{
+    return Coroutine<void>{std::coroutine_handle<CoroutinePromise<void>>::from_promise(*this)};
+}
+
+}  // namespace detail
+
+}  // namespace endstone
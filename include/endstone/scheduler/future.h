@@ -0,0 +1,309 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace endstone {
+
+class Plugin;
+class Scheduler;
+
+template <typename T>
+class Future;
+
+namespace detail {
+
+template <typename T>
+using FutureValue = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+template <typename Func, typename T>
+struct ContinuationResult {
+    using type = std::invoke_result_t<Func, const T &>;
+};
+
+template <typename Func>
+struct ContinuationResult<Func, void> {
+    using type = std::invoke_result_t<Func>;
+};
+
+/**
+ * @brief Holds the result of a Future and the continuations waiting for it.
+ */
+template <typename T>
+class FutureState {
+public:
+    FutureState(Scheduler &scheduler, Plugin &plugin) : scheduler_(scheduler), plugin_(plugin) {}
+
+    /**
+     * @brief Completes the state with the result of the given function, or the exception it throws.
+     */
+    template <typename Func>
+    void complete(Func &func)
+    {
+        try {
+            if constexpr (std::is_void_v<T>) {
+                func();
+                setValue(std::monostate{});
+            }
+            else {
+                setValue(func());
+            }
+        }
+        catch (...) {
+            setException(std::current_exception());
+        }
+    }
+
+    void setValue(FutureValue<T> value)
+    {
+        std::vector<std::function<void()>> callbacks;
+        {
+            std::lock_guard lock{mutex_};
+            if (done_) {
+                return;
+            }
+            value_.emplace(std::move(value));
+            done_ = true;
+            callbacks.swap(callbacks_);
+        }
+        cv_.notify_all();
+        for (auto &callback : callbacks) {
+            callback();
+        }
+    }
+
+    void setException(std::exception_ptr exception)
+    {
+        std::vector<std::function<void()>> callbacks;
+        {
+            std::lock_guard lock{mutex_};
+            if (done_) {
+                return;
+            }
+            exception_ = std::move(exception);
+            done_ = true;
+            callbacks.swap(callbacks_);
+        }
+        cv_.notify_all();
+        for (auto &callback : callbacks) {
+            callback();
+        }
+    }
+
+    /**
+     * @brief Runs the callback once the state is completed, right away if it already is.
+     */
+    void onComplete(std::function<void()> callback)
+    {
+        {
+            std::lock_guard lock{mutex_};
+            if (!done_) {
+                callbacks_.push_back(std::move(callback));
+                return;
+            }
+        }
+        callback();
+    }
+
+    [[nodiscard]] bool isDone() const
+    {
+        std::lock_guard lock{mutex_};
+        return done_;
+    }
+
+    void wait() const
+    {
+        std::unique_lock lock{mutex_};
+        cv_.wait(lock, [this]() { return done_; });
+    }
+
+    // Only valid once the state is completed
+    [[nodiscard]] const std::exception_ptr &getException() const
+    {
+        return exception_;
+    }
+
+    [[nodiscard]] const FutureValue<T> &getValue() const
+    {
+        return *value_;
+    }
+
+    [[nodiscard]] Scheduler &getScheduler() const
+    {
+        return scheduler_;
+    }
+
+    [[nodiscard]] Plugin &getPlugin() const
+    {
+        return plugin_;
+    }
+
+private:
+    Scheduler &scheduler_;
+    Plugin &plugin_;
+    mutable std::mutex mutex_;
+    mutable std::condition_variable cv_;
+    bool done_ = false;
+    std::optional<FutureValue<T>> value_;
+    std::exception_ptr exception_;
+    std::vector<std::function<void()>> callbacks_;
+};
+
+/**
+ * @brief Completes a FutureState with the result of a function. If it is destroyed before running, e.g. because the
+ * plugin was disabled, the future fails instead of never completing.
+ */
+template <typename T, typename Func>
+class FutureTask {
+public:
+    FutureTask(std::shared_ptr<FutureState<T>> state, Func func) : state_(std::move(state)), func_(std::move(func)) {}
+    FutureTask(const FutureTask &) = delete;
+    FutureTask &operator=(const FutureTask &) = delete;
+
+    ~FutureTask()
+    {
+        if (!state_->isDone()) {
+            state_->setException(
+                std::make_exception_ptr(std::runtime_error("Task was cancelled before it could complete")));
+        }
+    }
+
+    void operator()()
+    {
+        state_->complete(func_);
+    }
+
+private:
+    std::shared_ptr<FutureState<T>> state_;
+    Func func_;
+};
+
+template <typename T, typename Func>
+std::function<void()> makeFutureTask(std::shared_ptr<FutureState<T>> state, Func func)
+{
+    auto task = std::make_shared<FutureTask<T, Func>>(std::move(state), std::move(func));
+    return [task]() { (*task)(); };
+}
+
+}  // namespace detail
+
+/**
+ * @brief Represents the result of a computation that completes on another thread or on a later tick.
+ *
+ * Continuations added with then() run on the thread that completes the future, while continuations added with
+ * thenSync() run on the server thread. Waiting for a future never blocks unless get() or wait() is called.
+ *
+ * @tparam T The type of the result
+ */
+template <typename T>
+class Future {
+public:
+    explicit Future(std::shared_ptr<detail::FutureState<T>> state) : state_(std::move(state)) {}
+
+    /**
+     * @brief Checks if the result is available.
+     *
+     * @return true if the future has completed, either with a value or an exception
+     */
+    [[nodiscard]] bool isDone() const
+    {
+        return state_->isDone();
+    }
+
+    /**
+     * @brief Blocks until the future has completed.
+     * @remark Never wait on the server thread for a future completed by the server thread, as it would deadlock.
+     */
+    void wait() const
+    {
+        state_->wait();
+    }
+
+    /**
+     * @brief Blocks until the future has completed and returns its result.
+     * @remark Never wait on the server thread for a future completed by the server thread, as it would deadlock.
+     *
+     * @return The result, or rethrows the exception the future completed with
+     */
+    T get() const
+    {
+        state_->wait();
+        if (state_->getException()) {
+            std::rethrow_exception(state_->getException());
+        }
+        if constexpr (!std::is_void_v<T>) {
+            return state_->getValue();
+        }
+    }
+
+    /**
+     * @brief Chains a continuation that runs on the thread that completes this future.
+     *
+     * @param func the continuation, called with the result of this future
+     * @return a Future holding the result of the continuation
+     */
+    template <typename Func>
+    auto then(Func func) -> Future<typename detail::ContinuationResult<Func, T>::type>
+    {
+        using R = typename detail::ContinuationResult<Func, T>::type;
+        auto next = std::make_shared<detail::FutureState<R>>(state_->getScheduler(), state_->getPlugin());
+        state_->onComplete(continuation(next, std::move(func)));
+        return Future<R>{next};
+    }
+
+    /**
+     * @brief Chains a continuation that runs on the server thread once this future has completed.
+     *
+     * Continuations are run in a single batch on the next server tick after this future completes.
+     *
+     * @param func the continuation, called with the result of this future
+     * @return a Future holding the result of the continuation
+     */
+    template <typename Func>
+    auto thenSync(Func func) -> Future<typename detail::ContinuationResult<Func, T>::type>;  // defined in scheduler.h
+
+private:
+    template <typename R, typename Func>
+    std::function<void()> continuation(std::shared_ptr<detail::FutureState<R>> next, Func func) const
+    {
+        return detail::makeFutureTask(next, [state = state_, func = std::move(func)]() mutable -> R {
+            if (state->getException()) {
+                std::rethrow_exception(state->getException());
+            }
+            if constexpr (std::is_void_v<T>) {
+                return func();
+            }
+            else {
+                return func(state->getValue());
+            }
+        });
+    }
+
+    std::shared_ptr<detail::FutureState<T>> state_;
+};
+
+}  // namespace endstone
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include "endstone/scheduler/coroutine.h"
+#include "endstone/scheduler/future.h"
 #include "endstone/scheduler/task.h"
 
 namespace endstone {
@@ -133,6 +135,164 @@ public:
      * @return Pending tasks
      */
     virtual std::vector<Task *> getPendingTasks() = 0;
+
+    /**
+     * @brief Queues a callback to be run by the server thread on the next server tick.
+     *
+     * Unlike runTask, no Task is created: all callbacks queued between two ticks are run in a single batch, and the
+     * callbacks of a plugin are discarded once it is disabled.
+     *
+     * @param plugin the reference to the plugin queuing the callback
+     * @param callback the callback to be run
+     */
+    virtual void postSync(Plugin &plugin, std::function<void()> callback) = 0;
+
+    /**
+     * @brief Calls a function on the server thread on the next server tick and returns a Future of its result.
+     *
+     * @param plugin the reference to the plugin calling the function
+     * @param func the function to be called
+     * @return a Future holding the result of the function
+     */
+    template <typename Func>
+    auto callSync(Plugin &plugin, Func func) -> Future<std::invoke_result_t<Func>>
+    {
+        using R = std::invoke_result_t<Func>;
+        auto state = std::make_shared<detail::FutureState<R>>(*this, plugin);
+        postSync(plugin, detail::makeFutureTask(state, std::move(func)));
+        return Future<R>{state};
+    }
+
+    /**
+     * @brief Calls a function on a worker thread and returns a Future of its result.
+     * @remark Asynchronous tasks should never access any Endstone API
+     *
+     * @param plugin the reference to the plugin calling the function
+     * @param func the function to be called
+     * @return a Future holding the result of the function
+     */
+    template <typename Func>
+    auto callAsync(Plugin &plugin, Func func) -> Future<std::invoke_result_t<Func>>
+    {
+        using R = std::invoke_result_t<Func>;
+        auto state = std::make_shared<detail::FutureState<R>>(*this, plugin);
+        runTaskAsync(plugin, detail::makeFutureTask(state, std::move(func)));
+        return Future<R>{state};
+    }
+
+    /**
+     * @brief Starts a coroutine on the current thread. It runs until its first suspension point.
+     *
+     * The coroutine is destroyed at its next suspension point once the plugin is disabled.
+     *
+     * @param plugin the reference to the plugin starting the coroutine
+     * @param coroutine the coroutine to be run
+     */
+    void runCoroutine(Plugin &plugin, Coroutine<> coroutine)
+    {
+        auto handle = coroutine.release();
+        if (!handle) {
+            return;
+        }
+
+        auto &promise = handle.promise();
+        promise.root_context = {this, &plugin, handle};
+        promise.context = &promise.root_context;
+        promise.detached = true;
+        handle.resume();
+    }
+
+    /**
+     * @brief Returns an awaitable that resumes the coroutine on the server thread on the next server tick.
+     *
+     * @return an awaitable for use with co_await
+     */
+    [[nodiscard]] detail::ScheduleAwaiter nextTick()
+    {
+        return {*this, 1, false};
+    }
+
+    /**
+     * @brief Returns an awaitable that resumes the coroutine on the server thread after the specified number of server
+     * ticks.
+     *
+     * @param ticks the ticks to wait before resuming
+     * @return an awaitable for use with co_await
+     */
+    [[nodiscard]] detail::ScheduleAwaiter delay(std::uint64_t ticks)
+    {
+        return {*this, ticks, false};
+    }
+
+    /**
+     * @brief Returns an awaitable that resumes the coroutine on the server thread, or does not suspend at all if it is
+     * already running on the server thread.
+     *
+     * @return an awaitable for use with co_await
+     */
+    [[nodiscard]] detail::ScheduleAwaiter switchToMain()
+    {
+        return {*this, 0, false};
+    }
+
+    /**
+     * @brief Returns an awaitable that resumes the coroutine on a worker thread.
+     * @remark Code running on a worker thread should never access any Endstone API
+     *
+     * @return an awaitable for use with co_await
+     */
+    [[nodiscard]] detail::ScheduleAwaiter switchToAsync()
+    {
+        return {*this, 0, true};
+    }
+
+    /**
+     * @brief Schedules a suspended coroutine to be resumed. Used by the awaitables returned by this scheduler.
+     *
+     * @param handle the coroutine to be resumed
+     * @param context the context of the coroutine
+     * @param delay the ticks to wait before resuming on the server thread
+     * @param async whether to resume on a worker thread instead
+     * @return false if the coroutine should continue right away without suspending
+     */
+    virtual bool scheduleCoroutine(std::coroutine_handle<> handle, detail::CoroutineContext &context,
+                                   std::uint64_t delay, bool async) = 0;
 };
 
+template <typename T>
+template <typename Func>
+auto Future<T>::thenSync(Func func) -> Future<typename detail::ContinuationResult<Func, T>::type>
+{
+    using R = typename detail::ContinuationResult<Func, T>::type;
+    auto next = std::make_shared<detail::FutureState<R>>(state_->getScheduler(), state_->getPlugin());
+    state_->onComplete([state = state_, task = continuation(next, std::move(func))]() {
+        state->getScheduler().postSync(state->getPlugin(), task);
+    });
+    return Future<R>{next};
+}
+
+namespace detail {
+
+template <typename Promise>
+bool ScheduleAwaiter::await_suspend(std::coroutine_handle<Promise> handle)
+{
+    return scheduler_.scheduleCoroutine(handle, *handle.promise().context, delay_, async_);
+}
+
+template <typename Promise>
+void reportUnhandledException(Promise &promise) noexcept
+{
+    try {
+        std::rethrow_exception(promise.exception);
+    }
+    catch (std::exception &e) {
+        promise.context->plugin->getLogger().error("Unhandled exception in coroutine: {}", e.what());
+    }
+    catch (...) {
+        promise.context->plugin->getLogger().error("Unhandled exception in coroutine.");
+    }
+}
+
+}  // namespace detail
+
 }  // namespace endstone
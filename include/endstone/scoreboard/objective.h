@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <span>
 #include <string>
+#include <utility>
 
 #include "endstone/scoreboard/objective_sort_order.h"
 #include "endstone/scoreboard/score.h"
@@ -138,6 +140,15 @@ public:
      */
     [[nodiscard]] virtual Result<std::unique_ptr<Score>> getScore(ScoreEntry entry) const = 0;
 
+    /**
+     * @brief Sets the scores of many entries for this objective at once.
+     *
+     * Clients are sent a single packet for all the scores that changed, instead of one packet per score.
+     *
+     * @param scores the entries and their new scores
+     */
+    virtual Result<void> setScores(std::span<const std::pair<ScoreEntry, int>> scores) = 0;
+
     virtual bool operator==(const Objective &other) const = 0;
     virtual bool operator!=(const Objective &other) const = 0;
 };
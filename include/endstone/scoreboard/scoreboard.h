@@ -123,6 +123,25 @@ public:
      * @param slot the slot to remove objectives
      */
     virtual void clearSlot(DisplaySlot slot) = 0;
+
+    /**
+     * @brief Checks if score changes on this Scoreboard are buffered until the end of the tick.
+     *
+     * @return true if score changes are buffered
+     */
+    [[nodiscard]] virtual bool isBuffered() const = 0;
+
+    /**
+     * @brief Sets whether score changes on this Scoreboard are buffered until the end of the tick.
+     *
+     * While buffered, scores set through the API are accumulated per objective and applied at the end of the tick.
+     * Only the last score set for an entry is kept, scores set to the value they already had are dropped, and the
+     * changes of each objective are sent to clients in a single packet. Scores read through the API reflect the
+     * buffered changes right away; the game itself sees them at the end of the tick.
+     *
+     * @param buffered true to buffer score changes
+     */
+    virtual void setBuffered(bool buffered) = 0;
 };
 
 }  // namespace endstone
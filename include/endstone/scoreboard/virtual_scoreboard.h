@@ -0,0 +1,115 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "endstone/scoreboard/display_slot.h"
+#include "endstone/scoreboard/objective_sort_order.h"
+#include "endstone/scoreboard/score_entry.h"
+
+namespace endstone {
+
+/**
+ * @brief Represents the scoreboard displays that are only shown to a single player.
+ *
+ * Unlike a Scoreboard, a VirtualScoreboard only stores what is displayed in each slot. Changes are compared against
+ * what the client was last sent and only the differences are sent at the end of the tick.
+ *
+ * The display slots are shared with the player's Scoreboard: the objective displayed last is shown. Clearing a slot
+ * shows the player's Scoreboard again.
+ */
+class VirtualScoreboard {
+public:
+    virtual ~VirtualScoreboard() = default;
+
+    /**
+     * @brief Displays an objective in the specified slot, replacing anything this VirtualScoreboard showed there.
+     *
+     * The scores already set for the slot are kept. Scores are sorted in ascending order.
+     *
+     * @param slot the slot to display in
+     * @param display_name the name displayed to the player
+     */
+    virtual void setDisplay(DisplaySlot slot, std::string display_name) = 0;
+
+    /**
+     * @brief Displays an objective in the specified slot, replacing anything this VirtualScoreboard showed there.
+     *
+     * The scores already set for the slot are kept.
+     *
+     * @param slot the slot to display in
+     * @param display_name the name displayed to the player
+     * @param order the sort order of the scores
+     */
+    virtual void setDisplay(DisplaySlot slot, std::string display_name, ObjectiveSortOrder order) = 0;
+
+    /**
+     * @brief Removes the display and all scores of the specified slot.
+     *
+     * @param slot the slot to clear
+     */
+    virtual void clearDisplay(DisplaySlot slot) = 0;
+
+    /**
+     * @brief Gets if an objective is displayed in the specified slot.
+     *
+     * @param slot the slot to check
+     * @return true if the slot is displayed
+     */
+    [[nodiscard]] virtual bool isDisplayed(DisplaySlot slot) const = 0;
+
+    /**
+     * @brief Gets the score of an entry in the specified slot.
+     *
+     * @param slot the slot of the score
+     * @param entry the entry of the score
+     * @return the score, or std::nullopt if it is not set
+     */
+    [[nodiscard]] virtual std::optional<int> getScore(DisplaySlot slot, ScoreEntry entry) const = 0;
+
+    /**
+     * @brief Sets the score of an entry in the specified slot.
+     *
+     * @param slot the slot of the score
+     * @param entry the entry of the score
+     * @param score the new score
+     */
+    virtual void setScore(DisplaySlot slot, ScoreEntry entry, int score) = 0;
+
+    /**
+     * @brief Removes the score of an entry in the specified slot.
+     *
+     * @param slot the slot of the score
+     * @param entry the entry of the score
+     */
+    virtual void resetScore(DisplaySlot slot, ScoreEntry entry) = 0;
+
+    /**
+     * @brief Replaces all scores in the specified slot with lines of text, shown from top to bottom.
+     *
+     * Lines that did not change are not sent again. As each line is shown as an entry, lines must be distinct;
+     * duplicated lines are only shown once.
+     *
+     * @param slot the slot to show the lines in
+     * @param lines the lines of text
+     */
+    virtual void setLines(DisplaySlot slot, const std::vector<std::string> &lines) = 0;
+};
+
+}  // namespace endstone
@@ -24,6 +24,7 @@
 #include "endstone/ban/player_ban_list.h"
 #include "endstone/block/block_data.h"
 #include "endstone/boss/boss_bar.h"
+#include "endstone/form/form_template.h"
 #include "endstone/lang/language.h"
 #include "endstone/level/level.h"
 #include "endstone/logger.h"
@@ -31,6 +32,7 @@
 #include "endstone/scoreboard/scoreboard.h"
 #include "endstone/util/result.h"
 #include "endstone/util/uuid.h"
+#include "endstone/view_distance_hint.h"
 
 namespace endstone {
 
@@ -291,6 +293,21 @@ public:
      */
     [[nodiscard]] virtual std::chrono::system_clock::time_point getStartTime() = 0;
 
+    /**
+     * @brief Gets the settings of the view distance hint.
+     *
+     * @return The view distance hint settings
+     */
+    [[nodiscard]] virtual ViewDistanceHintSettings getViewDistanceHintSettings() const = 0;
+
+    /**
+     * @brief Sets the settings of the view distance hint.
+     *
+     * @param settings The new view distance hint settings
+     * @return A Result indicating success or failure
+     */
+    virtual Result<void> setViewDistanceHintSettings(ViewDistanceHintSettings settings) = 0;
+
     /**
      * @brief Creates a boss bar instance to display to players. The progress defaults to 1.0.
      *
@@ -314,6 +331,14 @@ public:
     [[nodiscard]] virtual std::unique_ptr<BossBar> createBossBar(std::string title, BarColor color, BarStyle style,
                                                                  std::vector<BarFlag> flags) const = 0;
 
+    /**
+     * @brief Creates a form template, serializing the form once so that it can be sent to many players.
+     *
+     * @param form the form to create the template from
+     * @return the created form template
+     */
+    [[nodiscard]] virtual std::unique_ptr<FormTemplate> createFormTemplate(FormTemplate::FormVariant form) const = 0;
+
     /**
      * @brief Creates a new BlockData instance for the specified block type, with all properties initialized to
      * defaults.
@@ -0,0 +1,66 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace endstone {
+
+/**
+ * @brief Represents the settings of the view distance hint, which asks clients to use a smaller view distance while the
+ * server is under heavy load and restores it once the load recovers.
+ *
+ * This is only a hint sent to the clients. The server keeps publishing and simulating chunks within the radius each
+ * client requests, so a client that ignores the hint is not limited. Players with the permission
+ * endstone.viewdistance.exempt are never sent a reduced view distance.
+ */
+struct ViewDistanceHintSettings {
+    /**
+     * @brief Whether the view distance hint is enabled.
+     */
+    bool enabled = false;
+
+    /**
+     * @brief The average milliseconds per tick above which the view distance is reduced.
+     */
+    float high_mspt = 45.0F;
+
+    /**
+     * @brief The average milliseconds per tick below which the view distance is restored.
+     *
+     * Must be lower than high_mspt, the gap between the two prevents the hint from oscillating.
+     */
+    float low_mspt = 35.0F;
+
+    /**
+     * @brief The view distance in chunks the hint never goes below.
+     */
+    int min_view_distance = 4;
+
+    /**
+     * @brief The view distance in chunks the hint never goes above, or 0 to use the view distance of the server.
+     */
+    int max_view_distance = 0;
+
+    /**
+     * @brief The number of chunks the view distance is reduced or restored by in a single adjustment.
+     */
+    int step = 2;
+
+    /**
+     * @brief The minimum number of ticks between two adjustments.
+     */
+    int cooldown = 100;
+};
+
+}  // namespace endstone
@@ -50,6 +50,14 @@ public:
         return *this;
     }
 
+    [[nodiscard]] constexpr float distanceToSqr(const Vec3 &other) const
+    {
+        const auto dx = x - other.x;
+        const auto dy = y - other.y;
+        const auto dz = z - other.z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+
     static const Vec3 ZERO;
 };
 BEDROCK_STATIC_ASSERT_SIZE(Vec3, 12, 12);
@@ -49,9 +49,7 @@ public:
 
     void reset()
     {
-        if (control_block_ && !control_block_->is_valid) {
-            throw std::runtime_error("Resetting a dangling pointer!");
-        }
+        // letting go of a dangling pointer is fine, only accessing it is not
         control_block_.reset();
         pointer_ = nullptr;
     }
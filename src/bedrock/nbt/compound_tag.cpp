@@ -30,8 +30,37 @@ void CompoundTag::write(IDataOutput &output) const
 
 Bedrock::Result<void> CompoundTag::load(IDataInput &input)
 {
-    // TODO(nbt): fixme
-    throw std::runtime_error("Not implemented");
+    const LoadScope scope;
+    if (scope.isTooDeep()) {
+        return nonstd::make_unexpected(
+            Bedrock::ErrorInfo<std::error_code>{std::make_error_code(std::errc::bad_message)});
+    }
+
+    tags_.clear();
+    while (true) {
+        auto type_result = input.readByteResult();
+        if (!type_result) {
+            return nonstd::make_unexpected(type_result.error());
+        }
+        const auto type = static_cast<Type>(type_result.value());
+        if (type == Type::End) {
+            return {};
+        }
+
+        auto name_result = input.readStringResult();
+        if (!name_result) {
+            return nonstd::make_unexpected(name_result.error());
+        }
+        auto tag_result = newTag(type);
+        if (!tag_result) {
+            return nonstd::make_unexpected(tag_result.error());
+        }
+        auto tag = std::move(tag_result.value());
+        if (auto result = tag->load(input); !result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        put(std::move(name_result.value()), std::move(tag));
+    }
 }
 
 std::string CompoundTag::toString() const
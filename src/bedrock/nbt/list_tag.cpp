@@ -14,6 +14,8 @@
 
 #include "bedrock/nbt/list_tag.h"
 
+#include <algorithm>
+
 #include "bedrock/nbt/byte_tag.h"
 #include "bedrock/nbt/compound_tag.h"
 #include "bedrock/nbt/double_tag.h"
@@ -43,6 +45,12 @@ void ListTag::write(IDataOutput &output) const
 
 Bedrock::Result<void> ListTag::load(IDataInput &input)
 {
+    const LoadScope scope;
+    if (scope.isTooDeep()) {
+        return nonstd::make_unexpected(
+            Bedrock::ErrorInfo<std::error_code>{std::make_error_code(std::errc::bad_message)});
+    }
+
     auto byte_result = input.readByteResult();
     if (!byte_result) {
         return nonstd::make_unexpected(byte_result.error());
@@ -55,6 +63,10 @@ Bedrock::Result<void> ListTag::load(IDataInput &input)
     }
 
     const auto size = int_result.value();
+    if (size < 0 || static_cast<std::uint64_t>(size) > input.numBytesLeft()) {
+        return nonstd::make_unexpected(
+            Bedrock::ErrorInfo<std::error_code>{std::make_error_code(std::errc::bad_message)});
+    }
     list_.clear();
     list_.reserve(size);
     for (int i = 0; i < size; ++i) {
@@ -63,7 +75,9 @@ Bedrock::Result<void> ListTag::load(IDataInput &input)
             return nonstd::make_unexpected(tag_result.error());
         }
         auto tag = std::move(tag_result.value());
-        tag->load(input);
+        if (auto result = tag->load(input); !result) {
+            return nonstd::make_unexpected(result.error());
+        }
         list_.push_back(std::move(tag));
     }
     return {};
@@ -78,8 +92,15 @@ Tag::Type ListTag::getId() const
 }
 bool ListTag::equals(const Tag &other) const
 {
-    return Tag::equals(other) && list_ == static_cast<const ListTag &>(other).list_ &&
-           type_ == static_cast<const ListTag &>(other).type_;
+    if (!Tag::equals(other)) {
+        return false;
+    }
+    const auto &other_list = static_cast<const ListTag &>(other);
+    if (type_ != other_list.type_) {
+        return false;
+    }
+    return std::ranges::equal(list_, other_list.list_,
+                              [](const auto &lhs, const auto &rhs) { return lhs->equals(*rhs); });
 }
 std::unique_ptr<Tag> ListTag::copy() const
 {
@@ -87,7 +108,11 @@ std::unique_ptr<Tag> ListTag::copy() const
 }
 std::size_t ListTag::hash() const
 {
-    return boost::hash_range(list_.begin(), list_.end());
+    std::size_t seed = 0;
+    for (const auto &tag : list_) {
+        boost::hash_combine(seed, tag->hash());
+    }
+    return seed;
 }
 void ListTag::print(const std::string &string, PrintStream &stream) const
 {
@@ -27,6 +27,8 @@
 #include "bedrock/nbt/short_tag.h"
 #include "bedrock/nbt/string_tag.h"
 
+thread_local int Tag::LoadScope::depth_ = 0;
+
 bool Tag::equals(const Tag &other) const
 {
     return getId() == other.getId();
@@ -50,6 +50,34 @@ public:
     static Bedrock::Result<std::unique_ptr<Tag>> newTag(Type);
     static std::string getTagName(Type type);
 
+    static constexpr int MaxDepth = 512;  // Endstone: nesting of compound and list tags accepted by load
+
 protected:
     Tag() = default;
+
+    // Endstone begins
+    // counts the compound and list tags being loaded on the current thread, so that malformed input cannot nest them
+    // deep enough to exhaust the stack
+    class LoadScope {
+    public:
+        LoadScope()
+        {
+            ++depth_;
+        }
+        ~LoadScope()
+        {
+            --depth_;
+        }
+        LoadScope(const LoadScope &) = delete;
+        LoadScope &operator=(const LoadScope &) = delete;
+
+        [[nodiscard]] bool isTooDeep() const
+        {
+            return depth_ > MaxDepth;
+        }
+
+    private:
+        static thread_local int depth_;
+    };
+    // Endstone ends
 };
@@ -0,0 +1,30 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <string>
+
+#include "bedrock/network/packet.h"
+#include "bedrock/world/scores/objective.h"
+
+class SetDisplayObjectivePacket : public Packet {
+public:
+    std::string display_slot_name;       // +48
+    std::string objective_name;          // +80
+    std::string objective_display_name;  // +112
+    std::string criteria_name;           // +144
+    ObjectiveSortOrder sort_order;       // +176
+};
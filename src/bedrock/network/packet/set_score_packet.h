@@ -0,0 +1,46 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bedrock/network/packet.h"
+#include "bedrock/world/actor/actor_unique_id.h"
+#include "bedrock/world/scores/identity_definition.h"
+#include "bedrock/world/scores/player_scoreboard_id.h"
+#include "bedrock/world/scores/scoreboard_id.h"
+
+enum class ScorePacketType : std::uint8_t {
+    Change = 0,
+    Remove = 1
+};
+
+struct ScorePacketInfo {
+    ScoreboardId scoreboard_id;              // +0
+    std::string objective_name;              // +16
+    int score_value;                         // +48
+    IdentityDefinition::Type identity_type;  // +52
+    PlayerScoreboardId player_id;            // +56
+    ActorUniqueID entity_id;                 // +64
+    std::string fake_player_name;            // +72
+};
+
+class SetScorePacket : public Packet {
+public:
+    ScorePacketType type;                     // +48
+    std::vector<ScorePacketInfo> score_info;  // +56
+};
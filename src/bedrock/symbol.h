@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <string_view>
@@ -47,6 +48,37 @@ constexpr void foreach_symbol(Func &&func)
         std::invoke(std::forward<Func>(func), key, value);
     }
 }
+
+// Must match symbol_slot in the symbol generator
+constexpr std::uint32_t symbol_slot(std::uint32_t hash, std::uint32_t displacement, std::uint32_t mask) noexcept
+{
+    std::uint32_t h = hash + displacement * 0x9e3779b9U;
+    h ^= h >> 16;
+    h *= 0x85ebca6bU;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35U;
+    h ^= h >> 16;
+    return h & mask;
+}
+
+/**
+ * Returns the index in symbols of the symbol with the given entt::hashed_string hash, or symbols.size() if there is
+ * none. Looks up the perfect hash generated with the symbols, so it takes a single probe.
+ */
+constexpr std::size_t find_symbol(std::uint32_t hash) noexcept
+{
+    if constexpr (symbols.empty()) {
+        return 0;
+    }
+    else {
+        const auto displacement = symbol_displacements[hash & (symbol_displacements.size() - 1)];
+        const auto slot = symbol_slots[symbol_slot(hash, displacement, symbol_slots.size() - 1)];
+        if (slot == 0 || symbol_hashes[slot - 1] != hash) {
+            return symbols.size();
+        }
+        return slot - 1;
+    }
+}
 }  // namespace endstone::detail
 
 #define BEDROCK_CALL(fp, ...)                                                                                \
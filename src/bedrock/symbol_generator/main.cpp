@@ -1,15 +1,151 @@
+#include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <numeric>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <toml++/toml.h>
 
 namespace {
+// Must match the hash of entt::hashed_string, which names the originals of the hooks
+std::uint32_t fnv1a(std::string_view str)
+{
+    std::uint32_t hash = 2166136261U;
+    for (const auto c : str) {
+        hash = (hash ^ static_cast<std::uint8_t>(c)) * 16777619U;
+    }
+    return hash;
+}
+
+// Must match endstone::detail::symbol_slot in bedrock/symbol.h
+std::uint32_t symbol_slot(std::uint32_t hash, std::uint32_t displacement, std::uint32_t mask)
+{
+    std::uint32_t h = hash + displacement * 0x9e3779b9U;
+    h ^= h >> 16;
+    h *= 0x85ebca6bU;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35U;
+    h ^= h >> 16;
+    return h & mask;
+}
+
+std::uint32_t next_power_of_two(std::size_t n)
+{
+    std::uint32_t value = 1;
+    while (value < n) {
+        value <<= 1;
+    }
+    return value;
+}
+
+struct PerfectHash {
+    std::vector<std::uint32_t> displacements;
+    std::vector<std::uint16_t> slots;  // index of the symbol + 1, or 0 if empty
+};
+
+// Hash and displace: the symbols are split into buckets by their hash, and for each bucket, largest first, a
+// displacement is searched for that moves all of its symbols into free slots.
+bool build_perfect_hash(const std::vector<std::uint32_t> &hashes, PerfectHash &result)
+{
+    const auto slot_count = next_power_of_two(std::max<std::size_t>(hashes.size() * 2, 1));
+    const auto bucket_count = next_power_of_two(std::max<std::size_t>(hashes.size() / 4, 1));
+
+    std::vector<std::vector<std::size_t>> buckets(bucket_count);
+    for (std::size_t i = 0; i < hashes.size(); ++i) {
+        buckets[hashes[i] & (bucket_count - 1)].push_back(i);
+    }
+    std::vector<std::uint32_t> order(bucket_count);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](auto a, auto b) { return buckets[a].size() > buckets[b].size(); });
+
+    result.displacements.assign(bucket_count, 0);
+    result.slots.assign(slot_count, 0);
+    std::vector<std::uint32_t> taken;
+    for (const auto bucket : order) {
+        if (buckets[bucket].empty()) {
+            break;
+        }
+        bool placed = false;
+        for (std::uint32_t d = 0; d < (1U << 20) && !placed; ++d) {
+            taken.clear();
+            placed = true;
+            for (const auto index : buckets[bucket]) {
+                const auto slot = symbol_slot(hashes[index], d, slot_count - 1);
+                if (result.slots[slot] != 0 || std::ranges::find(taken, slot) != taken.end()) {
+                    placed = false;
+                    break;
+                }
+                taken.push_back(slot);
+            }
+            if (placed) {
+                result.displacements[bucket] = d;
+                for (std::size_t i = 0; i < taken.size(); ++i) {
+                    result.slots[taken[i]] = static_cast<std::uint16_t>(buckets[bucket][i] + 1);
+                }
+            }
+        }
+        if (!placed) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void write_array(std::ofstream &output, std::string_view type, std::string_view name, const std::vector<T> &values)
+{
+    output << "static constexpr std::array<" << type << ", " << values.size() << "> " << name << " = {";
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        output << (i % 8 == 0 ? "\n    " : " ") << values[i] << (i + 1 < values.size() ? "," : "");
+    }
+    output << "\n};\n";
+}
+
 int generate_include_file(const std::string &output_file, const toml::table &table)
 {
     namespace fs = std::filesystem;
 
+    std::vector<std::pair<std::string, std::int64_t>> symbols;
+    std::vector<std::string> unresolved;
+    for (const auto &[key, value] : table) {
+        if (!value.is_integer()) {
+            std::cerr << "Skipping non-integer value for key: " << key << '\n';
+            continue;
+        }
+        auto val = *value.value<int64_t>();
+        if (val == 0) {
+            std::cerr << "Skipping zero value for key: " << key << '\n';
+            unresolved.emplace_back(key.str());
+            continue;
+        }
+        symbols.emplace_back(key.str(), val);
+    }
+    if (symbols.size() >= 0xffff) {
+        std::cerr << "Too many symbols: " << symbols.size() << '\n';
+        return 1;
+    }
+
+    std::vector<std::uint32_t> hashes;
+    for (const auto &[key, value] : symbols) {
+        const auto hash = fnv1a(key);
+        if (const auto it = std::ranges::find(hashes, hash); it != hashes.end()) {
+            std::cerr << "Hash collision between " << symbols[it - hashes.begin()].first << " and " << key << '\n';
+            return 1;
+        }
+        hashes.push_back(hash);
+    }
+
+    PerfectHash perfect_hash;
+    if (!build_perfect_hash(hashes, perfect_hash)) {
+        std::cerr << "Failed to build the perfect hash of the symbols" << '\n';
+        return 1;
+    }
+
     fs::path output_path = output_file;
     fs::path parent_dir = output_path.parent_path();
 
@@ -31,23 +167,25 @@ int generate_include_file(const std::string &output_file, const toml::table &tab
     }
 
     output << "#pragma once\n\n";
-    output << "#include <array>\n#include <string_view>\n\n";
-    output << "static constexpr std::array<std::pair<std::string_view, std::size_t>, " << table.size()
+    output << "#include <array>\n#include <cstdint>\n#include <string_view>\n#include <utility>\n\n";
+    output << "static constexpr std::array<std::pair<std::string_view, std::size_t>, " << symbols.size()
            << "> symbols = {{\n";
-
-    for (const auto &[key, value] : table) {
-        if (!value.is_integer()) {
-            std::cerr << "Skipping non-integer value for key: " << key << '\n';
-            continue;
-        }
-        auto val = *value.value<int64_t>();
-        if (val == 0) {
-            std::cerr << "Skipping zero value for key: " << key << '\n';
-            continue;
-        }
-        output << "    { \"" << key << "\", " << val << " },\n";
+    for (const auto &[key, value] : symbols) {
+        output << "    { \"" << key << "\", " << value << " },\n";
     }
+    output << "}};\n\n";
+
+    output << "// FNV-1a hashes of the symbols, same as entt::hashed_string\n";
+    write_array(output, "std::uint32_t", "symbol_hashes", hashes);
+    output << "\n// Perfect hash of symbol_hashes, see endstone::detail::find_symbol\n";
+    write_array(output, "std::uint32_t", "symbol_displacements", perfect_hash.displacements);
+    write_array(output, "std::uint16_t", "symbol_slots", perfect_hash.slots);
 
+    output << "\n// Symbols without an address for this version\n";
+    output << "static constexpr std::array<std::string_view, " << unresolved.size() << "> unresolved_symbols = {{\n";
+    for (const auto &key : unresolved) {
+        output << "    \"" << key << "\",\n";
+    }
     output << "}};\n";
     output.close();
     return 0;
@@ -0,0 +1,34 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "bedrock/world/actor/experience_orb.h"
+
+ExperienceOrb *ExperienceOrb::tryGetFromEntity(EntityContext &entity, bool include_removed)
+{
+    auto *actor = Actor::tryGetFromEntity(entity, include_removed);
+    if (!actor || !actor->isType(ActorType::Experience)) {
+        return nullptr;
+    }
+    return static_cast<ExperienceOrb *>(actor);
+}
+
+int ExperienceOrb::getValue() const
+{
+    return entity_data.getInt(static_cast<SynchedActorData::ID>(ActorDataIDs::VALUE));
+}
+
+void ExperienceOrb::setValue(int value)
+{
+    entity_data.set<SynchedActorData::TypeInt>(static_cast<SynchedActorData::ID>(ActorDataIDs::VALUE), value);
+}
@@ -0,0 +1,40 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "bedrock/bedrock.h"
+#include "bedrock/world/actor/actor.h"
+#include "bedrock/world/item/item_stack.h"
+
+class ItemActor : public Actor {
+public:
+    static ItemActor *tryGetFromEntity(EntityContext &entity, bool include_removed = false);
+
+    [[nodiscard]] ItemStack &getItemStack();
+    [[nodiscard]] const ItemStack &getItemStack() const;
+
+private:
+    // Offsets are relative to the end of the Actor base
+    ItemStack item_;         // +0
+    int age_;                // +152
+    int pickup_delay_;       // +156
+    int throw_time_;         // +160
+    float bob_offs_;         // +164
+    int health_;             // +168
+    int lifetime_;           // +172
+    bool is_in_item_frame_;  // +176
+    bool is_from_fishing_;   // +177
+};
+static_assert(sizeof(ItemActor) == sizeof(Actor) + 184, "Size of ItemActor does not match expected size.");
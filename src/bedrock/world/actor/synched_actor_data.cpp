@@ -38,6 +38,18 @@ SynchedActorData::TypeInt8 SynchedActorData::getInt8(ID id) const
     return static_cast<DataItem2<TypeInt8> *>(item)->data_;
 }
 
+SynchedActorData::TypeInt SynchedActorData::getInt(ID id) const
+{
+    if (!hasData(id)) {
+        return 0;
+    }
+    auto *item = _find(id);
+    if (item->getType() != DataItemType::Int) {
+        return 0;
+    }
+    return static_cast<DataItem2<TypeInt> *>(item)->data_;
+}
+
 const std::string &SynchedActorData::getString(ID id) const
 {
     static std::string empty_string;
@@ -53,7 +65,7 @@ const std::string &SynchedActorData::getString(ID id) const
 
 bool SynchedActorData::hasData(ID id) const
 {
-    return id >= items_array_.size() && items_array_[id];
+    return id < items_array_.size() && items_array_[id];
 }
 
 DataItem &SynchedActorData::_get(ID id)
@@ -71,6 +83,11 @@ SynchedActorData::TypeInt8 SynchedActorDataEntityWrapper::getInt8(SynchedActorDa
     return data_->data.getInt8(id);
 }
 
+SynchedActorData::TypeInt SynchedActorDataEntityWrapper::getInt(SynchedActorData::ID id) const
+{
+    return data_->data.getInt(id);
+}
+
 const std::string &SynchedActorDataEntityWrapper::getString(SynchedActorData::ID id) const
 {
     return data_->data.getString(id);
@@ -95,6 +112,20 @@ void SynchedActorDataEntityWrapper::set<SynchedActorData::TypeInt8>(SynchedActor
     data->dirty_flags_.set(id, true);
 }
 
+template <>
+void SynchedActorDataEntityWrapper::set<SynchedActorData::TypeInt>(SynchedActorData::ID id,
+                                                                   const SynchedActorData::TypeInt &value)
+{
+    auto data = _get();
+    auto *item = data->_find(id);
+    if (!item || item->getType() != DataItemType::Int) {
+        return;
+    }
+    auto *int_item = static_cast<DataItem2<SynchedActorData::TypeInt> *>(item);
+    int_item->data_ = value;
+    data->dirty_flags_.set(id, true);
+}
+
 template <>
 void SynchedActorDataEntityWrapper::set<std::string>(SynchedActorData::ID id, const std::string &value)
 {
@@ -70,6 +70,7 @@ public:
     using ID = DataItem::ID;
 
     [[nodiscard]] TypeInt8 getInt8(ID) const;
+    [[nodiscard]] TypeInt getInt(ID) const;
     [[nodiscard]] const std::string &getString(ID) const;
     [[nodiscard]] bool hasData(ID) const;
 
@@ -89,6 +90,7 @@ struct SynchedActorDataComponent;
 class SynchedActorDataEntityWrapper {
 public:
     [[nodiscard]] SynchedActorData::TypeInt8 getInt8(SynchedActorData::ID) const;
+    [[nodiscard]] SynchedActorData::TypeInt getInt(SynchedActorData::ID) const;
     [[nodiscard]] const std::string &getString(SynchedActorData::ID) const;
     template <typename T>
     void set(SynchedActorData::ID, const T &);
@@ -327,7 +327,7 @@ void ItemStackBase::set(const std::uint8_t count)
     else {
         count_ = count;
     }
-    if (!isNull()) {
+    if (isNull()) {
         setNull(std::nullopt);
     }
 }
@@ -337,6 +337,28 @@ std::uint8_t ItemStackBase::getCount() const
     return count_;
 }
 
+std::uint8_t ItemStackBase::getMaxStackSize() const
+{
+    if (item_.isNull()) {
+        return 1;
+    }
+    return item_->getMaxStackSize(getDescriptor());
+}
+
+bool ItemStackBase::isStackable(const ItemStackBase &other) const
+{
+    if (isNull() || other.isNull() || getItem() != other.getItem() || getAuxValue() != other.getAuxValue()) {
+        return false;
+    }
+    if (getMaxStackSize() <= 1) {
+        return false;
+    }
+    if (hasUserData() != other.hasUserData()) {
+        return false;
+    }
+    return !hasUserData() || getUserData()->equals(*other.getUserData());
+}
+
 void ItemStackBase::init(const BlockLegacy &block, const int count)
 {
     init(block.getBlockItemId(), count, 0, true);
@@ -59,6 +59,8 @@ public:
     [[nodiscard]] const Block *getBlock() const;
     void set(std::uint8_t count);
     [[nodiscard]] std::uint8_t getCount() const;  // Endstone
+    [[nodiscard]] std::uint8_t getMaxStackSize() const;
+    [[nodiscard]] bool isStackable(const ItemStackBase &other) const;
 
     static const std::string TAG_DISPLAY;
     static const std::string TAG_DISPLAY_NAME;
@@ -0,0 +1,242 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/actor/actor_merger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+#include "bedrock/world/actor/experience_orb.h"
+#include "bedrock/world/actor/item/item_actor.h"
+#include "bedrock/world/level/dimension/dimension.h"
+#include "bedrock/world/level/level.h"
+#include "endstone/core/util/error.h"
+
+namespace endstone::core {
+
+namespace {
+constexpr auto cell = [](const auto &candidate) {
+    return std::make_tuple(candidate.kind, candidate.dimension_id, candidate.chunk_x, candidate.chunk_z);
+};
+}  // namespace
+
+float ActorMerger::getItemMergeRadius() const
+{
+    return item_merge_radius_;
+}
+
+Result<void> ActorMerger::setItemMergeRadius(float radius)
+{
+    if (radius < 0.0F || radius > MaxMergeRadius) {
+        return nonstd::make_unexpected(
+            make_error("Item merge radius ({}) must be between 0 and {}.", radius, MaxMergeRadius));
+    }
+    item_merge_radius_ = radius;
+    return {};
+}
+
+float ActorMerger::getExperienceMergeRadius() const
+{
+    return experience_merge_radius_;
+}
+
+Result<void> ActorMerger::setExperienceMergeRadius(float radius)
+{
+    if (radius < 0.0F || radius > MaxMergeRadius) {
+        return nonstd::make_unexpected(
+            make_error("Experience merge radius ({}) must be between 0 and {}.", radius, MaxMergeRadius));
+    }
+    experience_merge_radius_ = radius;
+    return {};
+}
+
+int ActorMerger::getMergeInterval() const
+{
+    return merge_interval_;
+}
+
+Result<void> ActorMerger::setMergeInterval(int interval)
+{
+    if (interval < 1) {
+        return nonstd::make_unexpected(make_error("Merge interval ({}) must be at least 1.", interval));
+    }
+    merge_interval_ = interval;
+    return {};
+}
+
+int ActorMerger::getMergeBudget() const
+{
+    return merge_budget_;
+}
+
+Result<void> ActorMerger::setMergeBudget(int budget)
+{
+    if (budget < 1) {
+        return nonstd::make_unexpected(make_error("Merge budget ({}) must be at least 1.", budget));
+    }
+    merge_budget_ = budget;
+    return {};
+}
+
+bool ActorMerger::isEnabled() const
+{
+    return item_merge_radius_ > 0.0F || experience_merge_radius_ > 0.0F;
+}
+
+std::uint64_t ActorMerger::getMergedCount() const
+{
+    return merged_count_;
+}
+
+void ActorMerger::tick(::Level &level, std::uint64_t current_tick)
+{
+    if (!isEnabled()) {
+        candidates_.clear();
+        cursor_ = 0;
+        scanning_ = false;
+        neighbour_ = 0;
+        target_ = 0;
+        return;
+    }
+
+    // Only start a new pass once the previous one has been fully processed
+    if (cursor_ >= candidates_.size() && current_tick % merge_interval_ == 0) {
+        collect(level);
+    }
+    process(level);
+}
+
+void ActorMerger::collect(::Level &level)
+{
+    candidates_.clear();
+    cursor_ = 0;
+    scanning_ = false;
+    neighbour_ = 0;
+    target_ = 0;
+
+    for (const auto &entity : level.getEntities()) {
+        if (!entity.hasValue()) {
+            continue;
+        }
+        const auto *actor = ::Actor::tryGetFromEntity(*entity, false);
+        if (!actor) {
+            continue;
+        }
+
+        Kind kind;
+        if (item_merge_radius_ > 0.0F && actor->isType(ActorType::ItemEntity)) {
+            kind = Kind::Item;
+        }
+        else if (experience_merge_radius_ > 0.0F && actor->isType(ActorType::Experience)) {
+            kind = Kind::Experience;
+        }
+        else {
+            continue;
+        }
+
+        const auto &pos = actor->getPosition();
+        candidates_.push_back({kind, actor->getDimension().getDimensionId().runtime_id,
+                               static_cast<int>(std::floor(pos.x)) >> 4, static_cast<int>(std::floor(pos.z)) >> 4,
+                               actor->getRuntimeID()});
+    }
+
+    std::ranges::sort(candidates_, {}, cell);
+}
+
+void ActorMerger::process(::Level &level)
+{
+    auto work = 0;
+    while (cursor_ < candidates_.size() && work < merge_budget_) {
+        const auto &candidate = candidates_[cursor_];
+        auto *source = level.getRuntimeEntity(candidate.runtime_id, false);
+        if (!scanning_) {
+            scanning_ = true;
+            work++;
+        }
+
+        const auto radius = candidate.kind == Kind::Item ? item_merge_radius_ : experience_merge_radius_;
+        const auto radius_sqr = radius * radius;
+
+        // The merge radius never exceeds a chunk, so only the adjacent chunks need to be searched. Once the budget is
+        // used up, the scan stops and resumes from the same neighbour and target on the next tick.
+        for (; source && !source->isRemoved() && neighbour_ < 9; neighbour_++, target_ = 0) {
+            const auto dx = neighbour_ / 3 - 1;
+            const auto dz = neighbour_ % 3 - 1;
+            const auto key = std::make_tuple(candidate.kind, candidate.dimension_id, candidate.chunk_x + dx,
+                                             candidate.chunk_z + dz);
+            const auto [first, last] = std::ranges::equal_range(candidates_, key, {}, cell);
+            for (auto it = first + target_; it < last && !source->isRemoved(); ++it, ++target_) {
+                if (it->runtime_id.raw_id == candidate.runtime_id.raw_id) {
+                    continue;
+                }
+                if (work >= merge_budget_) {
+                    return;
+                }
+                auto *target = level.getRuntimeEntity(it->runtime_id, false);
+                work++;
+                if (!target || source->getPosition().distanceToSqr(target->getPosition()) > radius_sqr) {
+                    continue;
+                }
+                tryMerge(*source, *target, candidate.kind);
+            }
+        }
+
+        cursor_++;
+        scanning_ = false;
+        neighbour_ = 0;
+        target_ = 0;
+    }
+}
+
+void ActorMerger::tryMerge(::Actor &source, ::Actor &target, Kind kind)
+{
+    if (!source.getNameTag().empty() || !target.getNameTag().empty()) {
+        return;
+    }
+
+    switch (kind) {
+    case Kind::Item: {
+        auto *from = static_cast<ItemActor *>(&source);
+        auto *to = static_cast<ItemActor *>(&target);
+        if (!from->getItemStack().isStackable(to->getItemStack())) {
+            return;
+        }
+        const auto total = from->getItemStack().getCount() + to->getItemStack().getCount();
+        if (total > to->getItemStack().getMaxStackSize()) {
+            return;
+        }
+        // Always keep the larger stack, so piles converge on a single actor
+        if (from->getItemStack().getCount() > to->getItemStack().getCount()) {
+            std::swap(from, to);
+        }
+        to->getItemStack().set(static_cast<std::uint8_t>(total));
+        from->remove();
+        break;
+    }
+    case Kind::Experience: {
+        auto *from = static_cast<ExperienceOrb *>(&source);
+        auto *to = static_cast<ExperienceOrb *>(&target);
+        if (from->getValue() > to->getValue()) {
+            std::swap(from, to);
+        }
+        to->setValue(from->getValue() + to->getValue());
+        from->remove();
+        break;
+    }
+    }
+    merged_count_++;
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,88 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bedrock/world/actor/actor_runtime_id.h"
+#include "endstone/util/result.h"
+
+class Actor;
+class Level;
+
+namespace endstone::core {
+
+/**
+ * Merges nearby dropped items and experience orbs to reduce the number of actors the server has to tick.
+ *
+ * Every merge interval, the item and experience orb actors in the level are collected and grouped by dimension and
+ * chunk. The groups are then processed over the following ticks, comparing each actor only with the actors in the
+ * same and the adjacent chunks. At most `budget` actors are examined per tick, and a scan that runs out of budget
+ * resumes where it stopped on the next tick, so large piles of drops are spread over several ticks instead of causing a
+ * spike. A merge radius of 0 disables merging of that kind of actor, which is
+ * the default for both.
+ */
+class ActorMerger {
+public:
+    static constexpr float MaxMergeRadius = 16.0F;
+    static constexpr int DefaultMergeInterval = 20;
+    static constexpr int DefaultMergeBudget = 256;
+
+    [[nodiscard]] float getItemMergeRadius() const;
+    Result<void> setItemMergeRadius(float radius);
+    [[nodiscard]] float getExperienceMergeRadius() const;
+    Result<void> setExperienceMergeRadius(float radius);
+    [[nodiscard]] int getMergeInterval() const;
+    Result<void> setMergeInterval(int interval);
+    [[nodiscard]] int getMergeBudget() const;
+    Result<void> setMergeBudget(int budget);
+    [[nodiscard]] bool isEnabled() const;
+    [[nodiscard]] std::uint64_t getMergedCount() const;
+
+    void tick(::Level &level, std::uint64_t current_tick);
+
+private:
+    enum class Kind : std::uint8_t {
+        Item,
+        Experience,
+    };
+
+    struct Candidate {
+        Kind kind;
+        int dimension_id;
+        int chunk_x;
+        int chunk_z;
+        ActorRuntimeID runtime_id;
+    };
+
+    void collect(::Level &level);
+    void process(::Level &level);
+    void tryMerge(::Actor &source, ::Actor &target, Kind kind);
+
+    float item_merge_radius_{0.0F};
+    float experience_merge_radius_{0.0F};
+    int merge_interval_{DefaultMergeInterval};
+    int merge_budget_{DefaultMergeBudget};
+    std::uint64_t merged_count_{0};
+    std::vector<Candidate> candidates_;
+    std::size_t cursor_{0};
+    bool scanning_{false};
+    int neighbour_{0};
+    std::ptrdiff_t target_{0};
+};
+
+}  // namespace endstone::core
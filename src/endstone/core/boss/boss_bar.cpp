@@ -14,6 +14,9 @@
 
 #include "endstone/core/boss/boss_bar.h"
 
+#include <algorithm>
+#include <mutex>
+
 #include "bedrock/network/packet.h"
 #include "bedrock/network/packet/boss_event_packet.h"
 #include "endstone/core/server.h"
@@ -21,6 +24,27 @@
 
 namespace endstone::core {
 
+EndstoneBossBar::EndstoneBossBar(std::string title, BarColor color, BarStyle style, const std::vector<BarFlag> &flags)
+    : title_(std::move(title)), color_(color), style_(style)
+{
+    for (auto const &flag : flags) {
+        flags_.set(static_cast<int>(flag));
+    }
+    auto &server = entt::locator<EndstoneServer>::value();
+    std::lock_guard lock{server.boss_bars_mtx_};
+    server.boss_bars_.push_back(this);
+}
+
+EndstoneBossBar::~EndstoneBossBar()
+{
+    if (entt::locator<EndstoneServer>::has_value()) {
+        // waits for the server thread to finish with the bar if it is flushing it
+        auto &server = entt::locator<EndstoneServer>::value();
+        std::lock_guard lock{server.boss_bars_mtx_};
+        std::erase(server.boss_bars_, this);
+    }
+}
+
 std::string EndstoneBossBar::getTitle() const
 {
     return title_;
@@ -30,7 +54,7 @@ void EndstoneBossBar::setTitle(std::string title)
 {
     if (title_ != title) {
         title_ = std::move(title);
-        broadcast(BossEventUpdateType::UpdateName);
+        markDirty(Update::Name);
     }
 }
 
@@ -43,7 +67,7 @@ void EndstoneBossBar::setColor(BarColor color)
 {
     if (color_ != color) {
         color_ = color;
-        broadcast(BossEventUpdateType::UpdateStyle);
+        markDirty(Update::Style);
     }
 }
 
@@ -56,7 +80,7 @@ void EndstoneBossBar::setStyle(BarStyle style)
 {
     if (style_ != style) {
         style_ = style;
-        broadcast(BossEventUpdateType::UpdateStyle);
+        markDirty(Update::Style);
     }
 }
 
@@ -69,7 +93,7 @@ void EndstoneBossBar::addFlag(BarFlag flag)
 {
     if (!hasFlag(flag)) {
         flags_.set(static_cast<int>(flag));
-        broadcast(BossEventUpdateType::UpdateProperties);
+        markDirty(Update::Properties);
     }
 }
 
@@ -77,7 +101,7 @@ void EndstoneBossBar::removeFlag(BarFlag flag)
 {
     if (hasFlag(flag)) {
         flags_.reset(static_cast<int>(flag));
-        broadcast(BossEventUpdateType::UpdateProperties);
+        markDirty(Update::Properties);
     }
 }
 
@@ -93,7 +117,7 @@ Result<void> EndstoneBossBar::setProgress(float progress)
     }
     if (progress_ != progress) {
         progress_ = progress;
-        broadcast(BossEventUpdateType::UpdatePercent);
+        markDirty(Update::Percent);
     }
     return {};
 }
@@ -107,7 +131,8 @@ void EndstoneBossBar::setVisible(bool visible)
 {
     if (visible_ != visible) {
         visible_ = visible;
-        for (const auto &player : getPlayers()) {
+        dirty_ = 0;  // showing the bar sends everything, hiding it makes pending updates moot
+        for (auto *player : players_) {
             send(visible ? BossEventUpdateType::Add : BossEventUpdateType::Remove, *player);
         }
     }
@@ -115,17 +140,22 @@ void EndstoneBossBar::setVisible(bool visible)
 
 void EndstoneBossBar::addPlayer(Player &player)
 {
-    players_.emplace(player.getUniqueId());
+    auto &endstone_player = static_cast<EndstonePlayer &>(player);
+    if (std::ranges::find(players_, &endstone_player) != players_.end()) {
+        return;
+    }
+    players_.push_back(&endstone_player);
     if (visible_) {
-        send(BossEventUpdateType::Add, player);
+        send(BossEventUpdateType::Add, endstone_player);
     }
 }
 
 void EndstoneBossBar::removePlayer(Player &player)
 {
-    players_.erase(player.getUniqueId());
+    auto &endstone_player = static_cast<EndstonePlayer &>(player);
+    std::erase(players_, &endstone_player);
     if (visible_) {
-        send(BossEventUpdateType::Remove, player);
+        send(BossEventUpdateType::Remove, endstone_player);
     }
 }
 
@@ -138,44 +168,77 @@ void EndstoneBossBar::removeAll()
 
 std::vector<Player *> EndstoneBossBar::getPlayers() const
 {
-    std::vector<Player *> players;
-    const auto &server = entt::locator<EndstoneServer>::value();
-    for (auto it = players_.begin(); it != players_.end();) {
-        if (auto *player = server.getPlayer(*it); player) {
-            players.emplace_back(player);
-            ++it;
-        }
-        else {
-            it = players_.erase(it);
+    return {players_.begin(), players_.end()};
+}
+
+void EndstoneBossBar::flush()
+{
+    const auto dirty = std::exchange(dirty_, 0);
+    if (dirty == 0 || !visible_ || players_.empty()) {
+        return;
+    }
+
+    // UpdateProperties carries the color and overlay as well, so a style change rides along with it
+    BossEventUpdateType updates[3];
+    std::size_t count = 0;
+    if (dirty & Update::Name) {
+        updates[count++] = BossEventUpdateType::UpdateName;
+    }
+    if (dirty & Update::Percent) {
+        updates[count++] = BossEventUpdateType::UpdatePercent;
+    }
+    if (dirty & Update::Properties) {
+        updates[count++] = BossEventUpdateType::UpdateProperties;
+    }
+    else if (dirty & Update::Style) {
+        updates[count++] = BossEventUpdateType::UpdateStyle;
+    }
+
+    // one packet for all viewers and updates, only the ids and the type change in between
+    const auto packet = createPacket();
+    const auto pk = std::static_pointer_cast<BossEventPacket>(packet);
+    for (auto *player : players_) {
+        const auto &handle = player->getHandle();
+        pk->boss_id = handle.getOrCreateUniqueID();
+        pk->player_id = pk->boss_id;
+        for (std::size_t i = 0; i < count; ++i) {
+            pk->event_type = updates[i];
+            handle.sendNetworkPacket(*packet);
         }
     }
-    return players;
 }
 
-void EndstoneBossBar::send(BossEventUpdateType event_type, Player &player)
+void EndstoneBossBar::onPlayerQuit(EndstonePlayer &player)
+{
+    std::erase(players_, &player);
+}
+
+void EndstoneBossBar::markDirty(Update update)
 {
-    const auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::BossEvent);
+    dirty_ |= update;
+}
+
+void EndstoneBossBar::send(BossEventUpdateType event_type, EndstonePlayer &player) const
+{
+    const auto packet = createPacket();
     const auto pk = std::static_pointer_cast<BossEventPacket>(packet);
-    const auto &handle = static_cast<EndstonePlayer &>(player).getHandle();
+    const auto &handle = player.getHandle();
     pk->boss_id = handle.getOrCreateUniqueID();
     pk->player_id = handle.getOrCreateUniqueID();
     pk->event_type = event_type;
+    handle.sendNetworkPacket(*packet);
+}
+
+std::shared_ptr<Packet> EndstoneBossBar::createPacket() const
+{
+    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::BossEvent);
+    const auto pk = std::static_pointer_cast<BossEventPacket>(packet);
     pk->name = title_;
     pk->health_percent = progress_;
     pk->color = static_cast<BossBarColor>(color_);
     pk->overlay = static_cast<BossBarOverlay>(style_);
     pk->darken_screen = hasFlag(BarFlag::DarkenSky);
-    handle.sendNetworkPacket(*packet);
-}
-
-void EndstoneBossBar::broadcast(BossEventUpdateType event_type)
-{
-    if (!visible_) {
-        return;
-    }
-    for (const auto &player : getPlayers()) {
-        send(event_type, *player);
-    }
+    return packet;
 }
 
 }  // namespace endstone::core
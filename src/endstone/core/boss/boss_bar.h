@@ -15,25 +15,25 @@
 #pragma once
 
 #include <bitset>
+#include <cstdint>
+#include <memory>
 #include <string>
-#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "bedrock/network/packet/boss_event_packet.h"
 #include "endstone/boss/boss_bar.h"
-#include "endstone/util/uuid.h"
 
 namespace endstone::core {
 
+class EndstonePlayer;
+
 class EndstoneBossBar : public BossBar {
 public:
-    EndstoneBossBar(std::string title, BarColor color, BarStyle style, const std::vector<BarFlag> &flags = {})
-        : title_(std::move(title)), color_(color), style_(style)
-    {
-        for (auto const &flag : flags) {
-            flags_.set(static_cast<int>(flag));
-        }
-    }
+    EndstoneBossBar(std::string title, BarColor color, BarStyle style, const std::vector<BarFlag> &flags = {});
+    ~EndstoneBossBar() override;
+    EndstoneBossBar(EndstoneBossBar const &) = delete;
+    EndstoneBossBar &operator=(EndstoneBossBar const &) = delete;
 
     [[nodiscard]] std::string getTitle() const override;
     void setTitle(std::string title) override;
@@ -53,9 +53,22 @@ public:
     void removeAll() override;
     [[nodiscard]] std::vector<Player *> getPlayers() const override;
 
+    // sends the changes made since the last call to the viewers, called once per tick by the server
+    void flush();
+    void onPlayerQuit(EndstonePlayer &player);
+
 private:
-    void send(BossEventUpdateType event_type, Player &player);
-    void broadcast(BossEventUpdateType event_type);
+    // the kinds of update that are pending, one bit per BossEventUpdateType
+    enum Update : std::uint8_t {
+        Name = 1 << 0,
+        Percent = 1 << 1,
+        Style = 1 << 2,
+        Properties = 1 << 3,
+    };
+
+    void markDirty(Update update);
+    void send(BossEventUpdateType event_type, EndstonePlayer &player) const;
+    [[nodiscard]] std::shared_ptr<Packet> createPacket() const;
 
     std::string title_;
     float progress_{1.0F};
@@ -63,7 +76,8 @@ private:
     BarStyle style_;
     std::bitset<static_cast<int>(BarFlag::Count)> flags_;
     bool visible_{true};
-    mutable std::unordered_set<UUID> players_;
+    std::uint8_t dirty_{0};
+    std::vector<EndstonePlayer *> players_;  // removed by the server when they quit
 };
 
 }  // namespace endstone::core
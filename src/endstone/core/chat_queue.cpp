@@ -0,0 +1,130 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/chat_queue.h"
+
+#include "bedrock/entity/weak_entity_ref.h"
+#include "bedrock/network/packet.h"
+#include "bedrock/network/packet/text_packet.h"
+#include "bedrock/world/events/server_network_events.h"
+#include "endstone/core/player.h"
+#include "endstone/core/plugin/plugin_manager.h"
+#include "endstone/core/scheduler/scheduler.h"
+#include "endstone/core/server.h"
+#include "endstone/event/player/async_player_chat_event.h"
+#include "endstone/event/player/player_chat_event.h"
+
+namespace endstone::core {
+
+ChatQueue::ChatQueue(EndstoneServer &server) : server_(server) {}
+
+bool ChatQueue::chat(EndstonePlayer &player, const ChatEvent &event)
+{
+    // messages vanilla would drop are left to it
+    if (!event.message_valid || player.getHandle().getAbilities().getBool(AbilitiesIndex::Muted)) {
+        return false;
+    }
+
+    if (!pending_.contains(player.getUniqueId())) {
+        auto &plugin_manager = static_cast<EndstonePluginManager &>(server_.getPluginManager());
+        if (!plugin_manager.hasEventHandlers(AsyncPlayerChatEvent::NAME)) {
+            return false;
+        }
+    }
+
+    auto chat = std::make_shared<Chat>();
+    chat->player_name = player.getName();
+    chat->player_unique_id = player.getUniqueId();
+    chat->xuid = player.getXuid();
+    chat->message = event.message;
+    if (event.allow_filtering) {
+        chat->filtered_message = event.filtered_message;
+    }
+
+    // keep the recipients vanilla has chosen, if any
+    if (event.targets.has_value()) {
+        for (const auto &target : event.targets.value()) {
+            if (const auto *recipient = WeakEntityRef(target).tryUnwrap<::Player>(); recipient) {
+                chat->recipients.push_back(recipient->getEndstoneActor<EndstonePlayer>().getUniqueId());
+            }
+        }
+    }
+    else {
+        for (const auto *recipient : server_.getOnlinePlayers()) {
+            chat->recipients.push_back(recipient->getUniqueId());
+        }
+    }
+
+    if (pending_.push(chat)) {
+        submit(chat);
+    }
+    return true;
+}
+
+void ChatQueue::tick()
+{
+    pending_.drain([this](Chat &chat) { deliver(chat); },
+                   [this](const std::shared_ptr<Chat> &chat) { submit(chat); });
+}
+
+void ChatQueue::submit(const std::shared_ptr<Chat> &chat)
+{
+    auto &scheduler = static_cast<EndstoneScheduler &>(server_.getScheduler());
+    scheduler.runAsync([&server = server_, &pending = pending_, chat]() {
+        AsyncPlayerChatEvent e{chat->player_name, chat->player_unique_id, chat->message, chat->recipients};
+        server.getPluginManager().callEvent(e);
+        chat->cancelled = e.isCancelled();
+        if (e.getMessage() != chat->message) {
+            chat->message = e.getMessage();
+            chat->filtered_message.reset();  // no longer matches the message
+        }
+        chat->recipients = e.getRecipients();
+        pending.complete(chat);
+    });
+}
+
+void ChatQueue::deliver(Chat &chat) const
+{
+    // plugins that listen to the synchronous event still get a say, as long as the sender is online
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server_.getPluginManager());
+    if (auto *player = server_.getPlayer(chat.player_unique_id);
+        player && plugin_manager.hasEventHandlers(PlayerChatEvent::NAME)) {
+        PlayerChatEvent e{*player, chat.message};
+        plugin_manager.callEvent(e);
+        if (e.isCancelled()) {
+            return;
+        }
+        if (e.getMessage() != chat.message) {
+            chat.message = e.getMessage();
+            chat.filtered_message.reset();
+        }
+    }
+
+    server_.getLogger().info("<{}> {}", chat.player_name, chat.message);
+
+    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::Text);
+    auto pk = std::static_pointer_cast<TextPacket>(packet);
+    pk->type = TextPacketType::Chat;
+    pk->author = chat.player_name;
+    pk->message = chat.message;
+    pk->filtered_message = chat.filtered_message;
+    pk->xuid = chat.xuid;
+    for (const auto &unique_id : chat.recipients) {
+        if (auto *recipient = server_.getPlayer(unique_id); recipient) {
+            static_cast<EndstonePlayer *>(recipient)->getHandle().sendNetworkPacket(*packet);
+        }
+    }
+}
+
+}  // namespace endstone::core
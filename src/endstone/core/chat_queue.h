@@ -0,0 +1,55 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "endstone/core/pending_chats.h"
+
+struct ChatEvent;
+
+namespace endstone::core {
+
+class EndstonePlayer;
+class EndstoneServer;
+
+/**
+ * Hands chat messages to AsyncPlayerChatEvent on worker threads and delivers them on the server thread once all
+ * handlers have returned. Messages of the same player are delivered in the order they were sent.
+ */
+class ChatQueue {
+public:
+    explicit ChatQueue(EndstoneServer &server);
+
+    /**
+     * Queues a chat message sent by a player. Must be called from the server thread.
+     *
+     * @return true if the message was queued and must not be delivered by the caller
+     */
+    bool chat(EndstonePlayer &player, const ChatEvent &event);
+
+    void tick();
+
+private:
+    using Chat = PendingChats::Chat;
+
+    void submit(const std::shared_ptr<Chat> &chat);
+    void deliver(Chat &chat) const;
+
+    EndstoneServer &server_;
+    PendingChats pending_;
+};
+
+}  // namespace endstone::core
@@ -17,6 +17,7 @@
 #include <entt/entt.hpp>
 
 #include "endstone/color_format.h"
+#include "endstone/core/level/level.h"
 #include "endstone/core/server.h"
 #include "endstone/detail/platform.h"
 
@@ -78,6 +79,13 @@ bool StatusCommand::execute(CommandSender &sender, const std::vector<std::string
     sender.sendMessage("{}Total memory: {}{:.2f} MB", ColorFormat::Gold, ColorFormat::Red,
                        detail::get_total_virtual_memory() / 1024.0F / 1024.0F);
 
+    const auto skins = server.getSkinCache().getUsage();
+    sender.sendMessage("{}Skins: {}{}{} for {}{}{} players, {}{}{} decoded, {}{:.2f} MB", ColorFormat::Gold,  //
+                       ColorFormat::Red, skins.skins, ColorFormat::Gold,                                     //
+                       ColorFormat::Red, skins.players, ColorFormat::Gold,                                   //
+                       ColorFormat::Red, skins.decoded, ColorFormat::Gold,                                   //
+                       ColorFormat::Red, skins.bytes / 1024.0F / 1024.0F);
+
     auto *level = server.getLevel();
     sender.sendMessage("{}Level \"{}\":", ColorFormat::Gold, level->getName());
     auto actors = server.getLevel()->getActors();
@@ -90,10 +98,16 @@ bool StatusCommand::execute(CommandSender &sender, const std::vector<std::string
         }
         sender.sendMessage("- {}Dimension \"{}\": {}{}{} loaded chunks, {}{}{} entities",              //
                            ColorFormat::Gold, dimension->getName(),                                    //
-                           ColorFormat::Red, dimension->getLoadedChunks().size(), ColorFormat::Green,  //
+                           ColorFormat::Red, dimension->getLoadedChunkCount(), ColorFormat::Green,     //
                            ColorFormat::Red, actor_count, ColorFormat::Green);
     }
 
+    auto &actor_merger = static_cast<EndstoneLevel *>(level)->getActorMerger();
+    if (actor_merger.isEnabled()) {
+        sender.sendMessage("{}Actor merging: {}{}{} items and experience orbs merged", ColorFormat::Gold,
+                           ColorFormat::Red, actor_merger.getMergedCount(), ColorFormat::Gold);
+    }
+
     return true;
 }
 
@@ -96,6 +96,10 @@ bool EndstoneBlockGameplayHandler::handleEvent(const BlockTryPlaceByPlayerEvent
 
     const auto &server = entt::locator<EndstoneServer>::value();
     auto &player = entity->getEndstoneActor<EndstonePlayer>();
+    if (server.getLoginQueue().isPending(player)) {
+        return false;
+    }
+
     auto &dimension = player.getDimension();
     auto &block_source = player.getHandle().getDimension().getBlockSourceFromMainChunkSource();
     const auto block_face = static_cast<BlockFace>(event.face);
@@ -146,10 +150,15 @@ bool EndstoneBlockGameplayHandler::handleEvent(BlockTryDestroyByPlayerEvent &eve
 {
     if (const auto *player = WeakEntityRef(event.player).tryUnwrap<::Player>(); player) {
         const auto &server = entt::locator<EndstoneServer>::value();
+        auto &endstone_player = player->getEndstoneActor<EndstonePlayer>();
+        if (server.getLoginQueue().isPending(endstone_player)) {
+            return false;
+        }
+
         auto &block_source = player->getDimension().getBlockSourceFromMainChunkSource();
         const auto block = EndstoneBlock::at(block_source, event.pos);
 
-        BlockBreakEvent e{block, player->getEndstoneActor<EndstonePlayer>()};
+        BlockBreakEvent e{block, endstone_player};
         server.getPluginManager().callEvent(e);
         if (e.isCancelled()) {
             return false;
@@ -24,7 +24,6 @@
 #include "endstone/core/damage/damage_source.h"
 #include "endstone/core/game_mode.h"
 #include "endstone/core/inventory/item_stack.h"
-#include "endstone/core/json.h"
 #include "endstone/core/message.h"
 #include "endstone/core/player.h"
 #include "endstone/core/server.h"
@@ -33,7 +32,6 @@
 #include "endstone/event/player/player_game_mode_change_event.h"
 #include "endstone/event/player/player_interact_actor_event.h"
 #include "endstone/event/player/player_interact_event.h"
-#include "endstone/event/player/player_join_event.h"
 #include "endstone/event/player/player_quit_event.h"
 #include "endstone/event/player/player_respawn_event.h"
 
@@ -153,8 +151,9 @@ bool EndstonePlayerGameplayHandler::handleEvent(const PlayerDisconnectEvent &eve
         }
 
         if (!e.getQuitMessage().empty()) {
+            const auto packet = EndstonePlayer::createTextPacket(tr);
             for (const auto &online_player : server.getOnlinePlayers()) {
-                online_player->sendMessage(tr);
+                static_cast<EndstonePlayer *>(online_player)->getHandle().sendNetworkPacket(*packet);
             }
         }
     }
@@ -182,23 +181,9 @@ bool EndstonePlayerGameplayHandler::handleEvent(const PlayerInitialSpawnEvent &e
     if (auto *player = WeakEntityRef(event.player).tryUnwrap<::Player>(); player) {
         const auto &server = entt::locator<EndstoneServer>::value();
         auto &endstone_player = player->getEndstoneActor<EndstonePlayer>();
-
-        Translatable tr{ColorFormat::Yellow + "%multiplayer.player.joined", {endstone_player.getName()}};
-        const std::string join_message = EndstoneMessage::toString(tr);
-
-        PlayerJoinEvent e{endstone_player, join_message};
-        server.getPluginManager().callEvent(e);
-        if (e.getJoinMessage() != join_message) {
-            tr = Translatable{e.getJoinMessage(), {}};
-        }
-
-        if (!e.getJoinMessage().empty()) {
-            for (const auto &online_player : server.getOnlinePlayers()) {
-                online_player->sendMessage(tr);
-            }
+        if (!server.getLoginQueue().deferJoin(endstone_player)) {
+            endstone_player.join();
         }
-        endstone_player.recalculatePermissions();
-        endstone_player.updateCommands();
     }
     return true;
 }
@@ -227,13 +212,18 @@ bool EndstonePlayerGameplayHandler::handleEvent(const PlayerInteractWithBlockBef
 {
     if (const auto *player = WeakEntityRef(event.player).tryUnwrap<::Player>(); player) {
         const auto &server = entt::locator<EndstoneServer>::value();
+        auto &endstone_player = player->getEndstoneActor<EndstonePlayer>();
+        if (server.getLoginQueue().isPending(endstone_player)) {
+            return false;
+        }
+
         auto &block_source = player->getDimension().getBlockSourceFromMainChunkSource();
         const auto block = EndstoneBlock::at(block_source, BlockPos(event.block_location));
         const std::shared_ptr<EndstoneItemStack> item_stack =
             event.item.isNull() ? nullptr : EndstoneItemStack::fromMinecraft(event.item);
 
         PlayerInteractEvent e{
-            player->getEndstoneActor<EndstonePlayer>(),
+            endstone_player,
             item_stack,
             block,
             static_cast<BlockFace>(event.block_face),
@@ -254,7 +244,12 @@ bool EndstonePlayerGameplayHandler::handleEvent(const PlayerInteractWithEntityBe
 
     if (player && target) {
         const auto &server = entt::locator<EndstoneServer>::value();
-        PlayerInteractActorEvent e{player->getEndstoneActor<EndstonePlayer>(), target->getEndstoneActor()};
+        auto &endstone_player = player->getEndstoneActor<EndstonePlayer>();
+        if (server.getLoginQueue().isPending(endstone_player)) {
+            return false;
+        }
+
+        PlayerInteractActorEvent e{endstone_player, target->getEndstoneActor()};
         server.getPluginManager().callEvent(e);
         if (e.isCancelled()) {
             return false;
@@ -50,7 +50,16 @@ bool EndstoneServerNetworkEventHandler::handleEvent(ChatEvent &event)
 {
     const auto &server = entt::locator<EndstoneServer>::value();
     if (auto *player = WeakEntityRef(event.sender).tryUnwrap<::Player>(); player) {
-        PlayerChatEvent e{player->getEndstoneActor<EndstonePlayer>(), event.message};
+        auto &endstone_player = player->getEndstoneActor<EndstonePlayer>();
+        if (server.getLoginQueue().isPending(endstone_player)) {
+            return false;
+        }
+
+        if (server.getChatQueue().chat(endstone_player, event)) {
+            return false;  // delivered by the chat queue once the async handlers have returned
+        }
+
+        PlayerChatEvent e{endstone_player, event.message};
         server.getPluginManager().callEvent(e);
         if (e.isCancelled()) {
             return false;
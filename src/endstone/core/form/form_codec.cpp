@@ -14,8 +14,12 @@
 
 #include "endstone/core/form/form_codec.h"
 
-#include <nlohmann/json.hpp>
+#include <charconv>
+#include <cmath>
+#include <type_traits>
+#include <vector>
 
+#include "bedrock/deps/json/value.h"
 #include "endstone/form/action_form.h"
 #include "endstone/form/controls/dropdown.h"
 #include "endstone/form/controls/label.h"
@@ -30,177 +34,334 @@
 
 namespace endstone::core {
 
+namespace {
+template <typename T>
+void encodeNumber(std::string &out, T value)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        if (!std::isfinite(value)) {
+            out += "null";
+            return;
+        }
+    }
+    char buffer[32];
+    auto [end, ec] = std::to_chars(std::begin(buffer), std::end(buffer), value);
+    const std::string_view number(buffer, end - buffer);
+    out += number;
+    if constexpr (std::is_floating_point_v<T>) {
+        // keep a decimal point so that the client reads it as a float, as nlohmann::json does
+        if (number.find_first_of(".e") == std::string_view::npos) {
+            out += ".0";
+        }
+    }
+}
+
+void encodeBool(std::string &out, bool value)
+{
+    out += value ? "true" : "false";
+}
+
+void encodeImage(std::string &out, const std::string &icon)
+{
+    if (icon.rfind("http://", 0) == 0 || icon.rfind("https://", 0) == 0) {
+        out += R"({"type":"url","data":)";
+    }
+    else {
+        out += R"({"type":"path","data":)";
+    }
+    FormCodec::encodeString(out, icon);
+    out += '}';
+}
+}  // namespace
+
+void FormCodec::escape(std::string &out, std::string_view value)
+{
+    static constexpr char hex[] = "0123456789abcdef";
+    std::size_t start = 0;  // the characters since start need no escaping
+    for (std::size_t i = 0; i < value.size(); ++i) {
+        const auto c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        out.append(value.data() + start, i - start);
+        start = i + 1;
+        switch (c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\b':
+            out += "\\b";
+            break;
+        case '\f':
+            out += "\\f";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            out += "\\u00";
+            out += hex[c >> 4];
+            out += hex[c & 0xF];
+            break;
+        }
+    }
+    out.append(value.data() + start, value.size() - start);
+}
+
+void FormCodec::encodeString(std::string &out, std::string_view value)
+{
+    out += '"';
+    escape(out, value);
+    out += '"';
+}
+
 template <>
-nlohmann::json FormCodec::toJson(const Message &message)
-{
-    return std::visit(overloaded{[&](const std::string &arg) -> nlohmann::json {
-                                     nlohmann::json json;
-                                     json["rawtext"].push_back({
-                                         {"text", arg},
-                                     });
-                                     return json;
-                                 },
-                                 [&](const Translatable &arg) -> nlohmann::json {
-                                     nlohmann::json json;
-                                     json["rawtext"].push_back({
-                                         {"translate", arg.getText()},
-                                         {"with", arg.getParameters()},
-                                     });
-                                     return json;
-                                 }},
-                      message);
+void FormCodec::encode(std::string &out, const std::vector<std::string> &values)
+{
+    out += '[';
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (i > 0) {
+            out += ',';
+        }
+        encodeString(out, values[i]);
+    }
+    out += ']';
+}
+
+template <>
+void FormCodec::encode(std::string &out, const Message &message)
+{
+    std::visit(overloaded{[&](const std::string &arg) {
+                              out += R"({"rawtext":[{"text":)";
+                              encodeString(out, arg);
+                              out += "}]}";
+                          },
+                          [&](const Translatable &arg) {
+                              out += R"({"rawtext":[{"translate":)";
+                              encodeString(out, arg.getText());
+                              out += R"(,"with":)";
+                              encode(out, arg.getParameters());
+                              out += "}]}";
+                          }},
+               message);
 }
 
 /**
  * Controls
  */
 template <>
-nlohmann::json FormCodec::toJson(const Label &label)
+void FormCodec::encode(std::string &out, const Label &label)
 {
-    nlohmann::json json;
-    json["type"] = "label";
-    json["text"] = toJson(label.getText());
-    return json;
+    out += R"({"type":"label","text":)";
+    encode(out, label.getText());
+    out += '}';
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const Dropdown &dropdown)
+void FormCodec::encode(std::string &out, const Dropdown &dropdown)
 {
-    nlohmann::json json;
-    json["type"] = "dropdown";
-    json["text"] = toJson(dropdown.getLabel());
-    json["options"] = dropdown.getOptions();
+    out += R"({"type":"dropdown","text":)";
+    encode(out, dropdown.getLabel());
+    out += R"(,"options":)";
+    encode(out, dropdown.getOptions());
     if (auto default_index = dropdown.getDefaultIndex()) {
-        json["default"] = default_index.value();
+        out += R"(,"default":)";
+        encodeNumber(out, default_index.value());
     }
-    return json;
+    out += '}';
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const Slider &slider)
-{
-    nlohmann::json json;
-    json["type"] = "slider";
-    json["text"] = toJson(slider.getLabel());
-    json["min"] = slider.getMin();
-    json["max"] = slider.getMax();
-    json["step"] = slider.getStep();
+void FormCodec::encode(std::string &out, const Slider &slider)
+{
+    out += R"({"type":"slider","text":)";
+    encode(out, slider.getLabel());
+    out += R"(,"min":)";
+    encodeNumber(out, slider.getMin());
+    out += R"(,"max":)";
+    encodeNumber(out, slider.getMax());
+    out += R"(,"step":)";
+    encodeNumber(out, slider.getStep());
     if (auto default_value = slider.getDefaultValue()) {
-        json["default"] = default_value.value();
+        out += R"(,"default":)";
+        encodeNumber(out, default_value.value());
     }
-    return json;
+    out += '}';
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const StepSlider &slider)
+void FormCodec::encode(std::string &out, const StepSlider &slider)
 {
-    nlohmann::json json;
-    json["type"] = "step_slider";
-    json["text"] = toJson(slider.getLabel());
-    json["steps"] = slider.getOptions();
+    out += R"({"type":"step_slider","text":)";
+    encode(out, slider.getLabel());
+    out += R"(,"steps":)";
+    encode(out, slider.getOptions());
     if (auto default_index = slider.getDefaultIndex()) {
-        json["default"] = default_index.value();
+        out += R"(,"default":)";
+        encodeNumber(out, default_index.value());
     }
-    return json;
+    out += '}';
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const TextInput &input)
+void FormCodec::encode(std::string &out, const TextInput &input)
 {
-    nlohmann::json json;
-    json["type"] = "input";
-    json["text"] = toJson(input.getLabel());
-    json["placeholder"] = toJson(input.getPlaceholder());
+    out += R"({"type":"input","text":)";
+    encode(out, input.getLabel());
+    out += R"(,"placeholder":)";
+    encode(out, input.getPlaceholder());
     if (auto default_value = input.getDefaultValue()) {
-        json["default"] = default_value.value();
+        out += R"(,"default":)";
+        encodeString(out, default_value.value());
     }
-    return json;
+    out += '}';
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const Toggle &toggle)
+void FormCodec::encode(std::string &out, const Toggle &toggle)
 {
-    nlohmann::json json;
-    json["type"] = "toggle";
-    json["text"] = toJson(toggle.getLabel());
-    json["default"] = toggle.getDefaultValue();
-    return json;
+    out += R"({"type":"toggle","text":)";
+    encode(out, toggle.getLabel());
+    out += R"(,"default":)";
+    encodeBool(out, toggle.getDefaultValue());
+    out += '}';
 }
 
 /**
  * Forms
  */
 template <>
-nlohmann::json FormCodec::toJson(const MessageForm &form)
+void FormCodec::encode(std::string &out, const MessageForm &form)
 {
-    nlohmann::json json;
-    json["type"] = "modal";
-    json["title"] = toJson(form.getTitle());
-    json["content"] = toJson(form.getContent());
-    json["button1"] = toJson(form.getButton1());
-    json["button2"] = toJson(form.getButton2());
-    return json;
+    out += R"({"type":"modal","title":)";
+    encode(out, form.getTitle());
+    out += R"(,"content":)";
+    encode(out, form.getContent());
+    out += R"(,"button1":)";
+    encode(out, form.getButton1());
+    out += R"(,"button2":)";
+    encode(out, form.getButton2());
+    out += '}';
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const ActionForm::Button &button)
+void FormCodec::encode(std::string &out, const ActionForm::Button &button)
 {
-    nlohmann::json json;
-    json["text"] = toJson(button.getText());
+    out += R"({"text":)";
+    encode(out, button.getText());
     if (auto icon = button.getIcon(); icon.has_value()) {
-        if (icon.value().rfind("http://", 0) == 0 || icon.value().rfind("https://", 0) == 0) {
-            json["image"]["type"] = "url";
-        }
-        else {
-            json["image"]["type"] = "path";
-        }
-        json["image"]["data"] = icon.value();
+        out += R"(,"image":)";
+        encodeImage(out, icon.value());
     }
-    return json;
+    out += '}';
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const ActionForm &form)
+void FormCodec::encode(std::string &out, const ActionForm &form)
 {
-    nlohmann::json json;
-    json["type"] = "form";
-    json["title"] = toJson(form.getTitle());
-    json["content"] = toJson(form.getContent());
-    json["buttons"] = nlohmann::json::array();
-    for (const auto &button : form.getButtons()) {
-        json["buttons"].push_back(toJson(button));
+    out += R"({"type":"form","title":)";
+    encode(out, form.getTitle());
+    out += R"(,"content":)";
+    encode(out, form.getContent());
+    out += R"(,"buttons":[)";
+    const auto &buttons = form.getButtons();
+    for (std::size_t i = 0; i < buttons.size(); ++i) {
+        if (i > 0) {
+            out += ',';
+        }
+        encode(out, buttons[i]);
     }
-    return json;
+    out += "]}";
 }
 
 template <>
-nlohmann::json FormCodec::toJson(const ModalForm &form)
+void FormCodec::encode(std::string &out, const ModalForm &form)
 {
-    nlohmann::json json;
-    json["type"] = "custom_form";
-    json["title"] = toJson(form.getTitle());
-    json["content"] = nlohmann::json::array();
-    for (const auto &control : form.getControls()) {
-        json["content"].push_back(std::visit(overloaded{[](auto &&arg) {
-                                                 return toJson(arg);
-                                             }},
-                                             control));
+    out += R"({"type":"custom_form","title":)";
+    encode(out, form.getTitle());
+    out += R"(,"content":[)";
+    const auto controls = form.getControls();
+    for (std::size_t i = 0; i < controls.size(); ++i) {
+        if (i > 0) {
+            out += ',';
+        }
+        std::visit([&out](auto &&arg) { encode(out, arg); }, controls[i]);
     }
+    out += ']';
 
     if (auto submit_button = form.getSubmitButton(); submit_button.has_value()) {
-        json["submit"] = toJson(submit_button.value());
+        out += R"(,"submit":)";
+        encode(out, submit_button.value());
     }
 
     if (auto icon = form.getIcon(); icon.has_value()) {
-        if (icon.value().rfind("http://", 0) == 0 || icon.value().rfind("https://", 0) == 0) {
-            json["icon"]["type"] = "url";
+        out += R"(,"icon":)";
+        encodeImage(out, icon.value());
+    }
+    out += '}';
+}
+
+/**
+ * Responses
+ */
+template <>
+void FormCodec::encode(std::string &out, const Json::Value &value)
+{
+    switch (value.type()) {
+    case Json::intValue:
+        encodeNumber(out, value.asInt64());
+        break;
+    case Json::uintValue:
+        encodeNumber(out, value.asUInt64());
+        break;
+    case Json::realValue:
+        encodeNumber(out, value.asDouble());
+        break;
+    case Json::stringValue:
+        encodeString(out, value.asString());
+        break;
+    case Json::booleanValue:
+        encodeBool(out, value.asBool());
+        break;
+    case Json::arrayValue:
+        out += '[';
+        for (int i = 0; i < static_cast<int>(value.size()); ++i) {
+            if (i > 0) {
+                out += ',';
+            }
+            encode(out, value[i]);
         }
-        else {
-            json["icon"]["type"] = "path";
+        out += ']';
+        break;
+    case Json::objectValue: {
+        out += '{';
+        bool first = true;
+        for (const auto &member : value.getMemberNames()) {
+            if (!first) {
+                out += ',';
+            }
+            first = false;
+            encodeString(out, member);
+            out += ':';
+            encode(out, value[member.c_str()]);
         }
-        json["icon"]["data"] = icon.value();
+        out += '}';
+        break;
+    }
+    case Json::nullValue:
+    default:
+        out += "null";
+        break;
     }
-    return json;
 }
 
 }  // namespace endstone::core
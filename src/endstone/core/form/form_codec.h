@@ -14,13 +14,27 @@
 
 #pragma once
 
-#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
 
 namespace endstone::core {
 
+// Writes forms as JSON text directly, without building a document first
 namespace FormCodec {
 template <typename T>
-nlohmann::json toJson(const T &);
-};
+void encode(std::string &out, const T &value);
+
+template <typename T>
+std::string toJson(const T &value)
+{
+    std::string out;
+    encode(out, value);
+    return out;
+}
+
+// appends the escaped characters of a JSON string, without the quotes
+void escape(std::string &out, std::string_view value);
+void encodeString(std::string &out, std::string_view value);
+};  // namespace FormCodec
 
 }  // namespace endstone::core
@@ -0,0 +1,119 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "endstone/core/form/form_template.h"
+
+#include <algorithm>
+#include <cctype>
+#include <string_view>
+#include <variant>
+
+#include "endstone/core/form/form_codec.h"
+
+namespace endstone::core {
+
+namespace {
+bool isPlaceholderChar(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+}  // namespace
+
+EndstoneFormTemplate::EndstoneFormTemplate(FormVariant form)
+    : form_(std::make_shared<const FormVariant>(std::move(form)))
+{
+    const auto json = std::visit([](const auto &arg) { return FormCodec::toJson(arg); }, *form_);
+
+    // only text can hold a {name}, the braces of JSON objects are followed by a quote or another brace
+    std::size_t start = 0;
+    std::size_t pos = 0;
+    while ((pos = json.find('{', pos)) != std::string::npos) {
+        auto end = pos + 1;
+        while (end < json.size() && isPlaceholderChar(json[end])) {
+            ++end;
+        }
+        if (end == pos + 1 || end == json.size() || json[end] != '}') {
+            ++pos;
+            continue;
+        }
+
+        const std::string_view name(json.data() + pos + 1, end - pos - 1);
+        auto it = std::ranges::find(placeholders_, name);
+        if (it == placeholders_.end()) {
+            it = placeholders_.emplace(placeholders_.end(), name);
+        }
+        segments_.push_back({json.substr(start, pos - start), static_cast<std::size_t>(it - placeholders_.begin())});
+        start = pos = end + 1;
+    }
+    segments_.push_back({json.substr(start), std::string::npos});
+}
+
+std::vector<std::string> EndstoneFormTemplate::getPlaceholders() const
+{
+    return placeholders_;
+}
+
+const std::shared_ptr<const FormTemplate::FormVariant> &EndstoneFormTemplate::getForm() const
+{
+    return form_;
+}
+
+std::string EndstoneFormTemplate::render(const std::unordered_map<std::string, std::string> &values) const
+{
+    if (placeholders_.empty()) {
+        return segments_.front().text;
+    }
+
+    // the same values render the same form, so look them up first
+    key_.clear();
+    for (const auto &name : placeholders_) {
+        if (auto it = values.find(name); it != values.end()) {
+            key_ += std::to_string(it->second.size());
+            key_ += ':';
+            key_ += it->second;
+        }
+        else {
+            key_ += '-';
+        }
+    }
+    if (auto it = renders_.find(key_); it != renders_.end()) {
+        return it->second;
+    }
+
+    std::string json;
+    for (const auto &segment : segments_) {
+        json += segment.text;
+        if (segment.placeholder == std::string::npos) {
+            continue;
+        }
+        const auto &name = placeholders_[segment.placeholder];
+        if (auto it = values.find(name); it != values.end()) {
+            FormCodec::escape(json, it->second);  // we are inside a JSON string already
+        }
+        else {
+            json += '{';
+            json += name;
+            json += '}';
+        }
+    }
+
+    // per-player values would grow the cache without bound
+    if (renders_.size() >= MaxCachedRenders) {
+        renders_.clear();
+    }
+    return renders_.emplace(key_, std::move(json)).first->second;
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,52 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "endstone/form/form_template.h"
+
+namespace endstone::core {
+
+class EndstoneFormTemplate : public FormTemplate {
+public:
+    explicit EndstoneFormTemplate(FormVariant form);
+
+    [[nodiscard]] std::vector<std::string> getPlaceholders() const override;
+
+    [[nodiscard]] const std::shared_ptr<const FormVariant> &getForm() const;
+    [[nodiscard]] std::string render(const std::unordered_map<std::string, std::string> &values) const;
+
+private:
+    // a piece of the serialized form, followed by a placeholder unless it is the last one
+    struct Segment {
+        std::string text;
+        std::size_t placeholder;  // index into placeholders_
+    };
+
+    static constexpr std::size_t MaxCachedRenders = 256;
+
+    std::shared_ptr<const FormVariant> form_;  // shared with the players it was sent to, for the callbacks
+    std::vector<Segment> segments_;
+    std::vector<std::string> placeholders_;
+    mutable std::unordered_map<std::string, std::string> renders_;  // keyed by the values of the placeholders
+    mutable std::string key_;
+};
+
+}  // namespace endstone::core
@@ -14,10 +14,78 @@
 
 #include "endstone/core/inventory/inventory.h"
 
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "endstone/core/inventory/inventory_contents.h"
 #include "endstone/core/inventory/item_stack.h"
 
 namespace endstone::core {
 
+namespace {
+class ContainerSlots {
+public:
+    using Stack = ::ItemStack;
+
+    explicit ContainerSlots(Container &container) : container_(container) {}
+
+    [[nodiscard]] int size() const
+    {
+        return container_.getContainerSize();
+    }
+
+    [[nodiscard]] const ::ItemStack &get(int slot) const
+    {
+        return container_.getItem(slot);
+    }
+
+    void set(int slot, const ::ItemStack &item)
+    {
+        container_.setItemWithForceBalance(slot, item, true);
+    }
+
+    [[nodiscard]] static bool isNull(const ::ItemStack &item)
+    {
+        return item.isNull();
+    }
+
+    [[nodiscard]] static std::string_view getType(const ::ItemStack &item)
+    {
+        return item.getItem()->getFullItemName();
+    }
+
+    [[nodiscard]] static int getCount(const ::ItemStack &item)
+    {
+        return item.getCount();
+    }
+
+    [[nodiscard]] static int getMaxStackSize(const ::ItemStack &item)
+    {
+        return item.getMaxStackSize();
+    }
+
+    [[nodiscard]] static ::ItemStack copy(const ::ItemStack &item, int amount)
+    {
+        ::ItemStack copy{item};
+        copy.set(static_cast<std::uint8_t>(amount));
+        return copy;
+    }
+
+    [[nodiscard]] static std::optional<::ItemStack> create(std::string_view type, int amount)
+    {
+        auto item = EndstoneItemStack::toMinecraft(type, amount);
+        if (item.isNull()) {
+            return std::nullopt;
+        }
+        return item;
+    }
+
+private:
+    Container &container_;
+};
+}  // namespace
+
 EndstoneInventory::EndstoneInventory(Container &container) : container_(container) {}
 
 int EndstoneInventory::getSize() const
@@ -49,17 +117,39 @@ void EndstoneInventory::addItem(ItemStack &item)
 
 std::vector<std::shared_ptr<ItemStack>> EndstoneInventory::getContents() const
 {
-    const auto slots = container_.getSlots();
+    const auto size = getSize();
     std::vector<std::shared_ptr<ItemStack>> contents;
-    for (const auto &slot : slots) {
-        if (slot && !slot->isNull()) {
-            contents.push_back(EndstoneItemStack::fromMinecraft(const_cast<::ItemStack &>(*slot)));
+    contents.reserve(size);
+    for (int i = 0; i < size; ++i) {
+        contents.push_back(EndstoneItemStack::fromMinecraft(container_.getItem(i)));
+    }
+    return contents;
+}
+
+void EndstoneInventory::getContents(std::vector<ItemStackView> &contents) const
+{
+    const auto size = getSize();
+    contents.resize(size);
+    for (int i = 0; i < size; ++i) {
+        const auto &item = container_.getItem(i);
+        if (item.isNull()) {
+            contents[i] = {.slot = i};
         }
         else {
-            contents.push_back(nullptr);
+            contents[i] = {item.getItem()->getFullItemName(), item.getCount(), i};
         }
     }
-    return contents;
+}
+
+Result<void> EndstoneInventory::setContents(std::span<const ItemStackView> contents)
+{
+    ContainerSlots slots{container_};
+    return replace_contents(slots, contents);
+}
+
+void EndstoneInventory::batchUpdate(const std::function<void(Inventory &)> &callback)
+{
+    callback(*this);
 }
 
 int EndstoneInventory::first(ItemStack &item)
@@ -28,6 +28,9 @@ public:
     void setItem(int index, std::shared_ptr<ItemStack> item) override;
     void addItem(ItemStack &item) override;
     [[nodiscard]] std::vector<std::shared_ptr<ItemStack>> getContents() const override;
+    void getContents(std::vector<ItemStackView> &contents) const override;
+    Result<void> setContents(std::span<const ItemStackView> contents) override;
+    void batchUpdate(const std::function<void(Inventory &)> &callback) override;
     [[nodiscard]] int first(ItemStack &item) override;
     [[nodiscard]] bool isEmpty() const override;
     void clear() override;
@@ -0,0 +1,53 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "endstone/core/inventory/inventory_batch.h"
+
+#include <utility>
+
+namespace endstone::core {
+
+InventoryBatch::InventoryBatch(std::function<void()> send) : send_(std::move(send)) {}
+
+void InventoryBatch::run(const std::function<void()> &callback)
+{
+    ++depth_;
+    try {
+        callback();
+    }
+    catch (...) {
+        end();
+        throw;
+    }
+    end();
+}
+
+void InventoryBatch::markDirty()
+{
+    if (depth_ > 0) {
+        dirty_ = true;  // sent once the outermost batch ends
+        return;
+    }
+    send_();
+}
+
+void InventoryBatch::end()
+{
+    if (--depth_ == 0 && std::exchange(dirty_, false)) {
+        send_();
+    }
+}
+
+}  // namespace endstone::core
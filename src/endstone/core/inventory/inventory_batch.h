@@ -0,0 +1,49 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <functional>
+
+namespace endstone::core {
+
+/**
+ * Defers the inventory sync of a player while Inventory::batchUpdate calls are running.
+ *
+ * Batches may be nested, the sync is sent once the outermost batch ends, and only if a change was made.
+ */
+class InventoryBatch {
+public:
+    explicit InventoryBatch(std::function<void()> send);
+
+    /**
+     * Runs the callback as a batch. The sync is still sent if the callback throws.
+     */
+    void run(const std::function<void()> &callback);
+
+    /**
+     * Marks the inventory as changed, sending the sync right away unless a batch is running.
+     */
+    void markDirty();
+
+private:
+    void end();
+
+    std::function<void()> send_;
+    int depth_ = 0;
+    bool dirty_ = false;
+};
+
+}  // namespace endstone::core
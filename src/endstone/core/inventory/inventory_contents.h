@@ -0,0 +1,99 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "endstone/core/util/error.h"
+#include "endstone/inventory/item_stack_view.h"
+#include "endstone/util/result.h"
+
+namespace endstone::core {
+
+/**
+ * Replaces the contents of a container with the given views, as done by Inventory::setContents.
+ *
+ * All the new stacks are built before any slot is written, so views may refer to slots that are overwritten by earlier
+ * ones, and nothing changes if a view is invalid. A view whose source slot still holds items of the same type is
+ * copied from that stack, which keeps the rest of its data. Slots that did not change are not written.
+ *
+ * The container is accessed through Slots, which must provide:
+ * - Stack: the item stack type, default constructed as an empty stack
+ * - size(), get(slot) and set(slot, stack) to read and write the slots
+ * - isNull(stack), getType(stack), getCount(stack) and getMaxStackSize(stack) to inspect a stack
+ * - copy(stack, amount) to copy a stack with another amount
+ * - create(type, amount) to build a new stack, or std::nullopt if the type is unknown
+ */
+template <typename Slots>
+Result<void> replace_contents(Slots &slots, std::span<const ItemStackView> contents)
+{
+    using Stack = typename Slots::Stack;
+
+    const int size = slots.size();
+    if (contents.size() > static_cast<std::size_t>(size)) {
+        return nonstd::make_unexpected(
+            make_error("Invalid inventory contents size ({}). Expected {} or less.", contents.size(), size));
+    }
+
+    const auto invalid_amount = [](const ItemStackView &view, int slot, int max_stack_size) {
+        return nonstd::make_unexpected(make_error("Invalid amount ({}) of {} in slot {}. Expected {} or less.",
+                                                  view.amount, view.type, slot, max_stack_size));
+    };
+
+    std::vector<std::optional<Stack>> items(size);
+    for (int i = 0; i < size; ++i) {
+        const auto view = static_cast<std::size_t>(i) < contents.size() ? contents[i] : ItemStackView{};
+        if (view.isEmpty()) {
+            if (!slots.isNull(slots.get(i))) {
+                items[i].emplace();
+            }
+            continue;
+        }
+
+        if (view.slot >= 0 && view.slot < size) {
+            if (const auto &source = slots.get(view.slot);
+                !slots.isNull(source) && slots.getType(source) == view.type) {
+                if (view.amount > slots.getMaxStackSize(source)) {
+                    return invalid_amount(view, i, slots.getMaxStackSize(source));
+                }
+                if (view.slot == i && slots.getCount(source) == view.amount) {
+                    continue;  // unchanged
+                }
+                items[i] = slots.copy(source, view.amount);
+                continue;
+            }
+        }
+
+        items[i] = slots.create(view.type, view.amount);
+        if (!items[i].has_value()) {
+            return nonstd::make_unexpected(make_error("Unknown item type: {}", view.type));
+        }
+        if (view.amount > slots.getMaxStackSize(*items[i])) {
+            return invalid_amount(view, i, slots.getMaxStackSize(*items[i]));
+        }
+    }
+
+    for (int i = 0; i < size; ++i) {
+        if (items[i].has_value()) {
+            slots.set(i, *items[i]);
+        }
+    }
+    return {};
+}
+
+}  // namespace endstone::core
@@ -14,6 +14,10 @@
 
 #include "endstone/core/inventory/item_stack.h"
 
+#include <entt/entt.hpp>
+
+#include "endstone/core/server.h"
+
 namespace endstone::core {
 
 EndstoneItemStack::EndstoneItemStack(const ::ItemStack &item)
@@ -67,7 +71,16 @@ void EndstoneItemStack::setAmount(int amount)
         }
         return {};  // Empty item stack
     }
-    return ::ItemStack(item->getType(), item->getAmount());  // TODO(item): support item nbt data
+    return toMinecraft(item->getType(), item->getAmount());  // TODO(item): support item nbt data
+}
+
+::ItemStack EndstoneItemStack::toMinecraft(std::string_view type, int amount)
+{
+    const auto entry = entt::locator<EndstoneServer>::value().getItemTypeCache().get(type);
+    if (!entry.found) {
+        return {};  // Empty item stack
+    }
+    return ::ItemStack(*entry.item, amount, entry.aux);
 }
 
 std::shared_ptr<EndstoneItemStack> EndstoneItemStack::fromMinecraft(const ::ItemStack &item)
@@ -29,6 +29,7 @@ public:
     void setAmount(int amount) override;
 
     static ::ItemStack toMinecraft(const std::shared_ptr<ItemStack> &item);
+    static ::ItemStack toMinecraft(std::string_view type, int amount);
     static std::shared_ptr<EndstoneItemStack> fromMinecraft(const ::ItemStack &item);
 
 protected:
@@ -0,0 +1,41 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "endstone/core/inventory/item_type_cache.h"
+
+#include "bedrock/world/item/registry/item_registry_manager.h"
+
+namespace endstone::core {
+
+ItemTypeCache::Entry ItemTypeCache::get(std::string_view name)
+{
+    return get(name, [](int &aux, std::string_view n) {
+        return ItemRegistryManager::getItemRegistry().lookupByName(aux, n);
+    });
+}
+
+void ItemTypeCache::clear()
+{
+    std::unique_lock lock{mutex_};
+    entries_.clear();
+}
+
+std::size_t ItemTypeCache::size() const
+{
+    std::shared_lock lock{mutex_};
+    return entries_.size();
+}
+
+}  // namespace endstone::core
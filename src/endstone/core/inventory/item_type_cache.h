@@ -0,0 +1,95 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "bedrock/shared_ptr.h"
+
+class Item;
+
+namespace endstone::core {
+
+/**
+ * Caches the items of the item registry by their type name.
+ *
+ * Looking an item up by name locks the registry and parses the name, which is worth skipping when the same few types
+ * are converted over and over. Unknown names are cached too. An entry whose item has since been removed from the
+ * registry is looked up again.
+ */
+class ItemTypeCache {
+public:
+    struct Entry {
+        WeakPtr<Item> item;
+        int aux = 0;
+        bool found = false;
+    };
+
+    /**
+     * Returns the cached item for the name, or calls resolve(aux, name) and caches the item it returns.
+     */
+    template <typename Resolve>
+    Entry get(std::string_view name, Resolve &&resolve)
+    {
+        {
+            std::shared_lock lock{mutex_};
+            if (const auto it = entries_.find(name); it != entries_.end()) {
+                if (!it->second.found || !it->second.item.isNull()) {
+                    return it->second;
+                }
+            }
+        }
+        Entry entry;
+        entry.item = resolve(entry.aux, name);
+        entry.found = !entry.item.isNull();
+        std::unique_lock lock{mutex_};
+        if (entries_.size() >= MaxSize) {
+            entries_.clear();
+        }
+        entries_.insert_or_assign(std::string(name), entry);
+        return entry;
+    }
+
+    /**
+     * Returns the cached item for the name, looking it up in the item registry of the level on a miss.
+     */
+    Entry get(std::string_view name);
+
+    void clear();
+    [[nodiscard]] std::size_t size() const;
+
+    static constexpr std::size_t MaxSize = 8192;
+
+private:
+    struct NameHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view name) const
+        {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, Entry, NameHash, std::equal_to<>> entries_;
+};
+
+}  // namespace endstone::core
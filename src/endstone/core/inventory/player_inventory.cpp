@@ -34,13 +34,13 @@ std::shared_ptr<ItemStack> EndstonePlayerInventory::getItem(int index) const
 void EndstonePlayerInventory::setItem(int index, std::shared_ptr<ItemStack> item)
 {
     EndstoneInventory::setItem(index, item);
-    holder_.sendInventory(false);
+    sendInventory();
 }
 
 void EndstonePlayerInventory::addItem(ItemStack &item)
 {
     EndstoneInventory::addItem(item);
-    holder_.sendInventory(false);
+    sendInventory();
 }
 
 std::vector<std::shared_ptr<ItemStack>> EndstonePlayerInventory::getContents() const
@@ -48,6 +48,25 @@ std::vector<std::shared_ptr<ItemStack>> EndstonePlayerInventory::getContents() c
     return EndstoneInventory::getContents();
 }
 
+void EndstonePlayerInventory::getContents(std::vector<ItemStackView> &contents) const
+{
+    EndstoneInventory::getContents(contents);
+}
+
+Result<void> EndstonePlayerInventory::setContents(std::span<const ItemStackView> contents)
+{
+    auto result = EndstoneInventory::setContents(contents);
+    if (result) {
+        sendInventory();
+    }
+    return result;
+}
+
+void EndstonePlayerInventory::batchUpdate(const std::function<void(Inventory &)> &callback)
+{
+    batch_.run([&] { callback(static_cast<PlayerInventory &>(*this)); });
+}
+
 int EndstonePlayerInventory::first(ItemStack &item)
 {
     return EndstoneInventory::first(item);
@@ -61,7 +80,12 @@ bool EndstonePlayerInventory::isEmpty() const
 void EndstonePlayerInventory::clear()
 {
     EndstoneInventory::clear();
-    holder_.sendInventory(false);
+    sendInventory();
+}
+
+void EndstonePlayerInventory::sendInventory()
+{
+    batch_.markDirty();
 }
 
 }  // namespace endstone::core
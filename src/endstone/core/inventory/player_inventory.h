@@ -16,13 +16,17 @@
 
 #include "bedrock/world/actor/player/player.h"
 #include "endstone/core/inventory/inventory.h"
+#include "endstone/core/inventory/inventory_batch.h"
 #include "endstone/inventory/player_inventory.h"
 
 namespace endstone::core {
 
 class EndstonePlayerInventory : public EndstoneInventory, public PlayerInventory {
 public:
-    explicit EndstonePlayerInventory(::Player &holder) : EndstoneInventory(holder.getInventory()), holder_(holder){};
+    explicit EndstonePlayerInventory(::Player &holder)
+        : EndstoneInventory(holder.getInventory()), holder_(holder), batch_([this] { holder_.sendInventory(false); })
+    {
+    }
 
     [[nodiscard]] int getSize() const override;
     [[nodiscard]] int getMaxStackSize() const override;
@@ -30,12 +34,18 @@ public:
     void setItem(int index, std::shared_ptr<ItemStack> item) override;
     void addItem(ItemStack &item) override;
     [[nodiscard]] std::vector<std::shared_ptr<ItemStack>> getContents() const override;
+    void getContents(std::vector<ItemStackView> &contents) const override;
+    Result<void> setContents(std::span<const ItemStackView> contents) override;
+    void batchUpdate(const std::function<void(Inventory &)> &callback) override;
     [[nodiscard]] int first(ItemStack &item) override;
     [[nodiscard]] bool isEmpty() const override;
     void clear() override;
 
 private:
+    void sendInventory();
+
     ::Player &holder_;
+    InventoryBatch batch_;
 };
 
 }  // namespace endstone::core
@@ -14,38 +14,42 @@
 
 #include "endstone/core/lang/language.h"
 
+#include <utility>
+
 #include "bedrock/locale/i18n.h"
 
 namespace endstone::core {
 
 std::string EndstoneLanguage::translate(std::string text) const
 {
-    return translate(text, getLocale());
+    return translate(std::move(text), getLocale());
 }
 
 std::string EndstoneLanguage::translate(std::string text, std::string locale) const
 {
-    return translate(text, {}, locale);
+    return translate(std::move(text), {}, std::move(locale));
 }
 
 std::string EndstoneLanguage::translate(std::string text, std::vector<std::string> params) const
 {
-    return translate(text, params, getLocale());
+    return translate(std::move(text), std::move(params), getLocale());
 }
 
 std::string EndstoneLanguage::translate(std::string text, std::vector<std::string> params, std::string locale) const
 {
-    auto &i18n = getI18n();
-    auto localization = i18n.getLocaleFor(locale);
-    if (!localization) {
-        localization = i18n.getLocaleFor(getLocale());
-    }
-    return i18n.get(text, params, localization);
+    return cache_.get(locale, text, params, [&] {
+        auto &i18n = getI18n();
+        auto localization = i18n.getLocaleFor(locale);
+        if (!localization) {
+            localization = i18n.getLocaleFor(getLocale());
+        }
+        return i18n.get(text, params, localization);
+    });
 }
 
 std::string EndstoneLanguage::translate(Translatable translatable) const
 {
-    return translate(translatable, getLocale());
+    return translate(std::move(translatable), getLocale());
 }
 
 std::string EndstoneLanguage::translate(Translatable translatable, std::string locale) const
@@ -58,4 +62,9 @@ std::string EndstoneLanguage::getLocale() const
     return getI18n().getCurrentLanguage()->getLanguageCode();
 }
 
+void EndstoneLanguage::clearCache() const
+{
+    cache_.clear();
+}
+
 }  // namespace endstone::core
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "endstone/core/lang/translation_cache.h"
 #include "endstone/lang/language.h"
 
 namespace endstone::core {
@@ -29,7 +30,15 @@ public:
     [[nodiscard]] std::string translate(Translatable translatable, std::string locale) const override;
     [[nodiscard]] std::string getLocale() const override;
 
+    /**
+     * Drops all cached translations, e.g. after the language packs were reloaded.
+     */
+    void clearCache() const;
+
     inline const static std::string FallbackLocale = "en_US";
+
+private:
+    mutable TranslationCache cache_;
 };
 
 }  // namespace endstone::core
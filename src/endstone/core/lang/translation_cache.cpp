@@ -0,0 +1,80 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "endstone/core/lang/translation_cache.h"
+
+namespace endstone::core {
+
+void TranslationCache::clear()
+{
+    std::scoped_lock lock{mutex_};
+    current_.clear();
+    previous_.clear();
+}
+
+std::size_t TranslationCache::size() const
+{
+    std::scoped_lock lock{mutex_};
+    return current_.size() + previous_.size();
+}
+
+std::size_t TranslationCache::hash(std::string_view locale, std::string_view text,
+                                   const std::vector<std::string> &params)
+{
+    constexpr std::hash<std::string_view> hasher;
+    auto seed = hasher(locale);
+    const auto combine = [&seed](std::size_t value) {
+        seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    };
+    combine(hasher(text));
+    for (const auto &param : params) {
+        combine(hasher(param));
+    }
+    return seed;
+}
+
+const std::string *TranslationCache::find(const KeyView &key)
+{
+    if (auto it = current_.find(key); it != current_.end()) {
+        return &it->second;
+    }
+    auto it = previous_.find(key);
+    if (it == previous_.end()) {
+        return nullptr;
+    }
+    // still in use, move it to the current generation
+    if (current_.size() >= capacity_) {
+        auto node = previous_.extract(it);
+        rotate();
+        return &current_.insert(std::move(node)).position->second;
+    }
+    return &current_.insert(previous_.extract(it)).position->second;
+}
+
+void TranslationCache::insert(const KeyView &key, std::string value)
+{
+    if (current_.size() >= capacity_) {
+        rotate();
+    }
+    current_.try_emplace(Key{std::string(key.locale), std::string(key.text), key.params, key.hash}, std::move(value));
+}
+
+void TranslationCache::rotate()
+{
+    previous_ = std::move(current_);
+    current_.clear();
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,108 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace endstone::core {
+
+/**
+ * Caches translated strings by locale, key and parameters.
+ *
+ * Entries live in two generations. Once the current one is full it becomes the previous one, and entries that are used
+ * again are moved back, so the cache holds at most twice its capacity and drops what has not been used for a while.
+ */
+class TranslationCache {
+public:
+    explicit TranslationCache(std::size_t capacity = DefaultCapacity) : capacity_(capacity) {}
+
+    /**
+     * Returns the cached translation, or calls render() and caches what it returns.
+     */
+    template <typename Render>
+    std::string get(std::string_view locale, std::string_view text, const std::vector<std::string> &params,
+                     Render &&render)
+    {
+        const KeyView key{locale, text, params, hash(locale, text, params)};
+        {
+            std::scoped_lock lock{mutex_};
+            if (const auto *value = find(key)) {
+                return *value;
+            }
+        }
+        // rendered without the lock, as translating may take a while
+        std::string value = render();
+        std::scoped_lock lock{mutex_};
+        insert(key, value);
+        return value;
+    }
+
+    void clear();
+    [[nodiscard]] std::size_t size() const;
+
+    static constexpr std::size_t DefaultCapacity = 4096;
+
+private:
+    struct Key {
+        std::string locale;
+        std::string text;
+        std::vector<std::string> params;
+        std::size_t hash;
+    };
+    struct KeyView {
+        std::string_view locale;
+        std::string_view text;
+        const std::vector<std::string> &params;
+        std::size_t hash;
+    };
+    struct KeyHash {
+        using is_transparent = void;
+        std::size_t operator()(const Key &key) const
+        {
+            return key.hash;
+        }
+        std::size_t operator()(const KeyView &key) const
+        {
+            return key.hash;
+        }
+    };
+    struct KeyEqual {
+        using is_transparent = void;
+        template <typename A, typename B>
+        bool operator()(const A &a, const B &b) const
+        {
+            return a.hash == b.hash && a.locale == b.locale && a.text == b.text && a.params == b.params;
+        }
+    };
+    using Map = std::unordered_map<Key, std::string, KeyHash, KeyEqual>;
+
+    static std::size_t hash(std::string_view locale, std::string_view text, const std::vector<std::string> &params);
+    const std::string *find(const KeyView &key);
+    void insert(const KeyView &key, std::string value);
+    void rotate();
+
+    mutable std::mutex mutex_;
+    std::size_t capacity_;
+    Map current_;
+    Map previous_;
+};
+
+}  // namespace endstone::core
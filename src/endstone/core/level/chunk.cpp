@@ -14,8 +14,13 @@
 
 #include "endstone/core/level/chunk.h"
 
+#include <unordered_map>
+
+#include <bedrock/world/level/block/bedrock_block_names.h>
 #include <bedrock/world/level/dimension/dimension.h>
+#include <endstone/core/block/block_data.h>
 #include <endstone/core/server.h>
+#include <endstone/core/util/error.h>
 
 namespace endstone::core {
 
@@ -45,4 +50,58 @@ Dimension &EndstoneChunk::getDimension() const
     return dimension_.getEndstoneDimension();
 }
 
+Result<std::shared_ptr<ChunkSnapshot>> EndstoneChunk::getSnapshot() const
+{
+    const auto &server = entt::locator<EndstoneServer>::value();
+    if (!server.isPrimaryThread()) {
+        return nonstd::make_unexpected(make_error("Chunk snapshots can only be taken on the server thread."));
+    }
+
+    auto &block_source = dimension_.getBlockSourceFromMainChunkSource();
+    const auto *chunk = block_source.getChunk(x_, z_);
+    if (!chunk || chunk->getState() < ChunkState::Loaded) {
+        return nonstd::make_unexpected(make_error("Chunk ({}, {}) is not loaded.", x_, z_));
+    }
+
+    constexpr int width = ChunkSnapshot::Width;
+    const int min_height = block_source.getMinHeight();
+    const int max_height = block_source.getMaxHeight();
+    const int base_x = x_ * width;
+    const int base_z = z_ * width;
+
+    std::vector<std::shared_ptr<BlockData>> palette;
+    std::vector<bool> is_air;
+    std::unordered_map<const ::Block *, std::uint16_t> indices;
+    std::vector<std::uint16_t> blocks(static_cast<std::size_t>(max_height - min_height) * width * width);
+    std::vector<std::int16_t> heightmap(width * width, static_cast<std::int16_t>(min_height - 1));
+
+    // Blocks are mostly laid out in long runs of the same permutation, so remember the last one to skip the lookup.
+    const ::Block *last_block = nullptr;
+    std::uint16_t last_index = 0;
+    auto it = blocks.begin();
+    for (auto y = min_height; y < max_height; ++y) {
+        for (auto z = 0; z < width; ++z) {
+            for (auto x = 0; x < width; ++x) {
+                const auto &block = block_source.getBlock(base_x + x, y, base_z + z);
+                if (&block != last_block) {
+                    auto [pos, inserted] = indices.try_emplace(&block, static_cast<std::uint16_t>(palette.size()));
+                    if (inserted) {
+                        palette.emplace_back(std::make_shared<EndstoneBlockData>(const_cast<::Block &>(block)));
+                        is_air.push_back(block.getName() == BedrockBlockNames::Air);
+                    }
+                    last_block = &block;
+                    last_index = pos->second;
+                }
+                *it++ = last_index;
+                if (!is_air[last_index]) {
+                    heightmap[z * width + x] = static_cast<std::int16_t>(y);
+                }
+            }
+        }
+    }
+
+    return std::make_shared<ChunkSnapshot>(x_, z_, min_height, max_height, std::move(palette), std::move(blocks),
+                                           std::move(heightmap));
+}
+
 }  // namespace endstone::core
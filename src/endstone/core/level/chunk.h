@@ -26,6 +26,7 @@ public:
     [[nodiscard]] int getZ() const override;
     [[nodiscard]] Level &getLevel() const override;
     [[nodiscard]] Dimension &getDimension() const override;
+    [[nodiscard]] Result<std::shared_ptr<ChunkSnapshot>> getSnapshot() const override;
 
 private:
     ::Dimension &dimension_;
@@ -80,15 +80,34 @@ std::shared_ptr<Block> EndstoneDimension::getHighestBlockAt(Location location) c
 std::vector<std::unique_ptr<Chunk>> EndstoneDimension::getLoadedChunks()
 {
     std::vector<std::unique_ptr<Chunk>> chunks;
+    forEachLoadedChunk([&chunks](Chunk &chunk) {
+        chunks.emplace_back(std::make_unique<EndstoneChunk>(static_cast<EndstoneChunk &>(chunk)));
+    });
+    return chunks;
+}
+
+void EndstoneDimension::forEachLoadedChunk(const std::function<void(Chunk &)> &visitor)
+{
     for (const auto &[pos, weak_lc] : dimension_.getChunkSource().getStorage()) {
         if (weak_lc.expired()) {
             continue;
         }
         if (auto chunk = weak_lc.lock(); chunk && chunk->getState() >= ChunkState::Loaded) {
-            chunks.emplace_back(std::make_unique<EndstoneChunk>(*chunk));
+            EndstoneChunk endstone_chunk(*chunk);
+            visitor(endstone_chunk);
         }
     }
-    return chunks;
+}
+
+int EndstoneDimension::getLoadedChunkCount() const
+{
+    int count = 0;
+    for (const auto &[pos, weak_lc] : dimension_.getChunkSource().getStorage()) {
+        if (auto chunk = weak_lc.lock(); chunk && chunk->getState() >= ChunkState::Loaded) {
+            ++count;
+        }
+    }
+    return count;
 }
 
 ::Dimension &EndstoneDimension::getHandle() const
@@ -34,6 +34,8 @@ public:
     [[nodiscard]] std::shared_ptr<Block> getHighestBlockAt(int x, int z) const override;
     [[nodiscard]] std::shared_ptr<Block> getHighestBlockAt(Location location) const override;
     [[nodiscard]] std::vector<std::unique_ptr<Chunk>> getLoadedChunks() override;
+    void forEachLoadedChunk(const std::function<void(Chunk &)> &visitor) override;
+    [[nodiscard]] int getLoadedChunkCount() const override;
 
     [[nodiscard]] ::Dimension &getHandle() const;
 
@@ -18,6 +18,8 @@
 #include <magic_enum/magic_enum.hpp>
 
 #include "bedrock/core/utility/automatic_id.h"
+#include "bedrock/entity/components/offsets_component.h"
+#include "bedrock/entity/components/post_tick_position_delta_component.h"
 #include "bedrock/entity/gamerefs_entity/gamerefs_entity.h"
 #include "bedrock/world/level/dimension/dimension.h"
 #include "bedrock/world/level/dimension/vanilla_dimensions.h"
@@ -63,6 +65,131 @@ std::vector<Actor *> EndstoneLevel::getActors() const
     return result;
 }
 
+void EndstoneLevel::snapshotActors(ActorSnapshot &snapshot, ActorSnapshot::Fields fields,
+                                   const ActorSnapshot::Filter &filter) const
+{
+    snapshot.reset(fields);
+
+    const auto &entities = level_.getEntities();
+    snapshot.reserve(entities.size());
+
+    ::Dimension *dimension = nullptr;
+    if (filter.dimension) {
+        dimension = &static_cast<EndstoneDimension *>(filter.dimension)->getHandle();
+    }
+
+    for (const auto &entity : entities) {
+        if (!entity.hasValue()) {
+            continue;
+        }
+        const auto *actor = ::Actor::tryGetFromEntity(*entity, false);
+        if (!actor) {
+            continue;
+        }
+        if (&actor->getLevel() != &level_) {
+            continue;
+        }
+        if (dimension && &actor->getDimension() != dimension) {
+            continue;
+        }
+        if (filter.players_only && !actor->isPlayer()) {
+            continue;
+        }
+        if (!filter.type.empty() && actor->getActorIdentifier().getCanonicalName() != filter.type) {
+            continue;
+        }
+
+        float position[3] = {};
+        if (snapshot.has(ActorSnapshot::Positions)) {
+            const auto &pos = actor->getPosition();
+            position[0] = pos.x;
+            position[1] = pos.y - actor->getPersistentComponent<OffsetsComponent>()->height_offset;
+            position[2] = pos.z;
+        }
+
+        float velocity[3] = {};
+        if (snapshot.has(ActorSnapshot::Velocities)) {
+            // Keep in sync with EndstoneActor::getVelocity
+            const Vec3 *delta = &actor->getPosDelta();
+            if (actor->hasCategory(ActorCategory::Mob) || actor->hasCategory(ActorCategory::Ridable)) {
+                const auto *vehicle = actor->getVehicle();
+                if (!vehicle) {
+                    vehicle = actor;
+                }
+                if (const auto *component = vehicle->tryGetComponent<PostTickPositionDeltaComponent>(); component) {
+                    delta = &component->value;
+                }
+            }
+            velocity[0] = delta->x;
+            velocity[1] = delta->y;
+            velocity[2] = delta->z;
+        }
+
+        float rotation[2] = {};
+        if (snapshot.has(ActorSnapshot::Rotations)) {
+            const auto &rot = actor->getRotation();
+            rotation[0] = rot.x;
+            rotation[1] = rot.y;
+        }
+
+        std::int32_t dimension_id = 0;
+        if (snapshot.has(ActorSnapshot::DimensionIds)) {
+            dimension_id = actor->getDimension().getDimensionId().runtime_id;
+        }
+
+        ActorSnapshot::Flag flags = 0;
+        if (snapshot.has(ActorSnapshot::Flags)) {
+            flags |= actor->isOnGround() ? ActorSnapshot::OnGround : 0;
+            flags |= actor->isInWater() ? ActorSnapshot::InWater : 0;
+            flags |= actor->isInLava() ? ActorSnapshot::InLava : 0;
+            flags |= actor->isAlive() ? 0 : ActorSnapshot::Dead;
+            flags |= actor->isPlayer() ? ActorSnapshot::IsPlayer : 0;
+        }
+
+        snapshot.add(actor->getRuntimeID().raw_id, position, velocity, rotation, dimension_id, flags);
+    }
+}
+
+float EndstoneLevel::getItemMergeRadius() const
+{
+    return actor_merger_.getItemMergeRadius();
+}
+
+Result<void> EndstoneLevel::setItemMergeRadius(float radius)
+{
+    return actor_merger_.setItemMergeRadius(radius);
+}
+
+float EndstoneLevel::getExperienceMergeRadius() const
+{
+    return actor_merger_.getExperienceMergeRadius();
+}
+
+Result<void> EndstoneLevel::setExperienceMergeRadius(float radius)
+{
+    return actor_merger_.setExperienceMergeRadius(radius);
+}
+
+int EndstoneLevel::getMergeInterval() const
+{
+    return actor_merger_.getMergeInterval();
+}
+
+Result<void> EndstoneLevel::setMergeInterval(int interval)
+{
+    return actor_merger_.setMergeInterval(interval);
+}
+
+int EndstoneLevel::getMergeBudget() const
+{
+    return actor_merger_.getMergeBudget();
+}
+
+Result<void> EndstoneLevel::setMergeBudget(int budget)
+{
+    return actor_merger_.setMergeBudget(budget);
+}
+
 int EndstoneLevel::getTime() const
 {
     return level_.getTime();
@@ -118,4 +245,14 @@ EndstoneServer &EndstoneLevel::getServer() const
     return level_;
 }
 
+ActorMerger &EndstoneLevel::getActorMerger()
+{
+    return actor_merger_;
+}
+
+void EndstoneLevel::tick(std::uint64_t current_tick)
+{
+    actor_merger_.tick(level_, current_tick);
+}
+
 };  // namespace endstone::core
@@ -18,6 +18,7 @@
 
 #include "bedrock/world/level/dimension/dimension.h"
 #include "bedrock/world/level/level.h"
+#include "endstone/core/actor/actor_merger.h"
 #include "endstone/actor/actor.h"
 #include "endstone/level/dimension.h"
 #include "endstone/level/level.h"
@@ -33,6 +34,16 @@ public:
 
     [[nodiscard]] std::string getName() const override;
     [[nodiscard]] std::vector<Actor *> getActors() const override;
+    void snapshotActors(ActorSnapshot &snapshot, ActorSnapshot::Fields fields,
+                        const ActorSnapshot::Filter &filter) const override;
+    [[nodiscard]] float getItemMergeRadius() const override;
+    Result<void> setItemMergeRadius(float radius) override;
+    [[nodiscard]] float getExperienceMergeRadius() const override;
+    Result<void> setExperienceMergeRadius(float radius) override;
+    [[nodiscard]] int getMergeInterval() const override;
+    Result<void> setMergeInterval(int interval) override;
+    [[nodiscard]] int getMergeBudget() const override;
+    Result<void> setMergeBudget(int budget) override;
     [[nodiscard]] int getTime() const override;
     void setTime(int time) override;
     [[nodiscard]] std::vector<Dimension *> getDimensions() const override;
@@ -41,11 +52,14 @@ public:
 
     [[nodiscard]] EndstoneServer &getServer() const;
     [[nodiscard]] ::Level &getHandle() const;
+    [[nodiscard]] ActorMerger &getActorMerger();
+    void tick(std::uint64_t current_tick);
 
 private:
     EndstoneServer &server_;
     ::Level &level_;
     std::unordered_map<std::string, std::unique_ptr<Dimension>> dimensions_;
+    ActorMerger actor_merger_;
 };
 
 }  // namespace endstone::core
@@ -0,0 +1,100 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "endstone/core/login_queue.h"
+
+#include "endstone/core/player.h"
+#include "endstone/core/plugin/plugin_manager.h"
+#include "endstone/core/scheduler/scheduler.h"
+#include "endstone/core/server.h"
+#include "endstone/event/player/async_player_pre_login_event.h"
+#include "endstone/event/player/player_login_event.h"
+
+namespace endstone::core {
+
+LoginQueue::LoginQueue(EndstoneServer &server) : server_(server) {}
+
+void LoginQueue::login(EndstonePlayer &player)
+{
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server_.getPluginManager());
+    if (!plugin_manager.hasEventHandlers(AsyncPlayerPreLoginEvent::NAME)) {
+        completeLogin(player, false);
+        return;
+    }
+
+    auto outcome = pending_.add(player.getUniqueId(), PendingLogins::Clock::now() + Timeout);
+    auto &scheduler = static_cast<EndstoneScheduler &>(server_.getScheduler());
+    scheduler.runAsync([&server = server_, outcome, name = player.getName(), unique_id = player.getUniqueId(),
+                        xuid = player.getXuid(), address = player.getAddress()]() {
+        AsyncPlayerPreLoginEvent e{name, unique_id, xuid, address};
+        server.getPluginManager().callEvent(e);
+        outcome->complete(e.isCancelled(), e.getKickMessage());
+    });
+}
+
+bool LoginQueue::deferJoin(const EndstonePlayer &player)
+{
+    return pending_.deferJoin(player.getUniqueId());
+}
+
+bool LoginQueue::isPending(const Player &player) const
+{
+    return !pending_.empty() && pending_.contains(player.getUniqueId());
+}
+
+void LoginQueue::tick()
+{
+    if (pending_.empty()) {
+        return;
+    }
+
+    for (const auto &resolution : pending_.poll(PendingLogins::Clock::now())) {
+        // the player may have disconnected in the meantime
+        auto *player = static_cast<EndstonePlayer *>(server_.getPlayer(resolution.unique_id));
+        if (!player) {
+            continue;
+        }
+
+        switch (resolution.result) {
+        case PendingLogins::Result::Allowed:
+            completeLogin(*player, resolution.join_deferred);
+            break;
+        case PendingLogins::Result::Denied:
+            player->kick(resolution.kick_message);
+            break;
+        case PendingLogins::Result::TimedOut:
+            server_.getLogger().warning("Login of {} timed out after {} seconds.", player->getName(), Timeout.count());
+            player->kick("Timed out while logging in.");
+            break;
+        }
+    }
+}
+
+void LoginQueue::completeLogin(EndstonePlayer &player, bool join_deferred) const
+{
+    PlayerLoginEvent e{player};
+    server_.getPluginManager().callEvent(e);
+
+    if (e.isCancelled()) {
+        player.kick(e.getKickMessage());
+        return;
+    }
+
+    if (join_deferred) {
+        player.join();
+    }
+}
+
+}  // namespace endstone::core
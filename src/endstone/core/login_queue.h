@@ -0,0 +1,68 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <chrono>
+
+#include "endstone/core/pending_logins.h"
+
+namespace endstone {
+class Player;
+}  // namespace endstone
+
+namespace endstone::core {
+
+class EndstonePlayer;
+class EndstoneServer;
+
+/**
+ * Holds the logins of players while AsyncPlayerPreLoginEvent is handled on a worker thread, and applies the outcome on
+ * the server thread once all handlers have returned or the timeout has elapsed. Until then, the player is already in
+ * the level but may not interact with it, and joining is deferred until the login is allowed.
+ */
+class LoginQueue {
+public:
+    static constexpr std::chrono::seconds Timeout{10};
+
+    explicit LoginQueue(EndstoneServer &server);
+
+    /**
+     * Logs in a player whose connection request has been accepted. Must be called from the server thread.
+     */
+    void login(EndstonePlayer &player);
+
+    /**
+     * Checks if the login of the player is still pending. If so, the player joins once the login is allowed.
+     *
+     * @return true if the join must be deferred
+     */
+    bool deferJoin(const EndstonePlayer &player);
+
+    /**
+     * Checks if the login of the player is still pending, in which case the player must not interact with the level.
+     */
+    [[nodiscard]] bool isPending(const Player &player) const;
+
+    void tick();
+
+private:
+    void completeLogin(EndstonePlayer &player, bool join_deferred) const;
+
+    EndstoneServer &server_;
+    PendingLogins pending_;
+};
+
+}  // namespace endstone::core
@@ -14,7 +14,9 @@
 
 #include "endstone/core/message.h"
 
-#include "bedrock/locale/i18n.h"
+#include <entt/entt.hpp>
+
+#include "endstone/core/server.h"
 #include "endstone/variant.h"
 
 namespace endstone::core {
@@ -23,7 +25,7 @@ std::string EndstoneMessage::toString(Message message)
 {
     return std::visit(overloaded{[](const std::string &string) { return string; },
                                  [](const Translatable &tr) {
-                                     return getI18n().get(tr.getText(), tr.getParameters(), nullptr);
+                                     return entt::locator<EndstoneServer>::value().getLanguage().translate(tr);
                                  }},
                       message);
 }
@@ -0,0 +1,198 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/movement_tracker.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "endstone/core/player.h"
+#include "endstone/core/plugin/plugin_manager.h"
+#include "endstone/core/server.h"
+#include "endstone/event/player/player_move_event.h"
+
+namespace endstone::core {
+
+namespace {
+float rotationDelta(float from, float to)
+{
+    auto delta = std::fmod(std::abs(to - from), 360.0F);
+    return delta > 180.0F ? 360.0F - delta : delta;
+}
+}  // namespace
+
+MovementTracker::MovementTracker(EndstoneServer &server) : server_(server) {}
+
+void MovementTracker::tick()
+{
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server_.getPluginManager());
+    handlers_ = plugin_manager.getEventHandlers(PlayerMoveEvent::NAME);
+    if (handlers_.empty()) {
+        if (!handler_ids_.empty()) {
+            handler_ids_.clear();
+            handler_groups_.clear();
+            groups_.clear();
+            players_.clear();
+        }
+        return;
+    }
+
+    // a handler may be freed and another one allocated at the same address, so changes are detected by id
+    if (!std::equal(handlers_.begin(), handlers_.end(), handler_ids_.begin(), handler_ids_.end(),
+                    [](const EventHandler *handler, std::uint64_t id) { return handler->getId() == id; })) {
+        rebuildGroups();
+    }
+
+    ++generation_;
+    for (auto *player : server_.getOnlinePlayers()) {
+        auto &endstone_player = static_cast<EndstonePlayer &>(*player);
+        auto [it, inserted] = players_.try_emplace(endstone_player.getUniqueId());
+        auto &state = it->second;
+        state.generation = generation_;
+        if (inserted) {
+            const auto &handle = endstone_player.getHandle();
+            state.position = handle.getPosition();
+            state.rotation = handle.getRotation();
+            state.baselines.assign(groups_.size(), endstone_player.getLocation());
+            continue;
+        }
+        update(endstone_player, state);
+    }
+
+    // forget the players who have left
+    std::erase_if(players_, [this](const auto &entry) { return entry.second.generation != generation_; });
+}
+
+bool MovementTracker::isCrossed(const PlayerMoveThreshold &threshold, const Location &from, const Location &to)
+{
+    if (from.getDimension() != to.getDimension()) {
+        return true;
+    }
+
+    bool any = false;
+    if (threshold.distance > 0) {
+        any = true;
+        if (from.distanceSquared(to) >= threshold.distance * threshold.distance) {
+            return true;
+        }
+    }
+    if (threshold.rotation > 0) {
+        any = true;
+        if (rotationDelta(from.getPitch(), to.getPitch()) >= threshold.rotation ||
+            rotationDelta(from.getYaw(), to.getYaw()) >= threshold.rotation) {
+            return true;
+        }
+    }
+    if (threshold.block) {
+        any = true;
+        if (from.getBlockX() != to.getBlockX() || from.getBlockY() != to.getBlockY() ||
+            from.getBlockZ() != to.getBlockZ()) {
+            return true;
+        }
+    }
+    if (threshold.chunk) {
+        any = true;
+        if ((from.getBlockX() >> 4) != (to.getBlockX() >> 4) || (from.getBlockZ() >> 4) != (to.getBlockZ() >> 4)) {
+            return true;
+        }
+    }
+    if (any) {
+        return false;
+    }
+
+    return from.getX() != to.getX() || from.getY() != to.getY() || from.getZ() != to.getZ() ||
+           from.getPitch() != to.getPitch() || from.getYaw() != to.getYaw();
+}
+
+void MovementTracker::rebuildGroups()
+{
+    const auto &plugin_manager = static_cast<EndstonePluginManager &>(server_.getPluginManager());
+    handler_ids_.clear();
+    handler_groups_.clear();
+    groups_.clear();
+    for (const auto *handler : handlers_) {
+        handler_ids_.push_back(handler->getId());
+        auto threshold = plugin_manager.getMoveThreshold(*handler);
+        auto it = std::find(groups_.begin(), groups_.end(), threshold);
+        if (it == groups_.end()) {
+            it = groups_.insert(groups_.end(), threshold);
+        }
+        handler_groups_.push_back(static_cast<std::size_t>(it - groups_.begin()));
+    }
+    crossed_.assign(groups_.size(), false);
+
+    // the groups have changed, start over from where the players are now
+    players_.clear();
+}
+
+void MovementTracker::update(EndstonePlayer &player, PlayerState &state)
+{
+    const auto &handle = player.getHandle();
+    const auto &position = handle.getPosition();
+    const auto &rotation = handle.getRotation();
+    if (position.x == state.position.x && position.y == state.position.y && position.z == state.position.z &&
+        rotation.x == state.rotation.x && rotation.y == state.rotation.y) {
+        return;  // most players stand still most of the time
+    }
+    state.position = position;
+    state.rotation = rotation;
+
+    const auto to = player.getLocation();
+    bool any = false;
+    for (std::size_t i = 0; i < groups_.size(); ++i) {
+        crossed_[i] = isCrossed(groups_[i], state.baselines[i], to);
+        any = any || crossed_[i];
+    }
+    if (!any) {
+        return;
+    }
+
+    // each handler sees where the player was the last time it was called, and if the event ends up cancelled the
+    // player goes back to where the handler that cancelled it last saw them
+    PlayerMoveEvent e{player, to, to};
+    bool cancelled = false;
+    auto back = to;
+    auto track = [&]() {
+        if (e.isCancelled() != cancelled) {
+            cancelled = e.isCancelled();
+            back = e.getFrom();
+        }
+    };
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server_.getPluginManager());
+    plugin_manager.callEvent(e, handlers_, [&](std::size_t index) {
+        const auto group = handler_groups_[index];
+        if (!crossed_[group]) {
+            return false;
+        }
+        track();
+        e.setFrom(state.baselines[group]);
+        return true;
+    });
+    track();
+
+    if (cancelled) {
+        player.teleport(back);
+        state.position = handle.getPosition();
+        state.rotation = handle.getRotation();
+        state.baselines.assign(groups_.size(), player.getLocation());
+        return;
+    }
+    for (std::size_t i = 0; i < groups_.size(); ++i) {
+        if (crossed_[i]) {
+            state.baselines[i] = to;
+        }
+    }
+}
+
+}  // namespace endstone::core
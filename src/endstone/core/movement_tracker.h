@@ -0,0 +1,73 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "bedrock/core/math/vec2.h"
+#include "bedrock/core/math/vec3.h"
+#include "endstone/event/event_handler.h"
+#include "endstone/event/player/player_move_threshold.h"
+#include "endstone/level/location.h"
+#include "endstone/util/uuid.h"
+
+namespace endstone::core {
+
+class EndstonePlayer;
+class EndstoneServer;
+
+/**
+ * Generates PlayerMoveEvent from the positions of the players, once per tick.
+ *
+ * Handlers that declared the same threshold share a group, and each group remembers where every player was the last
+ * time its handlers were called. Players who have not moved since the last tick are skipped with a single comparison.
+ * Otherwise, a single event is passed through all handlers in order of priority, skipping the handlers of the groups
+ * whose threshold the player has not crossed.
+ */
+class MovementTracker {
+public:
+    explicit MovementTracker(EndstoneServer &server);
+
+    void tick();
+
+    /**
+     * Checks if a player who moved between two locations has crossed a threshold.
+     */
+    [[nodiscard]] static bool isCrossed(const PlayerMoveThreshold &threshold, const Location &from, const Location &to);
+
+private:
+    struct PlayerState {
+        Vec3 position;
+        Vec2 rotation;
+        std::vector<Location> baselines;  // one per group
+        std::uint64_t generation{0};
+    };
+
+    void rebuildGroups();
+    void update(EndstonePlayer &player, PlayerState &state);
+
+    EndstoneServer &server_;
+    std::vector<EventHandler *> handlers_;
+    std::vector<std::uint64_t> handler_ids_;
+    std::vector<std::size_t> handler_groups_;  // the group of each handler
+    std::vector<PlayerMoveThreshold> groups_;  // the threshold of each group
+    std::vector<bool> crossed_;
+    std::unordered_map<UUID, PlayerState> players_;
+    std::uint64_t generation_{0};
+};
+
+}  // namespace endstone::core
@@ -0,0 +1,67 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "endstone/core/pending_chats.h"
+
+#include <utility>
+
+namespace endstone::core {
+
+bool PendingChats::push(std::shared_ptr<Chat> chat)
+{
+    auto &queue = queues_[chat->player_unique_id];
+    queue.push_back(std::move(chat));
+    return queue.size() == 1;
+}
+
+bool PendingChats::contains(const UUID &player_unique_id) const
+{
+    return queues_.contains(player_unique_id);
+}
+
+void PendingChats::complete(std::shared_ptr<Chat> chat)
+{
+    completed_.enqueue(std::move(chat));
+}
+
+void PendingChats::drain(const Deliver &deliver, const Submit &submit)
+{
+    auto count = completed_.size_approx();
+    if (count == 0) {
+        return;
+    }
+
+    completed_batch_.resize(count);
+    completed_batch_.resize(completed_.try_dequeue_bulk(completed_batch_.begin(), count));
+    for (const auto &chat : completed_batch_) {
+        if (!chat->cancelled) {
+            deliver(*chat);
+        }
+
+        // hand the next message of the player to the workers
+        auto it = queues_.find(chat->player_unique_id);
+        auto &queue = it->second;
+        queue.pop_front();
+        if (queue.empty()) {
+            queues_.erase(it);
+        }
+        else {
+            submit(queue.front());
+        }
+    }
+    completed_batch_.clear();
+}
+
+}  // namespace endstone::core
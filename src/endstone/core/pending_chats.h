@@ -0,0 +1,80 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <moodycamel/concurrentqueue.h>
+
+#include "endstone/util/uuid.h"
+
+namespace endstone::core {
+
+/**
+ * Keeps the chat messages of each player in the order they were sent while they are handled on worker threads. Each
+ * player has at most one message in flight, the others wait in the queue of the player.
+ */
+class PendingChats {
+public:
+    struct Chat {
+        std::string player_name;
+        UUID player_unique_id;
+        std::string xuid;
+        std::string message;
+        std::optional<std::string> filtered_message;
+        std::vector<UUID> recipients;
+        bool cancelled{false};
+    };
+
+    using Deliver = std::function<void(Chat &)>;
+    using Submit = std::function<void(const std::shared_ptr<Chat> &)>;
+
+    /**
+     * Queues a message behind the other messages of the same player. Must be called from the server thread.
+     *
+     * @return true if no other message of the player is in flight, in which case the caller submits it right away
+     */
+    bool push(std::shared_ptr<Chat> chat);
+
+    /**
+     * Checks if the player has messages that are queued or in flight. Must be called from the server thread.
+     */
+    [[nodiscard]] bool contains(const UUID &player_unique_id) const;
+
+    /**
+     * Marks a message as handled. May be called from any thread.
+     */
+    void complete(std::shared_ptr<Chat> chat);
+
+    /**
+     * Delivers the messages completed so far, unless they were cancelled, and submits the next message of each of their
+     * players. Must be called from the server thread.
+     */
+    void drain(const Deliver &deliver, const Submit &submit);
+
+private:
+    std::unordered_map<UUID, std::deque<std::shared_ptr<Chat>>> queues_;
+    moodycamel::ConcurrentQueue<std::shared_ptr<Chat>> completed_;
+    std::vector<std::shared_ptr<Chat>> completed_batch_;
+};
+
+}  // namespace endstone::core
@@ -0,0 +1,83 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "endstone/core/pending_logins.h"
+
+#include <utility>
+
+namespace endstone::core {
+
+void PendingLogins::Outcome::complete(bool cancelled, std::string kick_message)
+{
+    cancelled_ = cancelled;
+    kick_message_ = std::move(kick_message);
+    done_.store(true, std::memory_order_release);
+}
+
+bool PendingLogins::Outcome::isDone() const
+{
+    return done_.load(std::memory_order_acquire);
+}
+
+std::shared_ptr<PendingLogins::Outcome> PendingLogins::add(const UUID &unique_id, Clock::time_point deadline)
+{
+    auto outcome = std::make_shared<Outcome>();
+    entries_[unique_id] = {outcome, deadline};
+    return outcome;
+}
+
+bool PendingLogins::contains(const UUID &unique_id) const
+{
+    return entries_.contains(unique_id);
+}
+
+bool PendingLogins::deferJoin(const UUID &unique_id)
+{
+    auto it = entries_.find(unique_id);
+    if (it == entries_.end()) {
+        return false;
+    }
+    it->second.join_deferred = true;
+    return true;
+}
+
+std::vector<PendingLogins::Resolution> PendingLogins::poll(Clock::time_point now)
+{
+    std::vector<Resolution> resolutions;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        const auto &[unique_id, entry] = *it;
+        const auto &outcome = *entry.outcome;
+        if (outcome.isDone()) {
+            resolutions.push_back({unique_id, outcome.cancelled_ ? Result::Denied : Result::Allowed,
+                                   outcome.kick_message_, entry.join_deferred});
+        }
+        else if (now >= entry.deadline) {
+            resolutions.push_back({unique_id, Result::TimedOut, {}, entry.join_deferred});
+        }
+        else {
+            ++it;
+            continue;
+        }
+        it = entries_.erase(it);
+    }
+    return resolutions;
+}
+
+bool PendingLogins::empty() const
+{
+    return entries_.empty();
+}
+
+}  // namespace endstone::core
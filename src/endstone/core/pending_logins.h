@@ -0,0 +1,98 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "endstone/util/uuid.h"
+
+namespace endstone::core {
+
+/**
+ * Keeps track of the logins waiting for the outcome of AsyncPlayerPreLoginEvent. The outcome is set by a worker thread
+ * while everything else happens on the server thread.
+ */
+class PendingLogins {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    class Outcome {
+    public:
+        void complete(bool cancelled, std::string kick_message);
+        [[nodiscard]] bool isDone() const;
+
+    private:
+        friend class PendingLogins;
+
+        std::atomic<bool> done_{false};
+        bool cancelled_{false};
+        std::string kick_message_;
+    };
+
+    enum class Result {
+        Allowed,
+        Denied,
+        TimedOut,
+    };
+
+    struct Resolution {
+        UUID unique_id;
+        Result result;
+        std::string kick_message;
+        bool join_deferred;
+    };
+
+    /**
+     * Adds the login of a player. It times out if no outcome is set before the deadline.
+     *
+     * @return the outcome to be completed by the worker thread
+     */
+    std::shared_ptr<Outcome> add(const UUID &unique_id, Clock::time_point deadline);
+
+    [[nodiscard]] bool contains(const UUID &unique_id) const;
+
+    /**
+     * Marks the join of a pending login as deferred, so that it is reported along with the resolution.
+     *
+     * @return true if the login is pending
+     */
+    bool deferJoin(const UUID &unique_id);
+
+    /**
+     * Removes the logins that have an outcome or have timed out.
+     *
+     * @return the resolutions of the removed logins
+     */
+    std::vector<Resolution> poll(Clock::time_point now);
+
+    [[nodiscard]] bool empty() const;
+
+private:
+    struct Entry {
+        std::shared_ptr<Outcome> outcome;
+        Clock::time_point deadline;
+        bool join_deferred{false};
+    };
+
+    std::unordered_map<UUID, Entry> entries_;
+};
+
+}  // namespace endstone::core
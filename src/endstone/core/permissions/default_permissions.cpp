@@ -41,6 +41,9 @@ void DefaultPermissions::registerCorePermissions()
                                     "Gives the user the ability to use all Endstone utilities and commands");
     registerCommandPermissions(root);
     registerBroadcastPermissions(root);
+    registerPermission(root->getName() + ".viewdistance.exempt", root,
+                       "Exempts the user from view distance reductions hinted under heavy load.",
+                       PermissionDefault::False);
     root->recalculatePermissibles();
 }
 
@@ -16,6 +16,8 @@
 
 #include <climits>
 #include <fstream>
+#include <optional>
+#include <string_view>
 
 #include <fmt/format.h>
 
@@ -39,64 +41,84 @@ struct MmapRegion {
     char pathname[PATH_MAX + 1];
 };
 
-ModuleInfo get_module_info(const char *module_name)
-{
-    std::ifstream file("/proc/self/maps");
-    if (!file.is_open()) {
-        throw std::runtime_error("Failed to open /proc/self/maps");
-    }
+struct Modules {
+    std::optional<ModuleInfo> module;
+    std::optional<ModuleInfo> executable;
+};
 
-    for (std::string line; std::getline(file, line);) {
-        MmapRegion region;
-        int r = sscanf(line.c_str(), "%lx-%lx %4s %lx %10s %ld %s", &region.begin, &region.end, region.perms,
-                       &region.offset, region.device, &region.inode, region.pathname);
-        if (r != 7) {
-            continue;
+// Reads /proc/self/maps once, both modules are mapped before the runtime is initialised and never move.
+const Modules &get_modules()
+{
+    static const Modules modules = []() {
+        std::ifstream file("/proc/self/maps");
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open /proc/self/maps");
         }
 
-        auto pathname = std::string(region.pathname);
-        std::size_t pos = pathname.find_last_of('/');
-        if (pos != std::string::npos) {
-            pathname = pathname.substr(pos + 1);
+        Modules result;
+        auto &[module, executable] = result;
+        for (std::string line; std::getline(file, line) && !(module && executable);) {
+            MmapRegion region;
+            int r = sscanf(line.c_str(), "%lx-%lx %4s %lx %10s %ld %s", &region.begin, &region.end, region.perms,
+                           &region.offset, region.device, &region.inode, region.pathname);
+            if (r != 7) {
+                continue;
+            }
+
+            std::string_view pathname = region.pathname;
+            if (const auto pos = pathname.find_last_of('/'); pos != std::string_view::npos) {
+                pathname = pathname.substr(pos + 1);
+            }
+
+            if (!executable) {
+                executable = ModuleInfo{reinterpret_cast<void *>(region.begin), region.pathname};
+            }
+            if (!module && pathname == "libendstone_runtime.so") {
+                module = ModuleInfo{reinterpret_cast<void *>(region.begin), region.pathname};
+            }
         }
+        return result;
+    }();
+    return modules;
+}
 
-        if (module_name == nullptr || pathname == module_name) {
-            return {reinterpret_cast<void *>(region.begin), region.pathname};
-        }
+const ModuleInfo &get_runtime_module_info()
+{
+    const auto &info = get_modules().module;
+    if (!info) {
+        throw std::runtime_error("Module libendstone_runtime.so not found in /proc/self/maps");
     }
+    return *info;
+}
 
-    throw std::runtime_error(fmt::format("Module {} not found in {}", module_name, "/proc/self/maps"));
+const ModuleInfo &get_executable_module_info()
+{
+    const auto &info = get_modules().executable;
+    if (!info) {
+        throw std::runtime_error("Executable not found in /proc/self/maps");
+    }
+    return *info;
 }
 }  // namespace
 
 void *get_module_base()
 {
-    static void *base = []() {
-        auto module_info = get_module_info("libendstone_runtime.so");
-        return module_info.base;
-    }();
-    return base;
+    return get_runtime_module_info().base;
 }
 
 std::string get_module_pathname()
 {
-    auto module_info = get_module_info("libendstone_runtime.so");
-    return module_info.pathname;
+    return get_runtime_module_info().pathname;
 }
 
 void *get_executable_base()
 {
-    static void *base = []() {
-        auto module_info = get_module_info(nullptr);
-        return module_info.base;
-    }();
-    return base;
+    return get_executable_module_info().base;
 }
 
 std::string get_executable_pathname()
 {
-    auto module_info = get_module_info(nullptr);
-    return module_info.pathname;
+    return get_executable_module_info().pathname;
 }
 
 std::string_view get_platform()
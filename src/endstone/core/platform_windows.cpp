@@ -54,13 +54,17 @@ void *get_module_base()
 
 std::string get_module_pathname()
 {
-    char file_name[MAX_PATH] = {0};
-    auto len =
-        GetModuleFileNameExA(GetCurrentProcess(), get_module_handle("endstone_runtime.dll"), file_name, MAX_PATH);
-    if (len == 0 || len == MAX_PATH) {
-        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "GetModuleFileNameEx failed");
-    }
-    return file_name;
+    static std::string pathname = []() {
+        char file_name[MAX_PATH] = {0};
+        auto len =
+            GetModuleFileNameExA(GetCurrentProcess(), get_module_handle("endstone_runtime.dll"), file_name, MAX_PATH);
+        if (len == 0 || len == MAX_PATH) {
+            throw std::system_error(static_cast<int>(GetLastError()), std::system_category(),
+                                    "GetModuleFileNameEx failed");
+        }
+        return std::string(file_name);
+    }();
+    return pathname;
 }
 
 void *get_executable_base()
@@ -79,12 +83,16 @@ void *get_executable_base()
 
 std::string get_executable_pathname()
 {
-    char file_name[MAX_PATH] = {0};
-    auto len = GetModuleFileNameExA(GetCurrentProcess(), get_module_handle(nullptr), file_name, MAX_PATH);
-    if (len == 0 || len == MAX_PATH) {
-        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "GetModuleFileNameEx failed");
-    }
-    return file_name;
+    static std::string pathname = []() {
+        char file_name[MAX_PATH] = {0};
+        auto len = GetModuleFileNameExA(GetCurrentProcess(), get_module_handle(nullptr), file_name, MAX_PATH);
+        if (len == 0 || len == MAX_PATH) {
+            throw std::system_error(static_cast<int>(GetLastError()), std::system_category(),
+                                    "GetModuleFileNameEx failed");
+        }
+        return std::string(file_name);
+    }();
+    return pathname;
 }
 
 std::string_view get_platform()
@@ -20,8 +20,12 @@
 #include "bedrock/deps/raknet/rak_peer_interface.h"
 #include "bedrock/entity/components/user_entity_identifier_component.h"
 #include "bedrock/network/packet.h"
+#include "bedrock/network/packet/chunk_radius_updated_packet.h"
 #include "bedrock/network/packet/modal_form_request_packet.h"
 #include "bedrock/network/packet/play_sound_packet.h"
+#include "bedrock/network/packet/remove_objective_packet.h"
+#include "bedrock/network/packet/set_display_objective_packet.h"
+#include "bedrock/network/packet/set_score_packet.h"
 #include "bedrock/network/packet/set_title_packet.h"
 #include "bedrock/network/packet/stop_sound_packet.h"
 #include "bedrock/network/packet/text_packet.h"
@@ -33,15 +37,17 @@
 #include "bedrock/world/actor/player/player.h"
 #include "bedrock/world/level/level.h"
 #include "endstone/color_format.h"
-#include "endstone/core/base64.h"
 #include "endstone/core/form/form_codec.h"
+#include "endstone/core/form/form_template.h"
 #include "endstone/core/game_mode.h"
 #include "endstone/core/inventory/player_inventory.h"
+#include "endstone/core/message.h"
 #include "endstone/core/network/packet_adapter.h"
 #include "endstone/core/permissions/permissible.h"
 #include "endstone/core/server.h"
 #include "endstone/core/util/error.h"
 #include "endstone/core/util/uuid.h"
+#include "endstone/event/player/player_join_event.h"
 #include "endstone/form/action_form.h"
 #include "endstone/form/message_form.h"
 
@@ -49,7 +55,8 @@ namespace endstone::core {
 
 EndstonePlayer::EndstonePlayer(EndstoneServer &server, ::Player &player)
     : EndstoneMob(server, player), player_(player), perm_(PermissibleBase::create(static_cast<Player *>(this))),
-      inventory_(std::make_unique<EndstonePlayerInventory>(player))
+      inventory_(std::make_unique<EndstonePlayerInventory>(player)),
+      virtual_scoreboard_(std::make_unique<EndstoneVirtualScoreboard>())
 {
     auto *component = player.tryGetComponent<UserEntityIdentifierComponent>();
     if (!component) {
@@ -81,6 +88,10 @@ EndstonePlayer::~EndstonePlayer()
 {
     server_.players_.erase(uuid_);
     server_.removePlayerBoard(*this);
+    std::lock_guard lock{server_.boss_bars_mtx_};
+    for (auto *boss_bar : server_.boss_bars_) {
+        boss_bar->onPlayerQuit(*this);
+    }
 }
 
 Player *EndstonePlayer::asPlayer() const
@@ -90,20 +101,7 @@ Player *EndstonePlayer::asPlayer() const
 
 void EndstonePlayer::sendMessage(const Message &message) const
 {
-    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::Text);
-    auto pk = std::static_pointer_cast<TextPacket>(packet);
-    std::visit(overloaded{[&pk](const std::string &msg) {
-                              pk->type = TextPacketType::Raw;
-                              pk->message = msg;
-                          },
-                          [&pk](const Translatable &msg) {
-                              pk->type = TextPacketType::Translate;
-                              pk->message = msg.getText();
-                              pk->params = msg.getParameters();
-                              pk->localize = true;
-                          }},
-               message);
-    getHandle().sendNetworkPacket(*packet);
+    getHandle().sendNetworkPacket(*createTextPacket(message));
 }
 
 void EndstonePlayer::sendErrorMessage(const Message &message) const
@@ -489,6 +487,11 @@ void EndstonePlayer::setScoreboard(Scoreboard &scoreboard)
     server_.setPlayerBoard(*this, scoreboard);
 }
 
+VirtualScoreboard &EndstonePlayer::getVirtualScoreboard() const
+{
+    return *virtual_scoreboard_;
+}
+
 void EndstonePlayer::sendTitle(std::string title, std::string subtitle) const
 {
     sendTitle(std::move(title), std::move(subtitle), 10, 70, 20);
@@ -652,6 +655,29 @@ std::string EndstonePlayer::getLocale() const
     return locale_;
 }
 
+int EndstonePlayer::getViewDistance() const
+{
+    if (view_distance_hint_ > 0) {
+        return view_distance_hint_;
+    }
+    return server_.getMaxViewDistance();
+}
+
+int EndstonePlayer::getViewDistanceHint() const
+{
+    return view_distance_hint_;
+}
+
+void EndstonePlayer::setViewDistanceHint(int view_distance)
+{
+    view_distance_hint_ = view_distance;
+
+    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::ChunkRadiusUpdated);
+    auto pk = std::static_pointer_cast<ChunkRadiusUpdatedPacket>(packet);
+    pk->chunk_radius = getViewDistance();
+    getHandle().sendNetworkPacket(*packet);
+}
+
 std::string EndstonePlayer::getDeviceOS() const
 {
     return device_os_;
@@ -669,7 +695,8 @@ std::string EndstonePlayer::getGameVersion() const
 
 const Skin &EndstonePlayer::getSkin() const
 {
-    return skin_;
+    static const Skin empty;
+    return skin_ ? skin_->getSkin() : empty;
 }
 
 void EndstonePlayer::transfer(std::string host, int port) const
@@ -686,16 +713,25 @@ void EndstonePlayer::sendForm(FormVariant form)
     if (isDead()) {
         return;
     }
-    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::ShowModalForm);
-    std::shared_ptr<ModalFormRequestPacket> pk = std::static_pointer_cast<ModalFormRequestPacket>(packet);
-    pk->form_id = ++form_ids_;
-    pk->form_json = std::visit(overloaded{[](auto &&arg) {
-                                   return FormCodec::toJson(arg);
-                               }},
-                               form)
-                        .dump();
-    forms_.emplace(pk->form_id, std::move(form));
-    getHandle().sendNetworkPacket(*packet);
+    auto json = std::visit(overloaded{[](auto &&arg) {
+                               return FormCodec::toJson(arg);
+                           }},
+                           form);
+    showForm(std::make_shared<const FormVariant>(std::move(form)), std::move(json));
+}
+
+void EndstonePlayer::sendForm(const FormTemplate &form)
+{
+    sendForm(form, {});
+}
+
+void EndstonePlayer::sendForm(const FormTemplate &form, const std::unordered_map<std::string, std::string> &values)
+{
+    if (isDead()) {
+        return;
+    }
+    const auto &form_template = static_cast<const EndstoneFormTemplate &>(form);
+    showForm(form_template.getForm(), form_template.render(values));
 }
 
 void EndstonePlayer::closeForm()
@@ -711,6 +747,16 @@ void EndstonePlayer::sendPacket(Packet &packet) const
     getHandle().sendNetworkPacket(pk);
 }
 
+void EndstonePlayer::showForm(std::shared_ptr<const FormVariant> form, std::string json)
+{
+    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::ShowModalForm);
+    std::shared_ptr<ModalFormRequestPacket> pk = std::static_pointer_cast<ModalFormRequestPacket>(packet);
+    pk->form_id = ++form_ids_;
+    pk->form_json = std::move(json);
+    forms_.emplace(pk->form_id, std::move(form));
+    getHandle().sendNetworkPacket(*packet);
+}
+
 void EndstonePlayer::onFormClose(std::uint32_t form_id, PlayerFormCloseReason /*reason*/)
 {
     auto it = forms_.find(form_id);
@@ -729,7 +775,7 @@ void EndstonePlayer::onFormClose(std::uint32_t form_id, PlayerFormCloseReason /*
                                callback(this);
                            }
                        }},
-                       form_variant);
+                       *form_variant);
         }
         catch (std::exception &e) {
             getServer().getLogger().error("Error occurred when calling a on close callback of a form: {}", e.what());
@@ -737,13 +783,28 @@ void EndstonePlayer::onFormClose(std::uint32_t form_id, PlayerFormCloseReason /*
     }
 }
 
-void EndstonePlayer::onFormResponse(std::uint32_t form_id, const nlohmann::json &json)
+void EndstonePlayer::onFormResponse(std::uint32_t form_id, const Json::Value &response)
 {
     auto it = forms_.find(form_id);
     if (it == forms_.end()) {
         return;  // Could be a form created via the script api, do nothing
     }
 
+    // a response of the wrong type is invalid, and handled as if the form was closed
+    const auto valid = std::visit(overloaded{
+                                      [&](const MessageForm &) { return response.type() == Json::booleanValue; },
+                                      [&](const ActionForm &) {
+                                          return response.type() == Json::intValue ||
+                                                 response.type() == Json::uintValue;
+                                      },
+                                      [](const ModalForm &) { return true; },
+                                  },
+                                  *it->second);
+    if (!valid) {
+        onFormClose(form_id, PlayerFormCloseReason::UserClosed);
+        return;
+    }
+
     auto form_variant = std::move(it->second);
     forms_.erase(it);
 
@@ -752,11 +813,11 @@ void EndstonePlayer::onFormResponse(std::uint32_t form_id, const nlohmann::json
             std::visit(overloaded{
                            [&](const MessageForm &form) {
                                if (auto callback = form.getOnSubmit()) {
-                                   callback(this, json.get<bool>() ? 0 : 1);
+                                   callback(this, response.asBool() ? 0 : 1);
                                }
                            },
                            [&](const ActionForm &form) {
-                               int selection = json.get<int>();
+                               int selection = response.asInt();
                                if (auto callback = form.getOnSubmit()) {
                                    callback(this, selection);
                                }
@@ -770,11 +831,11 @@ void EndstonePlayer::onFormResponse(std::uint32_t form_id, const nlohmann::json
                            },
                            [&](const ModalForm &form) {
                                if (auto callback = form.getOnSubmit()) {
-                                   callback(this, json.dump());
+                                   callback(this, FormCodec::toJson(response));
                                }
                            },
                        },
-                       form_variant);
+                       *form_variant);
         }
         catch (std::exception &e) {
             getServer().getLogger().error("Error occurred when calling a on submit callback of a form: {}", e.what());
@@ -840,21 +901,48 @@ void EndstonePlayer::initFromConnectionRequest(
             }
 
             {
-                auto skin_id = req->getData("SkinId").asString();
-                auto skin_height = req->getData("SkinImageHeight").asInt();
-                auto skin_width = req->getData("SkinImageWidth").asInt();
-                auto skin_data = base64_decode(req->getData("SkinData").asString()).value_or("");
-                auto cape_id = req->getData("CapeId").asString();
-                auto cape_height = req->getData("CapeImageHeight").asInt();
-                auto cape_width = req->getData("CapeImageWidth").asInt();
-                auto cape_data = base64_decode(req->getData("CapeData").asString()).value_or("");
-                skin_ = {skin_id, Skin::ImageData{skin_height, skin_width, skin_data}, cape_id,
-                         Skin::ImageData{cape_height, cape_width, cape_data}};
+                // decoded by the cache once a plugin asks for it
+                const auto to_string_view = [](const Json::Value &value) -> std::string_view {
+                    return value.type() == Json::stringValue ? value.asCString() : "";
+                };
+                const auto skin_id = req->getData("SkinId");
+                const auto skin_data = req->getData("SkinData");
+                const auto cape_id = req->getData("CapeId");
+                const auto cape_data = req->getData("CapeData");
+                skin_ = server_.getSkinCache().get(
+                    to_string_view(skin_id),
+                    {req->getData("SkinImageHeight").asInt(), req->getData("SkinImageWidth").asInt(),
+                     to_string_view(skin_data)},
+                    to_string_view(cape_id),
+                    {req->getData("CapeImageHeight").asInt(), req->getData("CapeImageWidth").asInt(),
+                     to_string_view(cape_data)});
             }
         },
         request);
 }
 
+void EndstonePlayer::join()
+{
+    Translatable tr{ColorFormat::Yellow + "%multiplayer.player.joined", {getName()}};
+    const std::string join_message = EndstoneMessage::toString(tr);
+
+    PlayerJoinEvent e{*this, join_message};
+    server_.getPluginManager().callEvent(e);
+    if (e.getJoinMessage() != join_message) {
+        tr = Translatable{e.getJoinMessage(), {}};
+    }
+
+    if (!e.getJoinMessage().empty()) {
+        const auto packet = createTextPacket(tr);
+        for (const auto &online_player : server_.getOnlinePlayers()) {
+            static_cast<EndstonePlayer *>(online_player)->getHandle().sendNetworkPacket(*packet);
+        }
+    }
+    recalculatePermissions();
+    updateCommands();
+    server_.getViewDistanceHint().apply(*this);
+}
+
 void EndstonePlayer::disconnect() {}
 
 void EndstonePlayer::updateAbilities() const
@@ -865,6 +953,75 @@ void EndstonePlayer::updateAbilities() const
     getHandle().sendNetworkPacket(*packet);
 }
 
+void EndstonePlayer::flushVirtualScoreboard()
+{
+    if (!virtual_scoreboard_->isDirty()) {
+        return;
+    }
+
+    bool restore = false;
+    for (const auto &update : virtual_scoreboard_->takeUpdates()) {
+        const auto objective_name = EndstoneVirtualScoreboard::getObjectiveName(update.slot);
+        if (update.remove) {
+            auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::RemoveObjective);
+            auto pk = std::static_pointer_cast<RemoveObjectivePacket>(packet);
+            pk->objective_name = objective_name;
+            getHandle().sendNetworkPacket(*packet);
+            restore = restore || !update.display;
+        }
+        if (update.display) {
+            auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::SetDisplayObjective);
+            auto pk = std::static_pointer_cast<SetDisplayObjectivePacket>(packet);
+            pk->display_slot_name = EndstoneScoreboard::getDisplaySlotName(update.slot);
+            pk->objective_name = objective_name;
+            pk->objective_display_name = update.display_name;
+            pk->criteria_name = EndstoneScoreboard::getCriteriaName(Criteria::Type::Dummy);
+            pk->sort_order = static_cast<::ObjectiveSortOrder>(update.order);
+            getHandle().sendNetworkPacket(*packet);
+        }
+        if (!update.removed.empty()) {
+            auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::SetScore);
+            auto pk = std::static_pointer_cast<SetScorePacket>(packet);
+            pk->type = ScorePacketType::Remove;
+            pk->score_info.reserve(update.removed.size());
+            for (const auto id : update.removed) {
+                pk->score_info.push_back({ScoreboardId(id), objective_name});
+            }
+            getHandle().sendNetworkPacket(*packet);
+        }
+        if (!update.changed.empty()) {
+            auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::SetScore);
+            auto pk = std::static_pointer_cast<SetScorePacket>(packet);
+            pk->type = ScorePacketType::Change;
+            pk->score_info.reserve(update.changed.size());
+            for (const auto *entry : update.changed) {
+                auto &info = pk->score_info.emplace_back(ScorePacketInfo{ScoreboardId(entry->id), objective_name});
+                info.score_value = entry->score;
+                switch (entry->type) {
+                case EndstoneVirtualScoreboard::EntryType::Player:
+                    info.identity_type = IdentityDefinition::Type::Player;
+                    info.player_id = PlayerScoreboardId{ActorUniqueID(entry->actor_id)};
+                    break;
+                case EndstoneVirtualScoreboard::EntryType::Actor:
+                    info.identity_type = IdentityDefinition::Type::Entity;
+                    info.entity_id = ActorUniqueID(entry->actor_id);
+                    break;
+                case EndstoneVirtualScoreboard::EntryType::FakePlayer:
+                    info.identity_type = IdentityDefinition::Type::FakePlayer;
+                    info.fake_player_name = entry->name;
+                    break;
+                }
+            }
+            getHandle().sendNetworkPacket(*packet);
+        }
+    }
+
+    // a cleared slot shows whatever the player's scoreboard displays there
+    if (restore) {
+        server_.getPlayerBoard(*this).getHandle().onPlayerJoined(getHandle());
+    }
+}
+
 ::Player &EndstonePlayer::getHandle() const
 {
     return player_;
@@ -875,4 +1032,22 @@ std::shared_ptr<EndstonePlayer> EndstonePlayer::create(EndstoneServer &server, :
     return PermissibleFactory::create<EndstonePlayer>(server, player);
 }
 
+std::shared_ptr<::Packet> EndstonePlayer::createTextPacket(const Message &message)
+{
+    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::Text);
+    auto pk = std::static_pointer_cast<TextPacket>(packet);
+    std::visit(overloaded{[&pk](const std::string &msg) {
+                              pk->type = TextPacketType::Raw;
+                              pk->message = msg;
+                          },
+                          [&pk](const Translatable &msg) {
+                              pk->type = TextPacketType::Translate;
+                              pk->message = msg.getText();
+                              pk->params = msg.getParameters();
+                              pk->localize = true;
+                          }},
+               message);
+    return packet;
+}
+
 }  // namespace endstone::core
@@ -15,14 +15,18 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 
-#include <nlohmann/json.hpp>
-
+#include "bedrock/deps/json/value.h"
 #include "bedrock/network/connection_request.h"
+#include "bedrock/network/packet.h"
 #include "bedrock/network/sub_client_connection_request.h"
 #include "bedrock/world/events/player_events.h"
 #include "endstone/core/actor/mob.h"
 #include "endstone/core/inventory/player_inventory.h"
+#include "endstone/core/scoreboard/virtual_scoreboard.h"
+#include "endstone/core/skin_cache.h"
 #include "endstone/player.h"
 
 class Player;
@@ -123,6 +127,7 @@ public:
     void setWalkSpeed(float value) const override;
     [[nodiscard]] Scoreboard &getScoreboard() const override;
     void setScoreboard(Scoreboard &scoreboard) override;
+    [[nodiscard]] VirtualScoreboard &getVirtualScoreboard() const override;
     void sendPopup(std::string message) const override;
     void sendTip(std::string message) const override;
     void sendToast(std::string title, std::string content) const override;
@@ -142,41 +147,54 @@ public:
     [[nodiscard]] GameMode getGameMode() const override;
     void setGameMode(GameMode mode) override;
     [[nodiscard]] std::string getLocale() const override;
+    [[nodiscard]] int getViewDistance() const override;
     [[nodiscard]] std::string getDeviceOS() const override;
     [[nodiscard]] std::string getDeviceId() const override;
     [[nodiscard]] std::string getGameVersion() const override;
     [[nodiscard]] const Skin &getSkin() const override;
     void sendForm(FormVariant form) override;
+    void sendForm(const FormTemplate &form) override;
+    void sendForm(const FormTemplate &form, const std::unordered_map<std::string, std::string> &values) override;
     void closeForm() override;
     void sendPacket(Packet &packet) const override;
     void onFormClose(std::uint32_t form_id, PlayerFormCloseReason reason);
-    void onFormResponse(std::uint32_t form_id, const nlohmann::json &json);
+    void onFormResponse(std::uint32_t form_id, const Json::Value &response);
 
     void initFromConnectionRequest(
         std::variant<const ::ConnectionRequest *, const ::SubClientConnectionRequest *> request);
+    void join();
     void disconnect();
     void updateAbilities() const;
+    void flushVirtualScoreboard();
     bool checkRightClickSpam(Vector<int> block_pos, Vector<float> click_pos);
+    [[nodiscard]] int getViewDistanceHint() const;
+    void setViewDistanceHint(int view_distance);
     [[nodiscard]] ::Player &getHandle() const;
 
     static std::shared_ptr<EndstonePlayer> create(EndstoneServer &server, ::Player &player);
+    // A text packet for the message, which can be sent to any number of players
+    static std::shared_ptr<::Packet> createTextPacket(const Message &message);
 
 private:
     friend class ::ServerNetworkHandler;
 
+    void showForm(std::shared_ptr<const FormVariant> form, std::string json);
+
     ::Player &player_;
     UUID uuid_;
     std::string xuid_;
     SocketAddress address_;
     std::shared_ptr<PermissibleBase> perm_;
     std::unique_ptr<EndstonePlayerInventory> inventory_;
+    std::unique_ptr<EndstoneVirtualScoreboard> virtual_scoreboard_;
     std::string locale_ = "en_US";
     std::string device_os_ = "Unknown";
     std::string device_id_;
     std::string game_version_;
-    Skin skin_;
+    std::shared_ptr<const SkinCache::Entry> skin_;
     std::uint32_t form_ids_ = 0xffff;  // Set to a large value to avoid collision with forms created by script api
-    std::unordered_map<std::uint32_t, FormVariant> forms_;
+    std::unordered_map<std::uint32_t, std::shared_ptr<const FormVariant>> forms_;
+    int view_distance_hint_ = 0;  // 0 if no reduction is hinted
 };
 
 }  // namespace endstone::core
@@ -17,16 +17,22 @@
 #include <algorithm>
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <regex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <pybind11/embed.h>
+
 #include "endstone/core/logger_factory.h"
+#include "endstone/core/plugin/python_plugin_loader.h"
 #include "endstone/core/util/error.h"
 #include "endstone/event/event.h"
 #include "endstone/event/event_handler.h"
 #include "endstone/event/handler_list.h"
+#include "endstone/event/player/player_move_event.h"
 #include "endstone/plugin/plugin.h"
 #include "endstone/plugin/plugin_loader.h"
 #include "endstone/scheduler/scheduler.h"
@@ -164,6 +170,14 @@ void EndstonePluginManager::disablePlugin(Plugin &plugin)
     if (plugin.isEnabled()) {
         plugin.getPluginLoader().disablePlugin(plugin);
         server_.getScheduler().cancelTasks(plugin);
+        std::unique_lock lock{event_handlers_mtx_};
+        if (auto it = event_handlers_.find(PlayerMoveEvent::NAME); it != event_handlers_.end()) {
+            for (const auto *handler : it->second.getHandlers()) {
+                if (&handler->getPlugin() == &plugin) {
+                    move_thresholds_.erase(handler->getId());
+                }
+            }
+        }
         for (auto &[name, handler] : event_handlers_) {
             handler.unregister(plugin);
         }
@@ -183,7 +197,11 @@ void EndstonePluginManager::clearPlugins()
     plugins_.clear();
     lookup_names_.clear();
     // TODO: recreate dependency graph
-    event_handlers_.clear();
+    {
+        std::unique_lock lock{event_handlers_mtx_};
+        event_handlers_.clear();
+        move_thresholds_.clear();
+    }
     plugin_loaders_.clear();
     permissions_.clear();
     default_perms_[true].clear();
@@ -192,22 +210,51 @@ void EndstonePluginManager::clearPlugins()
 
 void EndstonePluginManager::callEvent(Event &event)
 {
-    if (event.isAsynchronous() && server_.isPrimaryThread()) {
-        server_.getLogger().error("{} cannot be triggered asynchronously from server thread.", event.getEventName());
+    if (!checkThread(event)) {
         return;
     }
 
-    if (!event.isAsynchronous() && !server_.isPrimaryThread()) {
-        server_.getLogger().error("{} must be triggered synchronously from server thread.", event.getEventName());
+    // take a copy of the handlers, so they may be registered and unregistered while the event is being handled
+    std::vector<EventHandler *> handlers;
+    {
+        std::shared_lock lock{event_handlers_mtx_};
+        auto it = event_handlers_.find(event.getEventName());
+        if (it == event_handlers_.end()) {
+            return;
+        }
+        handlers = it->second.getHandlers();
+    }
+    callEvent(event, handlers);
+}
+
+void EndstonePluginManager::callEvent(Event &event, const std::vector<EventHandler *> &handlers,
+                                      const std::function<bool(std::size_t)> &filter)
+{
+    if (!checkThread(event)) {
         return;
     }
 
-    auto &handler_list = event_handlers_.emplace(event.getEventName(), event.getEventName()).first->second;
-    for (const auto &handler : handler_list.getHandlers()) {
+    // Hold the GIL across consecutive handlers of Python plugins instead of acquiring it once per handler, and release
+    // it before handing the event to a native plugin.
+    std::optional<pybind11::gil_scoped_acquire> gil;
+    for (std::size_t i = 0; i < handlers.size(); ++i) {
+        const auto *handler = handlers[i];
         auto &plugin = handler->getPlugin();
         if (!plugin.isEnabled()) {
             continue;
         }
+        if (filter && !filter(i)) {
+            continue;
+        }
+
+        if (dynamic_cast<PythonPluginLoader *>(&plugin.getPluginLoader())) {
+            if (!gil) {
+                gil.emplace();
+            }
+        }
+        else {
+            gil.reset();
+        }
 
         try {
             handler->callEvent(event);
@@ -219,8 +266,66 @@ void EndstonePluginManager::callEvent(Event &event)
     }
 }
 
+bool EndstonePluginManager::hasEventHandlers(const std::string &event) const
+{
+    std::shared_lock lock{event_handlers_mtx_};
+    auto it = event_handlers_.find(event);
+    return it != event_handlers_.end() && !it->second.getHandlers().empty();
+}
+
+std::vector<EventHandler *> EndstonePluginManager::getEventHandlers(const std::string &event) const
+{
+    std::shared_lock lock{event_handlers_mtx_};
+    auto it = event_handlers_.find(event);
+    if (it == event_handlers_.end()) {
+        return {};
+    }
+    return it->second.getHandlers();
+}
+
 Result<void> EndstonePluginManager::registerEvent(std::string event, std::function<void(Event &)> executor,
                                                   EventPriority priority, Plugin &plugin, bool ignore_cancelled)
+{
+    std::unique_lock lock{event_handlers_mtx_};
+    auto handler = addEventHandler(std::move(event), std::move(executor), priority, plugin, ignore_cancelled);
+    if (!handler) {
+        return nonstd::make_unexpected(handler.error());
+    }
+    return {};
+}
+
+Result<void> EndstonePluginManager::registerMoveEvent(std::function<void(Event &)> executor,
+                                                      PlayerMoveThreshold threshold, EventPriority priority,
+                                                      Plugin &plugin, bool ignore_cancelled)
+{
+    if (threshold.distance < 0 || threshold.rotation < 0) {
+        return nonstd::make_unexpected(
+            make_error("Plugin {} attempted to register listener for event {} with a negative threshold.",
+                       plugin.getDescription().getFullName(), PlayerMoveEvent::NAME));
+    }
+
+    std::unique_lock lock{event_handlers_mtx_};
+    auto handler = addEventHandler(PlayerMoveEvent::NAME, std::move(executor), priority, plugin, ignore_cancelled);
+    if (!handler) {
+        return nonstd::make_unexpected(handler.error());
+    }
+    move_thresholds_[handler.value()->getId()] = threshold;
+    return {};
+}
+
+PlayerMoveThreshold EndstonePluginManager::getMoveThreshold(const EventHandler &handler) const
+{
+    std::shared_lock lock{event_handlers_mtx_};
+    auto it = move_thresholds_.find(handler.getId());
+    if (it == move_thresholds_.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+Result<EventHandler *> EndstonePluginManager::addEventHandler(std::string event, std::function<void(Event &)> executor,
+                                                              EventPriority priority, Plugin &plugin,
+                                                              bool ignore_cancelled)
 {
     if (!plugin.isEnabled()) {
         return nonstd::make_unexpected(
@@ -229,14 +334,28 @@ Result<void> EndstonePluginManager::registerEvent(std::string event, std::functi
     }
 
     auto &handler_list = event_handlers_.emplace(event, event).first->second;
-    const auto *handler = handler_list.registerHandler(
-        std::make_unique<EventHandler>(event, executor, priority, plugin, ignore_cancelled));
+    auto *handler = handler_list.registerHandler(
+        std::make_unique<EventHandler>(event, executor, priority, plugin, ignore_cancelled, ++next_handler_id_));
     if (!handler) {
         return nonstd::make_unexpected(
             make_error("Plugin {} failed to register listener for event {}: Handler type mismatch",
                        plugin.getDescription().getFullName(), event));
     }
-    return {};
+    return handler;
+}
+
+bool EndstonePluginManager::checkThread(const Event &event) const
+{
+    if (event.isAsynchronous() && server_.isPrimaryThread()) {
+        server_.getLogger().error("{} cannot be triggered asynchronously from server thread.", event.getEventName());
+        return false;
+    }
+
+    if (!event.isAsynchronous() && !server_.isPrimaryThread()) {
+        server_.getLogger().error("{} must be triggered synchronously from server thread.", event.getEventName());
+        return false;
+    }
+    return true;
 }
 
 Permission *EndstonePluginManager::getPermission(std::string name) const
@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -48,8 +51,15 @@ public:
 
     /** Event system */
     void callEvent(Event &event) override;
+    void callEvent(Event &event, const std::vector<EventHandler *> &handlers,
+                   const std::function<bool(std::size_t)> &filter = {});
+    [[nodiscard]] bool hasEventHandlers(const std::string &event) const;
+    [[nodiscard]] std::vector<EventHandler *> getEventHandlers(const std::string &event) const;
     Result<void> registerEvent(std::string event, std::function<void(Event &)> executor, EventPriority priority,
                                Plugin &plugin, bool ignore_cancelled) override;
+    Result<void> registerMoveEvent(std::function<void(Event &)> executor, PlayerMoveThreshold threshold,
+                                   EventPriority priority, Plugin &plugin, bool ignore_cancelled) override;
+    [[nodiscard]] PlayerMoveThreshold getMoveThreshold(const EventHandler &handler) const;
 
     /** Permission system */
     [[nodiscard]] Permission *getPermission(std::string name) const override;
@@ -71,11 +81,18 @@ private:
     bool initPlugin(Plugin &plugin, PluginLoader &loader, const std::filesystem::path &base_folder);
     void calculatePermissionDefault(Permission &perm);
     void dirtyPermissibles(bool op) const;
+    [[nodiscard]] bool checkThread(const Event &event) const;
+    // must be called with event_handlers_mtx_ held exclusively
+    Result<EventHandler *> addEventHandler(std::string event, std::function<void(Event &)> executor,
+                                           EventPriority priority, Plugin &plugin, bool ignore_cancelled);
     Server &server_;
     std::vector<std::unique_ptr<PluginLoader>> plugin_loaders_;
     std::vector<Plugin *> plugins_;
     std::unordered_map<std::string, Plugin *> lookup_names_;
-    std::unordered_map<std::string, HandlerList> event_handlers_;
+    std::unordered_map<std::string, HandlerList> event_handlers_;  // events are called from worker threads too
+    mutable std::shared_mutex event_handlers_mtx_;
+    std::uint64_t next_handler_id_{0};
+    std::unordered_map<std::uint64_t, PlayerMoveThreshold> move_thresholds_;
     std::unordered_map<std::string, std::unique_ptr<Permission>> permissions_;
     std::unordered_map<bool, std::unordered_set<Permission *>> default_perms_;
     std::unordered_map<std::string, std::unordered_map<Permissible *, bool>> perm_subs_;
@@ -18,6 +18,7 @@
 namespace py = pybind11;
 
 #include "endstone/core/logger_factory.h"
+#include "endstone/core/scheduler/scheduler.h"
 
 namespace endstone::core {
 
@@ -33,6 +34,11 @@ PythonPluginLoader::PythonPluginLoader(Server &server) : PluginLoader(server)
         server.getLogger().error("Error occurred when trying to register a plugin loader: {}", e.what());
         throw;
     }
+
+    // pump the asyncio event loop of Python plugins once per tick
+    heartbeat_hook_ = std::make_shared<EndstoneScheduler::HeartbeatHook>(
+        [this](std::uint64_t current_tick) { tick(current_tick); });
+    static_cast<EndstoneScheduler &>(server.getScheduler()).addHeartbeatHook(heartbeat_hook_);
 }
 
 PythonPluginLoader::~PythonPluginLoader()
@@ -72,4 +78,15 @@ PluginLoader *PythonPluginLoader::pimpl() const
     return obj_.cast<PluginLoader *>();
 }
 
+void PythonPluginLoader::tick(std::uint64_t current_tick)
+{
+    py::gil_scoped_acquire gil{};
+    try {
+        obj_.attr("_tick")(current_tick);
+    }
+    catch (std::exception &e) {
+        server_.getLogger().error("Error occurred when running the event loop: {}", e.what());
+    }
+}
+
 }  // namespace endstone::core
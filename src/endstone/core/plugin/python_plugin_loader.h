@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <string_view>
 
 #include <pybind11/embed.h>
@@ -35,8 +37,10 @@ public:
 
 private:
     [[nodiscard]] PluginLoader *pimpl() const;
+    void tick(std::uint64_t current_tick);
 
     pybind11::object obj_;
+    std::shared_ptr<std::function<void(std::uint64_t)>> heartbeat_hook_;
 };
 
 }  // namespace endstone::core
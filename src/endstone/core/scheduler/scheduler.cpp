@@ -14,6 +14,9 @@
 
 #include "endstone/core/scheduler/scheduler.h"
 
+#include <algorithm>
+#include <functional>
+
 #include "endstone/core/scheduler/async_task.h"
 #include "endstone/core/util/error.h"
 
@@ -99,22 +102,25 @@ void EndstoneScheduler::cancelTask(TaskId id)
 
 void EndstoneScheduler::cancelTasks(Plugin &plugin)
 {
-    std::lock_guard lock{tasks_mtx_};
-    for (auto it = tasks_.begin(); it != tasks_.end();) {
-        if (it->second->getOwner() != &plugin) {
-            ++it;
-        }
-        else {
-            auto task = it->second;
-            task->doCancel();
-            if (task->isSync()) {
-                it = tasks_.erase(it);
+    {
+        std::lock_guard lock{tasks_mtx_};
+        for (auto it = tasks_.begin(); it != tasks_.end();) {
+            if (it->second->getOwner() != &plugin) {
+                ++it;
             }
             else {
-                ++it;
+                auto task = it->second;
+                task->doCancel();
+                if (task->isSync()) {
+                    it = tasks_.erase(it);
+                }
+                else {
+                    ++it;
+                }
             }
         }
     }
+    cancelCoroutines(plugin);
 }
 
 bool EndstoneScheduler::isRunning(TaskId id)
@@ -161,6 +167,11 @@ std::shared_ptr<Task> EndstoneScheduler::runTask(std::function<void()> task)
     return t;
 }
 
+void EndstoneScheduler::runAsync(std::function<void()> task)
+{
+    executor_.submit(std::move(task));
+}
+
 void EndstoneScheduler::addTask(std::shared_ptr<EndstoneTask> task)
 {
     pending_.enqueue(task);
@@ -170,6 +181,9 @@ void EndstoneScheduler::addTask(std::shared_ptr<EndstoneTask> task)
 
 void EndstoneScheduler::mainThreadHeartbeat(std::uint64_t current_tick)
 {
+    // set before running anything, so what the tasks schedule is relative to this tick rather than the previous one
+    current_tick_ = current_tick;
+
     // Consume the tasks in the pending queue
     std::shared_ptr<EndstoneTask> pending_task;
     while (pending_.try_dequeue(pending_task)) {
@@ -211,7 +225,7 @@ void EndstoneScheduler::mainThreadHeartbeat(std::uint64_t current_tick)
                 current_task_ = 0;
             }
             else {
-                executor_.submit([&task]() { task->run(); });
+                executor_.submit([task]() { task->run(); });
             }
 
             if (task->getPeriod() > 0) {  // repeating task
@@ -227,7 +241,132 @@ void EndstoneScheduler::mainThreadHeartbeat(std::uint64_t current_tick)
 
         it = queue_.erase(it);
     }
-    current_tick_ = current_tick;
+    runSyncCallbacks();
+    resumeCoroutines(current_tick);
+
+    std::erase_if(heartbeat_hooks_, [](const auto &hook) { return hook.expired(); });
+    for (std::size_t i = 0; i < heartbeat_hooks_.size(); ++i) {
+        // index rather than iterate, as hooks may be added while running
+        auto hook = heartbeat_hooks_[i].lock();
+        if (!hook) {
+            continue;
+        }
+        try {
+            (*hook)(current_tick);
+        }
+        catch (std::exception &e) {
+            server_.getLogger().error("Could not execute heartbeat hook: {}", e.what());
+        }
+    }
+}
+
+void EndstoneScheduler::postSync(Plugin &plugin, std::function<void()> callback)
+{
+    sync_callbacks_.enqueue({&plugin, std::move(callback)});
+}
+
+void EndstoneScheduler::runSyncCallbacks()
+{
+    // only run what was queued before this tick, callbacks queued while running wait for the next one
+    auto count = sync_callbacks_.size_approx();
+    if (count == 0) {
+        return;
+    }
+
+    sync_batch_.resize(count);
+    sync_batch_.resize(sync_callbacks_.try_dequeue_bulk(sync_batch_.begin(), count));
+    for (auto &[plugin, callback] : sync_batch_) {
+        if (!plugin->isEnabled()) {
+            continue;
+        }
+        try {
+            callback();
+        }
+        catch (std::exception &e) {
+            server_.getLogger().error("Plugin {} generated an exception while executing a callback: {}",
+                                      plugin->getName(), e.what());
+        }
+    }
+    sync_batch_.clear();
+}
+
+bool EndstoneScheduler::scheduleCoroutine(std::coroutine_handle<> handle, detail::CoroutineContext &context,
+                                          std::uint64_t delay, bool async)
+{
+    if (async) {
+        executor_.submit([handle, &context]() { resumeCoroutine(handle, context); });
+        return true;
+    }
+
+    if (delay == 0 && server_.isPrimaryThread()) {
+        return false;  // already on the server thread
+    }
+
+    pending_resumptions_.enqueue({current_tick_ + delay, 0, handle, &context});
+    return true;
+}
+
+void EndstoneScheduler::resumeCoroutines(std::uint64_t current_tick)
+{
+    std::unique_lock lock{resumptions_mtx_};
+    Resumption resumption;
+    while (pending_resumptions_.try_dequeue(resumption)) {
+        resumption.sequence = resumption_sequence_++;
+        resumptions_.push_back(resumption);
+        std::push_heap(resumptions_.begin(), resumptions_.end(), std::greater<>{});
+    }
+
+    // coroutines scheduled while resuming stay in the pending queue until the next heartbeat
+    while (!resumptions_.empty() && resumptions_.front().tick <= current_tick) {
+        std::pop_heap(resumptions_.begin(), resumptions_.end(), std::greater<>{});
+        resumption = resumptions_.back();
+        resumptions_.pop_back();
+
+        lock.unlock();
+        resumeCoroutine(resumption.handle, *resumption.context);
+        lock.lock();
+    }
+}
+
+void EndstoneScheduler::cancelCoroutines(Plugin &plugin)
+{
+    std::vector<std::coroutine_handle<>> roots;
+    {
+        std::lock_guard lock{resumptions_mtx_};
+        Resumption resumption;
+        while (pending_resumptions_.try_dequeue(resumption)) {
+            resumption.sequence = resumption_sequence_++;
+            resumptions_.push_back(resumption);
+        }
+
+        std::erase_if(resumptions_, [&](const Resumption &r) {
+            if (r.context->plugin != &plugin) {
+                return false;
+            }
+            roots.push_back(r.context->root);
+            return true;
+        });
+        std::make_heap(resumptions_.begin(), resumptions_.end(), std::greater<>{});
+    }
+
+    // destroying the outermost frame destroys the frames of the coroutines it awaits as well
+    for (auto root : roots) {
+        root.destroy();
+    }
+}
+
+void EndstoneScheduler::resumeCoroutine(std::coroutine_handle<> handle, detail::CoroutineContext &context)
+{
+    if (!context.plugin->isEnabled()) {
+        context.root.destroy();
+        return;
+    }
+    handle.resume();
+}
+
+void EndstoneScheduler::addHeartbeatHook(const std::shared_ptr<HeartbeatHook> &hook)
+{
+    heartbeat_hooks_.emplace_back(hook);
 }
 
 void EndstoneScheduler::removeTask(TaskId id)
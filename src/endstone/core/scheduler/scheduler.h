@@ -15,6 +15,8 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
+#include <memory>
 #include <mutex>
 
 #include <moodycamel/concurrentqueue.h>
@@ -42,29 +44,66 @@ public:
     bool isRunning(TaskId id) override;
     bool isQueued(TaskId id) override;
     std::vector<Task *> getPendingTasks() override;
+    void postSync(Plugin &plugin, std::function<void()> callback) override;
+    bool scheduleCoroutine(std::coroutine_handle<> handle, detail::CoroutineContext &context, std::uint64_t delay,
+                           bool async) override;
 
     std::shared_ptr<Task> runTask(std::function<void()> task);
+    void runAsync(std::function<void()> task);
     void addTask(std::shared_ptr<EndstoneTask> task);
     void mainThreadHeartbeat(std::uint64_t current_tick);
     void removeTask(TaskId id);
 
+    using HeartbeatHook = std::function<void(std::uint64_t)>;
+
+    /**
+     * @brief Registers a callback run by the server thread at the end of every heartbeat, after the due tasks.
+     *
+     * The scheduler only keeps a weak reference, the hook is unregistered once its owner releases it. Must be called
+     * from the server thread.
+     */
+    void addHeartbeatHook(const std::shared_ptr<HeartbeatHook> &hook);
+
 private:
     TaskId nextId();
+    void runSyncCallbacks();
+    void resumeCoroutines(std::uint64_t current_tick);
+    void cancelCoroutines(Plugin &plugin);
+    static void resumeCoroutine(std::coroutine_handle<> handle, detail::CoroutineContext &context);
 
     struct TaskComparator {
         bool operator()(const std::shared_ptr<EndstoneTask> &lhs, const std::shared_ptr<EndstoneTask> &rhs);
     };
 
+    struct Resumption {
+        std::uint64_t tick;
+        std::uint64_t sequence;
+        std::coroutine_handle<> handle;
+        detail::CoroutineContext *context;
+
+        bool operator>(const Resumption &other) const
+        {
+            return tick != other.tick ? tick > other.tick : sequence > other.sequence;
+        }
+    };
+
     Server &server_;
     std::atomic<TaskId> ids_{1};
     moodycamel::ConcurrentQueue<std::shared_ptr<EndstoneTask>> pending_{};
     std::unordered_map<TaskId, std::shared_ptr<EndstoneTask>> tasks_{};
     std::mutex tasks_mtx_{};
     std::map<std::uint64_t, std::vector<std::shared_ptr<EndstoneTask>>> queue_{};
-    std::uint64_t current_tick_{0};
+    std::atomic<std::uint64_t> current_tick_{0};  // written by the server thread, read by any thread
     std::atomic<TaskId> current_task_{0};
     TaskComparator cmp_{};
     ThreadPoolExecutor executor_;
+    std::vector<std::weak_ptr<HeartbeatHook>> heartbeat_hooks_{};
+    moodycamel::ConcurrentQueue<std::pair<Plugin *, std::function<void()>>> sync_callbacks_{};
+    std::vector<std::pair<Plugin *, std::function<void()>>> sync_batch_{};
+    moodycamel::ConcurrentQueue<Resumption> pending_resumptions_{};
+    std::vector<Resumption> resumptions_{};  // min-heap ordered by tick, then by the order of arrival
+    std::uint64_t resumption_sequence_{0};
+    std::mutex resumptions_mtx_{};
 };
 
 }  // namespace endstone::core
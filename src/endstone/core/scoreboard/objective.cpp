@@ -17,8 +17,6 @@
 #include <optional>
 #include <string>
 
-#include <magic_enum/magic_enum.hpp>
-
 #include "endstone/core/scoreboard/score.h"
 #include "endstone/core/scoreboard/scoreboard.h"
 #include "endstone/core/server.h"
@@ -26,38 +24,45 @@
 
 namespace endstone::core {
 
+ObjectiveHandle::ObjectiveHandle(::Objective &objective)
+    : objective(&objective), ref(objective), name(objective.getName()), criteria(objective.getCriteria())
+{
+}
+
 EndstoneObjective::EndstoneObjective(EndstoneScoreboard &scoreboard, ::Objective &objective)
-    : name_(objective.getName()), scoreboard_(scoreboard), objective_(objective), criteria_(objective.getCriteria())
+    : scoreboard_(scoreboard), handle_(scoreboard.getObjectiveHandle(objective))
 {
 }
 
 Result<std::string> EndstoneObjective::getName() const
 {
-    return checkState().and_then([](const auto *self) -> Result<std::string> { return self->objective_.getName(); });
+    return checkState().and_then([](const auto *self) -> Result<std::string> { return self->handle_->name; });
 }
 
 Result<std::string> EndstoneObjective::getDisplayName() const
 {
     return checkState().and_then(
-        [](const auto *self) -> Result<std::string> { return self->objective_.getDisplayName(); });
+        [](const auto *self) -> Result<std::string> { return self->getHandle().getDisplayName(); });
 }
 
 Result<void> EndstoneObjective::setDisplayName(std::string display_name)
 {
     return checkState().and_then([&display_name](const auto *self) -> Result<void> {
-        self->objective_.setDisplayName(display_name);
+        self->getHandle().setDisplayName(display_name);
         return {};
     });
 }
 
 Result<const Criteria *> EndstoneObjective::getCriteria() const
 {
-    return checkState().and_then([](const auto *self) -> Result<const Criteria *> { return &self->criteria_; });
+    return checkState().and_then(
+        [](const auto *self) -> Result<const Criteria *> { return &self->handle_->criteria; });
 }
 
 Result<bool> EndstoneObjective::isModifiable() const
 {
-    return checkState().and_then([](const auto *self) -> Result<bool> { return !self->criteria_.isReadOnly(); });
+    return checkState().and_then(
+        [](const auto *self) -> Result<bool> { return !self->handle_->criteria.isReadOnly(); });
 }
 
 Scoreboard &EndstoneObjective::getScoreboard() const
@@ -68,7 +73,7 @@ Scoreboard &EndstoneObjective::getScoreboard() const
 Result<void> EndstoneObjective::unregister() const
 {
     return checkState().and_then([](const auto *self) -> Result<void> {
-        self->scoreboard_.board_.removeObjective(&self->objective_);
+        self->scoreboard_.board_.removeObjective(&self->getHandle());
         return {};
     });
 }
@@ -77,7 +82,7 @@ Result<bool> EndstoneObjective::isDisplayed() const
 {
     bool displayed = false;
     return forEachDisplayObjective([&](auto /*slot*/, const auto &display) -> bool {
-               if (&display.getObjective() == &objective_) {
+               if (display.isDisplaying(*handle_->objective)) {
                    displayed = true;
                    return false;
                }
@@ -90,7 +95,7 @@ Result<DisplaySlot> EndstoneObjective::getDisplaySlot() const
 {
     std::optional<DisplaySlot> result;
     return forEachDisplayObjective([&](auto slot, const auto &display) -> bool {
-               if (&display.getObjective() == &objective_) {
+               if (display.isDisplaying(*handle_->objective)) {
                    result = slot;
                    return false;
                }
@@ -108,7 +113,7 @@ Result<ObjectiveSortOrder> EndstoneObjective::getSortOrder() const
 {
     std::optional<ObjectiveSortOrder> result;
     return forEachDisplayObjective([&](auto /*slot*/, const auto &display) -> bool {
-               if (&display.getObjective() == &objective_) {
+               if (display.isDisplaying(*handle_->objective)) {
                    result = static_cast<ObjectiveSortOrder>(display.getSortOrder());
                    return false;
                }
@@ -130,15 +135,15 @@ Result<void> EndstoneObjective::setDisplay(std::optional<DisplaySlot> slot)
 Result<void> EndstoneObjective::setDisplay(std::optional<DisplaySlot> slot, ObjectiveSortOrder order)
 {
     return forEachDisplayObjective([this](auto i, const auto &display) -> bool {
-               if (&display.getObjective() == &objective_) {
+               if (display.isDisplaying(*handle_->objective)) {
                    scoreboard_.board_.clearDisplayObjective(EndstoneScoreboard::getDisplaySlotName(i));
                }
                return true;
            })
         .and_then([&]() -> Result<void> {
             if (slot.has_value()) {
-                scoreboard_.board_.setDisplayObjective(EndstoneScoreboard::getDisplaySlotName(slot.value()), objective_,
-                                                       static_cast<::ObjectiveSortOrder>(order));
+                scoreboard_.board_.setDisplayObjective(EndstoneScoreboard::getDisplaySlotName(slot.value()),
+                                                       getHandle(), static_cast<::ObjectiveSortOrder>(order));
             }
             return {};
         });
@@ -147,7 +152,7 @@ Result<void> EndstoneObjective::setDisplay(std::optional<DisplaySlot> slot, Obje
 Result<RenderType> EndstoneObjective::getRenderType() const
 {
     return checkState().and_then([](const auto *self) -> Result<RenderType> {
-        return static_cast<RenderType>(self->objective_.getRenderType());
+        return static_cast<RenderType>(self->getHandle().getRenderType());
     });
 }
 
@@ -161,24 +166,35 @@ Result<void> EndstoneObjective::setRenderType(RenderType render_type)
 Result<std::unique_ptr<Score>> EndstoneObjective::getScore(ScoreEntry entry) const
 {
     return checkState().and_then([entry](const auto *self) -> Result<std::unique_ptr<Score>> {
-        return std::make_unique<EndstoneScore>(self->copy(), entry);
+        return std::make_unique<EndstoneScore>(*self, entry);
+    });
+}
+
+Result<void> EndstoneObjective::setScores(std::span<const std::pair<ScoreEntry, int>> scores)
+{
+    return checkState().and_then([&scores](const auto *self) -> Result<void> {
+        if (self->handle_->criteria.isReadOnly()) {
+            return nonstd::make_unexpected(make_error("Cannot modify read-only score."));
+        }
+        return self->scoreboard_.setScores(self->getHandle(), scores);
     });
 }
 
 Result<const EndstoneObjective *> EndstoneObjective::checkState() const
 {
-    if (scoreboard_.board_.getObjective(name_) == nullptr) {
-        return nonstd::make_unexpected(make_error("Objective '{}' is unregistered from the scoreboard.", name_));
+    // the board destroys the objective when it is removed, no matter who removes it
+    if (!handle_->ref.isValid()) {
+        return nonstd::make_unexpected(make_error("Objective '{}' is unregistered from the scoreboard.", handle_->name));
     }
     return this;
 }
 
-Result<void> EndstoneObjective::forEachDisplayObjective(
-    const std::function<bool(DisplaySlot, const DisplayObjective &)> &callback) const
+template <typename Callback>
+Result<void> EndstoneObjective::forEachDisplayObjective(Callback &&callback) const
 {
     return checkState().and_then([&callback](const EndstoneObjective *self) -> Result<void> {
-        for (auto const &slot : magic_enum::enum_values<DisplaySlot>()) {
-            const auto slot_name = EndstoneScoreboard::getDisplaySlotName(slot);
+        for (const auto slot : {DisplaySlot::BelowName, DisplaySlot::PlayerList, DisplaySlot::SideBar}) {
+            const auto &slot_name = EndstoneScoreboard::getDisplaySlotName(slot);
             if (const auto *display = self->scoreboard_.board_.getDisplayObjective(slot_name)) {
                 if (!callback(slot, *display)) {
                     return {};
@@ -191,12 +207,17 @@ Result<void> EndstoneObjective::forEachDisplayObjective(
 
 std::unique_ptr<EndstoneObjective> EndstoneObjective::copy() const
 {
-    return std::make_unique<EndstoneObjective>(scoreboard_, objective_);
+    return std::make_unique<EndstoneObjective>(*this);
+}
+
+::Objective &EndstoneObjective::getHandle() const
+{
+    return *handle_->objective;
 }
 
 bool EndstoneObjective::operator==(const Objective &other) const
 {
-    return &objective_ == &static_cast<const EndstoneObjective &>(other).objective_;
+    return handle_ == static_cast<const EndstoneObjective &>(other).handle_;
 }
 
 bool EndstoneObjective::operator!=(const Objective &other) const
@@ -14,10 +14,11 @@
 
 #pragma once
 
-#include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 
+#include "bedrock/core/utility/non_owner_pointer.h"
 #include "bedrock/world/scores/objective.h"
 #include "endstone/core/scoreboard/criteria.h"
 #include "endstone/scoreboard/display_slot.h"
@@ -27,6 +28,17 @@ namespace endstone::core {
 
 class EndstoneScoreboard;
 
+// Shared by all the wrappers of an objective, so that copying them is cheap and checking whether the objective is
+// still registered does not need a lookup by name.
+struct ObjectiveHandle {
+    explicit ObjectiveHandle(::Objective &objective);
+
+    ::Objective *objective;
+    Bedrock::NonOwnerPointer<::Objective> ref;  // becomes invalid once the board destroys the objective
+    std::string name;
+    EndstoneCriteria criteria;
+};
+
 class EndstoneObjective : public Objective {
 public:
     explicit EndstoneObjective(EndstoneScoreboard &scoreboard, ::Objective &objective);
@@ -46,22 +58,22 @@ public:
     [[nodiscard]] Result<RenderType> getRenderType() const override;
     Result<void> setRenderType(RenderType render_type) override;
     [[nodiscard]] Result<std::unique_ptr<Score>> getScore(ScoreEntry entry) const override;
+    Result<void> setScores(std::span<const std::pair<ScoreEntry, int>> scores) override;
     bool operator==(const Objective &other) const override;
     bool operator!=(const Objective &other) const override;
 
     [[nodiscard]] Result<const EndstoneObjective *> checkState() const;
     [[nodiscard]] std::unique_ptr<EndstoneObjective> copy() const;
+    [[nodiscard]] ::Objective &getHandle() const;
 
 private:
     friend class EndstoneScore;
 
-    Result<void> forEachDisplayObjective(
-        const std::function<bool(DisplaySlot, const DisplayObjective &)> &callback) const;
+    template <typename Callback>
+    Result<void> forEachDisplayObjective(Callback &&callback) const;
 
-    std::string name_;
     EndstoneScoreboard &scoreboard_;
-    ::Objective &objective_;
-    EndstoneCriteria criteria_;
+    std::shared_ptr<const ObjectiveHandle> handle_;
 };
 
 }  // namespace endstone::core
@@ -24,7 +24,7 @@
 
 namespace endstone::core {
 
-EndstoneScore::EndstoneScore(std::unique_ptr<EndstoneObjective> objective, ScoreEntry entry)
+EndstoneScore::EndstoneScore(EndstoneObjective objective, ScoreEntry entry)
     : objective_(std::move(objective)), entry_(std::move(entry))
 {
 }
@@ -36,67 +36,78 @@ ScoreEntry EndstoneScore::getEntry() const
 
 Result<int> EndstoneScore::getValue() const
 {
-    return objective_->checkState().and_then([&](const auto *obj) -> Result<int> {
-        return getScoreboardId().and_then([&](const auto *id) -> Result<int> {
-            if (id->isValid() && obj->objective_.hasScore(*id)) {
-                return obj->objective_.getPlayerScore(*id).value;
-            }
-            return 0;
-        });
-    });
+    return objective_.checkState().and_then(
+        [this](const auto * /*obj*/) -> Result<int> { return findScore().value_or(0); });
 }
 
 Result<void> EndstoneScore::setValue(int score)
 {
-    return objective_->checkState().and_then([&](const auto *obj) -> Result<void> {
-        return getOrCreateScoreboardId().and_then([&](const auto *id) -> Result<void> {
-            return obj->isModifiable().and_then([&](bool modifiable) -> Result<void> {
-                if (!modifiable) {
-                    return nonstd::make_unexpected(make_error("Cannot modify read-only score."));
-                }
-
-                bool success = false;
-                obj->scoreboard_.board_.modifyPlayerScore(success, *id, obj->objective_, score,
-                                                          PlayerScoreSetFunction::Set);
-
-                if (!success) {
-                    return nonstd::make_unexpected(make_error("Unable to modify score."));
-                }
-                return {};
-            });
-        });
+    return objective_.checkState().and_then([&](const auto *obj) -> Result<void> {
+        if (obj->handle_->criteria.isReadOnly()) {
+            return nonstd::make_unexpected(make_error("Cannot modify read-only score."));
+        }
+        return obj->scoreboard_.setScore(obj->getHandle(), getOrCreateScoreboardId(), score);
     });
 }
 
 Result<bool> EndstoneScore::isScoreSet() const
 {
-    return objective_->checkState().and_then([&](const auto *obj) -> Result<bool> {
-        return getScoreboardId().and_then(
-            [&](const auto *id) -> Result<bool> { return id->isValid() && obj->objective_.hasScore(*id); });
-    });
+    return objective_.checkState().and_then(
+        [this](const auto * /*obj*/) -> Result<bool> { return findScore().has_value(); });
 }
 
 Objective &EndstoneScore::getObjective() const
 {
-    return *objective_;
+    return const_cast<EndstoneObjective &>(objective_);
 }
 
 Scoreboard &EndstoneScore::getScoreboard() const
 {
-    return objective_->getScoreboard();
+    return objective_.getScoreboard();
 }
 
-Result<const ScoreboardId *> EndstoneScore::getScoreboardId() const
+std::optional<int> EndstoneScore::findScore() const
 {
-    return objective_->checkState().and_then(
-        [this](const auto *obj) -> Result<const ScoreboardId *> { return &obj->scoreboard_.getScoreboardId(entry_); });
+    const auto &scoreboard = objective_.scoreboard_;
+    const auto &objective = objective_.getHandle();
+    const auto find = [&](const ::ScoreboardId &id) -> std::optional<int> {
+        if (!id.isValid()) {
+            return std::nullopt;
+        }
+        if (auto pending = scoreboard.getPendingScore(objective, id); pending) {
+            return pending;
+        }
+        if (auto it = objective.getScores().find(id); it != objective.getScores().end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    };
+
+    const bool cached = id_.isCached(scoreboard.generation_);
+    if (auto score = find(getScoreboardId()); score || !cached) {
+        return score;
+    }
+    // the identity may have been reset and created again by a command since we cached it
+    id_.invalidate();
+    return find(getScoreboardId());
 }
 
-Result<const ScoreboardId *> EndstoneScore::getOrCreateScoreboardId()
+const ::ScoreboardId &EndstoneScore::getScoreboardId() const
 {
-    return objective_->checkState().and_then([this](const auto *obj) -> Result<const ScoreboardId *> {
-        return &obj->scoreboard_.getOrCreateScoreboardId(entry_);
-    });
+    const auto &scoreboard = objective_.scoreboard_;
+    return id_.get(scoreboard.generation_,
+                   [&]() -> const ::ScoreboardId & { return scoreboard.getScoreboardId(entry_); });
+}
+
+const ::ScoreboardId &EndstoneScore::getOrCreateScoreboardId()
+{
+    auto &scoreboard = objective_.scoreboard_;
+    if (const auto &id = getScoreboardId(); id.isValid() && scoreboard.board_.hasIdentityFor(id)) {
+        return id;
+    }
+    id_.invalidate();
+    return id_.get(scoreboard.generation_,
+                   [&]() -> const ::ScoreboardId & { return scoreboard.getOrCreateScoreboardId(entry_); });
 }
 
 }  // namespace endstone::core
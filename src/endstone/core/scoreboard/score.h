@@ -14,19 +14,19 @@
 
 #pragma once
 
-#include <memory>
+#include <optional>
 
 #include "bedrock/world/scores/scoreboard_id.h"
+#include "endstone/core/scoreboard/objective.h"
+#include "endstone/core/scoreboard/scoreboard_id_cache.h"
 #include "endstone/scoreboard/score.h"
 #include "endstone/scoreboard/score_entry.h"
 
 namespace endstone::core {
 
-class EndstoneObjective;
-
 class EndstoneScore : public Score {
 public:
-    EndstoneScore(std::unique_ptr<EndstoneObjective> objective, ScoreEntry entry);
+    EndstoneScore(EndstoneObjective objective, ScoreEntry entry);
     [[nodiscard]] ScoreEntry getEntry() const override;
     [[nodiscard]] Result<int> getValue() const override;
     Result<void> setValue(int score) override;
@@ -35,11 +35,13 @@ public:
     [[nodiscard]] Scoreboard &getScoreboard() const override;
 
 private:
-    [[nodiscard]] Result<const ScoreboardId *> getScoreboardId() const;
-    [[nodiscard]] Result<const ScoreboardId *> getOrCreateScoreboardId();
+    [[nodiscard]] std::optional<int> findScore() const;
+    [[nodiscard]] const ::ScoreboardId &getScoreboardId() const;
+    const ::ScoreboardId &getOrCreateScoreboardId();
 
-    std::unique_ptr<EndstoneObjective> objective_;
+    EndstoneObjective objective_;
     ScoreEntry entry_;
+    mutable ScoreboardIdCache id_;
 };
 
 }  // namespace endstone::core
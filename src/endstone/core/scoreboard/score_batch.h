@@ -0,0 +1,180 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace endstone::core {
+
+/**
+ * Score changes that have not been applied to a board yet, grouped by objective in the order they were made.
+ *
+ * Several changes of the same score are coalesced, the last one wins, and changes to the current score are dropped.
+ * Flushing applies the changes of an objective with the board muted and sends them in a single broadcast.
+ *
+ * The board is accessed through Board, which must provide:
+ * - Objective and Id: the objective and scoreboard id types, Id being hashable
+ * - getName(objective) and isRegistered(objective, name) to check that an objective is still on the board
+ * - getScore(objective, id), which returns std::nullopt if there is no score, and setScore(objective, id, score)
+ * - setMuted(muted) to stop the board from sending a packet for each change
+ * - broadcast(objective, changes) to send the changes that were applied
+ */
+template <typename Board>
+class ScoreBatch {
+public:
+    using Objective = typename Board::Objective;
+    using Id = typename Board::Id;
+
+    void add(const Board &board, Objective &objective, const Id &id, int score)
+    {
+        auto &pending = get(board, objective);
+        if (auto it = pending.index.find(id); it != pending.index.end()) {
+            pending.scores[it->second].second = score;  // last write wins
+            return;
+        }
+        if (board.getScore(objective, id) == score) {
+            return;  // nothing changes
+        }
+        pending.index.emplace(id, pending.scores.size());
+        pending.scores.emplace_back(id, score);
+    }
+
+    [[nodiscard]] std::optional<int> find(const Objective &objective, const Id &id) const
+    {
+        for (const auto &pending : pending_) {
+            if (pending.objective != &objective) {
+                continue;
+            }
+            if (auto it = pending.index.find(id); it != pending.index.end()) {
+                return pending.scores[it->second].second;
+            }
+            break;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * Drops the changes to the scores of an id in all objectives.
+     */
+    void erase(const Id &id)
+    {
+        for (auto &pending : pending_) {
+            if (!pending.index.erase(id)) {
+                continue;
+            }
+            std::erase_if(pending.scores, [&](const auto &score) { return score.first == id; });
+            for (std::size_t i = 0; i < pending.scores.size(); ++i) {
+                pending.index[pending.scores[i].first] = i;
+            }
+        }
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return pending_.empty();
+    }
+
+    /**
+     * Applies the changes of an objective.
+     *
+     * @return false if a change could not be applied
+     */
+    bool flush(Board &board, Objective &objective)
+    {
+        for (auto &pending : pending_) {
+            if (pending.objective == &objective) {
+                return flush(board, pending);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Applies the changes of all objectives.
+     */
+    void flush(Board &board)
+    {
+        for (auto &pending : pending_) {
+            flush(board, pending);
+        }
+        // objectives are few, but may come and go
+        std::erase_if(pending_, [](const auto &pending) { return pending.scores.empty(); });
+    }
+
+private:
+    struct Pending {
+        Objective *objective;
+        std::string name;
+        std::vector<std::pair<Id, int>> scores;
+        std::unordered_map<Id, std::size_t> index;
+    };
+
+    Pending &get(const Board &board, Objective &objective)
+    {
+        for (auto &pending : pending_) {
+            if (pending.objective == &objective) {
+                return pending;
+            }
+        }
+        return pending_.emplace_back(Pending{&objective, board.getName(objective), {}, {}});
+    }
+
+    bool flush(Board &board, Pending &pending)
+    {
+        if (pending.scores.empty()) {
+            return true;
+        }
+
+        // the objective may have been unregistered since, and its address reused
+        if (!board.isRegistered(*pending.objective, pending.name)) {
+            pending.scores.clear();
+            pending.index.clear();
+            return false;
+        }
+
+        bool result = true;
+        changes_.clear();
+        board.setMuted(true);
+        for (const auto &[id, score] : pending.scores) {
+            if (board.getScore(*pending.objective, id) == score) {
+                continue;
+            }
+            if (!board.setScore(*pending.objective, id, score)) {
+                result = false;
+                continue;
+            }
+            changes_.emplace_back(id, score);
+        }
+        board.setMuted(false);
+        pending.scores.clear();
+        pending.index.clear();
+
+        if (!changes_.empty()) {
+            board.broadcast(*pending.objective, changes_);
+        }
+        return result;
+    }
+
+    std::vector<Pending> pending_;
+    std::vector<std::pair<Id, int>> changes_;
+};
+
+}  // namespace endstone::core
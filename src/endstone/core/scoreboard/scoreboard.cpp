@@ -16,6 +16,8 @@
 
 #include <stdexcept>
 
+#include "bedrock/network/packet.h"
+#include "bedrock/network/packet/set_score_packet.h"
 #include "bedrock/world/actor/actor.h"
 #include "bedrock/world/actor/player/player.h"
 #include "bedrock/world/scores/objective_criteria.h"
@@ -117,8 +119,8 @@ std::vector<std::unique_ptr<Score>> EndstoneScoreboard::getScores(ScoreEntry ent
 {
     std::vector<std::unique_ptr<Score>> result;
     board_.forEachObjective([&](auto &objective) {
-        auto obj = std::make_unique<EndstoneObjective>(const_cast<EndstoneScoreboard &>(*this), objective);
-        result.push_back(std::make_unique<EndstoneScore>(std::move(obj), entry));
+        result.push_back(std::make_unique<EndstoneScore>(
+            EndstoneObjective(const_cast<EndstoneScoreboard &>(*this), objective), entry));
     });
     return result;
 }
@@ -127,7 +129,10 @@ void EndstoneScoreboard::resetScores(ScoreEntry entry)
 {
     const auto &scoreboard_id = getScoreboardId(entry);
     if (scoreboard_id.isValid()) {
-        board_.resetPlayerScore(getScoreboardId(entry));
+        // drop the buffered changes too, or they would bring the scores back at the end of the tick
+        pending_scores_.erase(scoreboard_id);
+        board_.resetPlayerScore(scoreboard_id);
+        ++generation_;
     }
 }
 
@@ -172,6 +177,19 @@ void EndstoneScoreboard::clearSlot(DisplaySlot slot)
     board_.clearDisplayObjective(getDisplaySlotName(slot));
 }
 
+bool EndstoneScoreboard::isBuffered() const
+{
+    return buffered_;
+}
+
+void EndstoneScoreboard::setBuffered(bool buffered)
+{
+    buffered_ = buffered;
+    if (!buffered_) {
+        flush();
+    }
+}
+
 std::string EndstoneScoreboard::getCriteriaName(Criteria::Type type)
 {
     switch (type) {
@@ -182,15 +200,18 @@ std::string EndstoneScoreboard::getCriteriaName(Criteria::Type type)
     }
 }
 
-std::string EndstoneScoreboard::getDisplaySlotName(DisplaySlot slot)
+const std::string &EndstoneScoreboard::getDisplaySlotName(DisplaySlot slot)
 {
+    static const std::string below_name = "belowname";
+    static const std::string player_list = "list";
+    static const std::string side_bar = "sidebar";
     switch (slot) {
     case DisplaySlot::BelowName:
-        return "belowname";
+        return below_name;
     case DisplaySlot::PlayerList:
-        return "list";
+        return player_list;
     case DisplaySlot::SideBar:
-        return "sidebar";
+        return side_bar;
     default:
         throw std::runtime_error("Unknown DisplaySlot!");
     }
@@ -235,4 +256,125 @@ const ::ScoreboardId &EndstoneScoreboard::getOrCreateScoreboardId(ScoreEntry ent
     return board_;
 }
 
+std::shared_ptr<const ObjectiveHandle> EndstoneScoreboard::getObjectiveHandle(::Objective &objective) const
+{
+    auto &handle = objective_handles_[&objective];
+    // a dead handle means the objective was destroyed and another one took its address
+    if (!handle || !handle->ref.isValid()) {
+        handle = std::make_shared<ObjectiveHandle>(objective);
+    }
+    return handle;
+}
+
+Result<void> EndstoneScoreboard::setScore(::Objective &objective, const ::ScoreboardId &id, int score)
+{
+    if (buffered_) {
+        pending_scores_.add(BatchBoard{*this}, objective, id, score);
+        return {};
+    }
+
+    // nothing is pending when unbuffered, and the board sends a single packet for a single change anyway
+    if (auto it = objective.getScores().find(id); it != objective.getScores().end() && it->second == score) {
+        return {};
+    }
+    bool success = false;
+    board_.modifyPlayerScore(success, id, objective, score, PlayerScoreSetFunction::Set);
+    if (!success) {
+        return nonstd::make_unexpected(make_error("Unable to modify score."));
+    }
+    return {};
+}
+
+Result<void> EndstoneScoreboard::setScores(::Objective &objective,
+                                          std::span<const std::pair<ScoreEntry, int>> scores)
+{
+    if (!buffered_ && scores.size() == 1) {
+        return setScore(objective, getOrCreateScoreboardId(scores[0].first), scores[0].second);
+    }
+
+    BatchBoard board{*this};
+    for (const auto &[entry, score] : scores) {
+        pending_scores_.add(board, objective, getOrCreateScoreboardId(entry), score);
+    }
+
+    if (!buffered_ && !pending_scores_.flush(board, objective)) {
+        return nonstd::make_unexpected(make_error("Unable to modify score."));
+    }
+    return {};
+}
+
+std::optional<int> EndstoneScoreboard::getPendingScore(const ::Objective &objective, const ::ScoreboardId &id) const
+{
+    return pending_scores_.find(objective, id);
+}
+
+void EndstoneScoreboard::flush()
+{
+    BatchBoard board{*this};
+    pending_scores_.flush(board);
+    std::erase_if(objective_handles_, [](const auto &it) { return !it.second->ref.isValid(); });
+}
+
+std::string EndstoneScoreboard::BatchBoard::getName(const ::Objective &objective) const
+{
+    return objective.getName();
+}
+
+bool EndstoneScoreboard::BatchBoard::isRegistered(const ::Objective &objective, const std::string &name) const
+{
+    return scoreboard.board_.getObjective(name) == &objective;
+}
+
+std::optional<int> EndstoneScoreboard::BatchBoard::getScore(const ::Objective &objective,
+                                                            const ::ScoreboardId &id) const
+{
+    if (auto it = objective.getScores().find(id); it != objective.getScores().end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+bool EndstoneScoreboard::BatchBoard::setScore(::Objective &objective, const ::ScoreboardId &id, int score) const
+{
+    bool success = false;
+    scoreboard.board_.modifyPlayerScore(success, id, objective, score, PlayerScoreSetFunction::Set);
+    return success;
+}
+
+void EndstoneScoreboard::BatchBoard::setMuted(bool muted) const
+{
+    scoreboard.packet_sender_->setMuted(muted);
+}
+
+void EndstoneScoreboard::BatchBoard::broadcast(const ::Objective &objective,
+                                               std::span<const std::pair<::ScoreboardId, int>> changes) const
+{
+    // like the board itself, only send the scores of objectives that are displayed
+    if (!scoreboard.isDisplayed(objective)) {
+        return;
+    }
+
+    auto packet = MinecraftPackets::createPacket(MinecraftPacketIds::SetScore);
+    auto pk = std::static_pointer_cast<SetScorePacket>(packet);
+    pk->type = ScorePacketType::Change;
+    pk->score_info.reserve(changes.size());
+    for (const auto &[id, score] : changes) {
+        const auto &identity = id.getIdentityDef();
+        pk->score_info.push_back({id, objective.getName(), score, identity.getIdentityType(), identity.getPlayerId(),
+                                  identity.getEntityId(), identity.getFakePlayerName()});
+    }
+    scoreboard.packet_sender_->sendBroadcast(*packet);
+}
+
+bool EndstoneScoreboard::isDisplayed(const ::Objective &objective) const
+{
+    for (const auto slot : {DisplaySlot::BelowName, DisplaySlot::PlayerList, DisplaySlot::SideBar}) {
+        if (const auto *display = board_.getDisplayObjective(getDisplaySlotName(slot));
+            display && display->isDisplaying(objective)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 }  // namespace endstone::core
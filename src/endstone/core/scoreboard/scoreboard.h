@@ -14,14 +14,24 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "bedrock/world/scores/scoreboard.h"
+#include "endstone/core/scoreboard/score_batch.h"
 #include "endstone/core/scoreboard/scoreboard_packet_sender.h"
 #include "endstone/scoreboard/scoreboard.h"
 
 namespace endstone::core {
 
+struct ObjectiveHandle;
+
 class EndstoneScoreboard : public Scoreboard {
 public:
     explicit EndstoneScoreboard(::Scoreboard &board);
@@ -42,20 +52,49 @@ public:
     void resetScores(ScoreEntry entry) override;
     [[nodiscard]] std::vector<ScoreEntry> getEntries() const override;
     void clearSlot(DisplaySlot slot) override;
+    [[nodiscard]] bool isBuffered() const override;
+    void setBuffered(bool buffered) override;
     [[nodiscard]] const ::ScoreboardId &getScoreboardId(ScoreEntry entry) const;
     const ::ScoreboardId &getOrCreateScoreboardId(ScoreEntry entry);
     [[nodiscard]] ::Scoreboard &getHandle() const;
+    [[nodiscard]] std::shared_ptr<const ObjectiveHandle> getObjectiveHandle(::Objective &objective) const;
+
+    Result<void> setScore(::Objective &objective, const ::ScoreboardId &id, int score);
+    Result<void> setScores(::Objective &objective, std::span<const std::pair<ScoreEntry, int>> scores);
+    [[nodiscard]] std::optional<int> getPendingScore(const ::Objective &objective, const ::ScoreboardId &id) const;
+    void flush();
 
     static std::string getCriteriaName(Criteria::Type type);
-    static std::string getDisplaySlotName(DisplaySlot slot);
+    static const std::string &getDisplaySlotName(DisplaySlot slot);
 
 private:
     friend class EndstoneObjective;
     friend class EndstoneScore;
 
+    // gives ScoreBatch access to the board
+    struct BatchBoard {
+        using Objective = ::Objective;
+        using Id = ::ScoreboardId;
+
+        [[nodiscard]] std::string getName(const ::Objective &objective) const;
+        [[nodiscard]] bool isRegistered(const ::Objective &objective, const std::string &name) const;
+        [[nodiscard]] std::optional<int> getScore(const ::Objective &objective, const ::ScoreboardId &id) const;
+        bool setScore(::Objective &objective, const ::ScoreboardId &id, int score) const;
+        void setMuted(bool muted) const;
+        void broadcast(const ::Objective &objective, std::span<const std::pair<::ScoreboardId, int>> changes) const;
+
+        EndstoneScoreboard &scoreboard;
+    };
+
+    [[nodiscard]] bool isDisplayed(const ::Objective &objective) const;
+
     ::Scoreboard &board_;
     std::unique_ptr<::Scoreboard> holder_;
     std::unique_ptr<ScoreboardPacketSender> packet_sender_;
+    bool buffered_{false};
+    ScoreBatch<BatchBoard> pending_scores_;
+    mutable std::unordered_map<const ::Objective *, std::shared_ptr<ObjectiveHandle>> objective_handles_;
+    std::uint32_t generation_{0};  // bumped whenever identities are reset, see ScoreboardIdCache
 };
 
 }  // namespace endstone::core
@@ -0,0 +1,54 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+
+#include "bedrock/world/scores/scoreboard_id.h"
+
+namespace endstone::core {
+
+// Remembers the ScoreboardId a score entry resolved to, so that reading and writing the same score again skips the
+// identity lookup. The id is resolved again once the generation of the scoreboard changes, i.e. identities were reset.
+class ScoreboardIdCache {
+public:
+    template <typename Resolve>
+    const ::ScoreboardId &get(std::uint32_t generation, Resolve &&resolve)
+    {
+        // an unknown entry may get an identity at any time, so misses are never cached
+        if (!id_.isValid() || generation_ != generation) {
+            id_ = resolve();
+            generation_ = generation;
+        }
+        return id_;
+    }
+
+    [[nodiscard]] bool isCached(std::uint32_t generation) const
+    {
+        return id_.isValid() && generation_ == generation;
+    }
+
+    void invalidate()
+    {
+        id_ = ::ScoreboardId::INVALID;
+    }
+
+private:
+    ::ScoreboardId id_;
+    std::uint32_t generation_{0};
+};
+
+}  // namespace endstone::core
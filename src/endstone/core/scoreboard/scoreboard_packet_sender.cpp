@@ -83,6 +83,10 @@ void ScoreboardPacketSender::sendToClients(
 
 void ScoreboardPacketSender::sendBroadcast(const ::Packet &packet)
 {
+    if (muted_) {
+        return;
+    }
+
     for (const auto &item : server_.getOnlinePlayers()) {
         auto *player = static_cast<EndstonePlayer *>(item);
 
@@ -105,4 +109,9 @@ void ScoreboardPacketSender::flush(const NetworkIdentifier &network_identifier,
     sender_.flush(network_identifier, std::forward<decltype(callback)>(callback));
 }
 
+void ScoreboardPacketSender::setMuted(bool muted)
+{
+    muted_ = muted;
+}
+
 }  // namespace endstone::core
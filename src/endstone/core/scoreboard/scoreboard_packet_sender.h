@@ -35,10 +35,16 @@ public:
     void sendBroadcast(const NetworkIdentifier &, SubClientId, const ::Packet &) override;
     void flush(const NetworkIdentifier &, std::function<void()> &&) override;
 
+    /**
+     * Drops the packets broadcast by the scoreboard while muted, e.g. while applying changes that are sent in bulk.
+     */
+    void setMuted(bool muted);
+
 private:
     EndstoneServer &server_;
     EndstoneScoreboard &scoreboard_;
     PacketSender &sender_;
+    bool muted_{false};
 };
 
 }  // namespace endstone::core
@@ -0,0 +1,260 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "endstone/core/scoreboard/virtual_scoreboard.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "endstone/actor/actor.h"
+#include "endstone/player.h"
+#include "endstone/variant.h"
+
+namespace endstone::core {
+
+namespace {
+std::size_t getHeapSize(const std::string &str)
+{
+    // short strings are stored inline
+    const auto *begin = reinterpret_cast<const char *>(&str);
+    if (str.data() >= begin && str.data() < begin + sizeof(str)) {
+        return 0;
+    }
+    return str.capacity() + 1;
+}
+}  // namespace
+
+void EndstoneVirtualScoreboard::setDisplay(DisplaySlot slot, std::string display_name)
+{
+    setDisplay(slot, std::move(display_name), ObjectiveSortOrder::Ascending);
+}
+
+void EndstoneVirtualScoreboard::setDisplay(DisplaySlot slot, std::string display_name, ObjectiveSortOrder order)
+{
+    auto &display = getDisplay(slot);
+    if (display.displayed && display.display_name == display_name && display.order == order) {
+        return;
+    }
+    display.display_name = std::move(display_name);
+    display.order = order;
+    display.displayed = true;
+    display.changed = true;
+    dirty_ = true;
+}
+
+void EndstoneVirtualScoreboard::clearDisplay(DisplaySlot slot)
+{
+    auto &display = getDisplay(slot);
+    if (!display.displayed && display.entries.empty()) {
+        return;
+    }
+    display.display_name.clear();
+    display.displayed = false;
+    display.changed = true;
+    display.entries.clear();
+    dirty_ = true;
+}
+
+bool EndstoneVirtualScoreboard::isDisplayed(DisplaySlot slot) const
+{
+    return getDisplay(slot).displayed;
+}
+
+std::optional<int> EndstoneVirtualScoreboard::getScore(DisplaySlot slot, ScoreEntry entry) const
+{
+    const auto key = getKey(entry);
+    for (const auto &e : getDisplay(slot).entries) {
+        if (!e.removed && e.type == key.type && e.actor_id == key.actor_id && e.name == key.name) {
+            return e.score;
+        }
+    }
+    return std::nullopt;
+}
+
+void EndstoneVirtualScoreboard::setScore(DisplaySlot slot, ScoreEntry entry, int score)
+{
+    setScore(getDisplay(slot), getKey(entry), score);
+}
+
+void EndstoneVirtualScoreboard::resetScore(DisplaySlot slot, ScoreEntry entry)
+{
+    auto &entries = getDisplay(slot).entries;
+    if (auto *e = find(entries, getKey(entry)); e && !e->removed) {
+        resetScore(entries, *e);
+        dirty_ = true;
+    }
+}
+
+void EndstoneVirtualScoreboard::setLines(DisplaySlot slot, const std::vector<std::string> &lines)
+{
+    auto &display = getDisplay(slot);
+    const auto count = static_cast<int>(lines.size());
+
+    // remove the entries that are not one of the lines, starting from the back as unsent entries are erased
+    for (auto i = display.entries.size(); i-- > 0;) {
+        auto &e = display.entries[i];
+        if (e.removed) {
+            continue;
+        }
+        if (e.type != EntryType::FakePlayer || std::find(lines.begin(), lines.end(), e.name) == lines.end()) {
+            resetScore(display.entries, e);
+            dirty_ = true;
+        }
+    }
+
+    // number the lines so that the first one is shown at the top
+    for (int i = 0; i < count; ++i) {
+        const auto score = display.order == ObjectiveSortOrder::Ascending ? i + 1 : count - i;
+        setScore(display, {EntryType::FakePlayer, -1, lines[i]}, score);
+    }
+}
+
+bool EndstoneVirtualScoreboard::isDirty() const
+{
+    return dirty_;
+}
+
+std::vector<EndstoneVirtualScoreboard::Update> EndstoneVirtualScoreboard::takeUpdates()
+{
+    std::vector<Update> updates;
+    if (!dirty_) {
+        return updates;
+    }
+    dirty_ = false;
+
+    for (const auto slot : {DisplaySlot::BelowName, DisplaySlot::PlayerList, DisplaySlot::SideBar}) {
+        auto &display = getDisplay(slot);
+        Update update{slot, false, false, {}, display.order, {}, {}};
+
+        if (display.changed) {
+            // the client drops the scores with the objective, so everything is sent again
+            update.remove = display.sent;
+            update.display = display.displayed;
+            update.display_name = display.display_name;
+            display.sent = display.displayed;
+            display.changed = false;
+            std::erase_if(display.entries, [](const auto &e) { return e.removed; });
+            for (auto &e : display.entries) {
+                e.sent = false;
+            }
+        }
+        else {
+            std::erase_if(display.entries, [&](const auto &e) {
+                if (e.removed && display.sent) {
+                    update.removed.push_back(e.id);
+                }
+                return e.removed;
+            });
+        }
+
+        if (display.sent) {
+            for (auto &e : display.entries) {
+                if (!e.sent || e.score != e.sent_score) {
+                    update.changed.push_back(&e);
+                    e.sent = true;
+                    e.sent_score = e.score;
+                }
+            }
+        }
+
+        if (update.remove || update.display || !update.removed.empty() || !update.changed.empty()) {
+            updates.push_back(std::move(update));
+        }
+    }
+    return updates;
+}
+
+std::size_t EndstoneVirtualScoreboard::getMemoryUsage() const
+{
+    auto size = sizeof(*this);
+    for (const auto &display : displays_) {
+        size += getHeapSize(display.display_name) + display.entries.capacity() * sizeof(Entry);
+        for (const auto &entry : display.entries) {
+            size += getHeapSize(entry.name);
+        }
+    }
+    return size;
+}
+
+std::string EndstoneVirtualScoreboard::getObjectiveName(DisplaySlot slot)
+{
+    switch (slot) {
+    case DisplaySlot::BelowName:
+        return "endstone:belowname";
+    case DisplaySlot::PlayerList:
+        return "endstone:list";
+    case DisplaySlot::SideBar:
+        return "endstone:sidebar";
+    default:
+        throw std::runtime_error("Unknown DisplaySlot!");
+    }
+}
+
+EndstoneVirtualScoreboard::Key EndstoneVirtualScoreboard::getKey(const ScoreEntry &entry)
+{
+    return std::visit(overloaded{
+                          [](Player *player) { return Key{EntryType::Player, player->getId(), {}}; },
+                          [](Actor *actor) { return Key{EntryType::Actor, actor->getId(), {}}; },
+                          [](const std::string &name) { return Key{EntryType::FakePlayer, -1, name}; },
+                      },
+                      entry);
+}
+
+EndstoneVirtualScoreboard::Entry *EndstoneVirtualScoreboard::find(std::vector<Entry> &entries, const Key &key)
+{
+    for (auto &e : entries) {
+        if (e.type == key.type && e.actor_id == key.actor_id && e.name == key.name) {
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+EndstoneVirtualScoreboard::Display &EndstoneVirtualScoreboard::getDisplay(DisplaySlot slot)
+{
+    return displays_.at(static_cast<std::size_t>(slot));
+}
+
+const EndstoneVirtualScoreboard::Display &EndstoneVirtualScoreboard::getDisplay(DisplaySlot slot) const
+{
+    return displays_.at(static_cast<std::size_t>(slot));
+}
+
+void EndstoneVirtualScoreboard::setScore(Display &display, const Key &key, int score)
+{
+    if (auto *e = find(display.entries, key)) {
+        if (!e->removed && e->score == score) {
+            return;
+        }
+        e->score = score;
+        e->removed = false;
+    }
+    else {
+        display.entries.push_back({next_id_++, key.actor_id, std::string(key.name), key.type, score, 0, false, false});
+    }
+    dirty_ = true;
+}
+
+void EndstoneVirtualScoreboard::resetScore(std::vector<Entry> &entries, Entry &entry)
+{
+    if (!entry.sent) {
+        // the client never saw it
+        entries.erase(entries.begin() + (&entry - entries.data()));
+        return;
+    }
+    entry.removed = true;
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,121 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "endstone/scoreboard/virtual_scoreboard.h"
+
+namespace endstone::core {
+
+/**
+ * Stores what a single player should see in each display slot, and what the client was last sent.
+ *
+ * Nothing is sent when the state changes. Instead, takeUpdates() compares the two once per tick and returns the
+ * smallest set of changes: a slot is only displayed again when its name or sort order changed, and otherwise only
+ * the scores that were added, changed or removed since the last update are returned.
+ */
+class EndstoneVirtualScoreboard : public VirtualScoreboard {
+public:
+    enum class EntryType : std::uint8_t {
+        Player,
+        Actor,
+        FakePlayer,
+    };
+
+    struct Entry {
+        std::int64_t id;        // the scoreboard id the client knows this entry by
+        std::int64_t actor_id;  // for players and actors
+        std::string name;       // for fake players
+        EntryType type;
+        int score;
+        int sent_score;
+        bool sent;     // the client has this entry
+        bool removed;  // the entry is to be removed from the client
+    };
+
+    struct Update {
+        DisplaySlot slot;
+        bool remove;  // remove the objective the client shows in this slot
+        bool display;  // display the objective of this slot with the name and order below
+        std::string display_name;
+        ObjectiveSortOrder order;
+        std::vector<std::int64_t> removed;  // ids of the scores to remove
+        std::vector<const Entry *> changed;  // scores to add or change, valid until the next modification
+    };
+
+    void setDisplay(DisplaySlot slot, std::string display_name) override;
+    void setDisplay(DisplaySlot slot, std::string display_name, ObjectiveSortOrder order) override;
+    void clearDisplay(DisplaySlot slot) override;
+    [[nodiscard]] bool isDisplayed(DisplaySlot slot) const override;
+    [[nodiscard]] std::optional<int> getScore(DisplaySlot slot, ScoreEntry entry) const override;
+    void setScore(DisplaySlot slot, ScoreEntry entry, int score) override;
+    void resetScore(DisplaySlot slot, ScoreEntry entry) override;
+    void setLines(DisplaySlot slot, const std::vector<std::string> &lines) override;
+
+    /**
+     * Checks if anything changed since the last call to takeUpdates().
+     */
+    [[nodiscard]] bool isDirty() const;
+
+    /**
+     * Returns the changes needed to bring the client up to date, and considers them sent.
+     */
+    [[nodiscard]] std::vector<Update> takeUpdates();
+
+    /**
+     * Returns the number of bytes held by this scoreboard, including the names and entries it allocated.
+     */
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+    [[nodiscard]] static std::string getObjectiveName(DisplaySlot slot);
+
+private:
+    struct Key {
+        EntryType type;
+        std::int64_t actor_id;
+        std::string_view name;
+    };
+
+    struct Display {
+        std::string display_name;
+        ObjectiveSortOrder order{ObjectiveSortOrder::Descending};
+        bool displayed{false};  // the slot should be displayed
+        bool sent{false};       // the client displays the slot
+        bool changed{false};    // the name, order or visibility changed since it was sent
+        std::vector<Entry> entries;
+    };
+
+    static constexpr std::int64_t FirstId = std::int64_t{1} << 62;  // well clear of the ids used by scoreboards
+
+    [[nodiscard]] static Key getKey(const ScoreEntry &entry);
+    [[nodiscard]] static Entry *find(std::vector<Entry> &entries, const Key &key);
+    [[nodiscard]] Display &getDisplay(DisplaySlot slot);
+    [[nodiscard]] const Display &getDisplay(DisplaySlot slot) const;
+    void setScore(Display &display, const Key &key, int score);
+    static void resetScore(std::vector<Entry> &entries, Entry &entry);
+
+    std::array<Display, 3> displays_;
+    std::int64_t next_id_{FirstId};
+    bool dirty_{false};
+};
+
+}  // namespace endstone::core
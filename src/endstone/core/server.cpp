@@ -14,6 +14,7 @@
 
 #include "endstone/core/server.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 
@@ -38,6 +39,7 @@
 #include "endstone/core/event/handlers/player_gameplay_handler.h"
 #include "endstone/core/event/handlers/scripting_event_handler.h"
 #include "endstone/core/event/handlers/server_network_event_handler.h"
+#include "endstone/core/form/form_template.h"
 #include "endstone/core/level/level.h"
 #include "endstone/core/logger_factory.h"
 #include "endstone/core/message.h"
@@ -45,6 +47,7 @@
 #include "endstone/core/plugin/cpp_plugin_loader.h"
 #include "endstone/core/plugin/python_plugin_loader.h"
 #include "endstone/core/signal_handler.h"
+#include "endstone/core/startup_timer.h"
 #include "endstone/core/util/error.h"
 #include "endstone/event/server/broadcast_message_event.h"
 #include "endstone/event/server/server_load_event.h"
@@ -65,6 +68,12 @@ EndstoneServer::EndstoneServer() : logger_(LoggerFactory::getLogger("Server"))
     plugin_manager_ = std::make_unique<EndstonePluginManager>(*this);
     command_sender_ = EndstoneConsoleCommandSender::create();
     scheduler_ = std::make_unique<EndstoneScheduler>(*this);
+    view_distance_hint_ = std::make_unique<ViewDistanceHint>(*this);
+    login_queue_ = std::make_unique<LoginQueue>(*this);
+    chat_queue_ = std::make_unique<ChatQueue>(*this);
+    movement_tracker_ = std::make_unique<MovementTracker>(*this);
+    skin_cache_ = std::make_unique<SkinCache>();
+    item_type_cache_ = std::make_unique<ItemTypeCache>();
     start_time_ = std::chrono::system_clock::now();
 }
 
@@ -86,8 +95,9 @@ void EndstoneServer::init(ServerInstance &server_instance)
     command_sender_->init();
     player_ban_list_->load();
     ip_ban_list_->load();
-    loadPlugins();
-    enablePlugins(PluginLoadOrder::Startup);
+    auto &timer = StartupTimer::getInstance();
+    timer.measure("Plugin loading", [this] { loadPlugins(); });
+    timer.measure("Plugin enabling (startup)", [this] { enablePlugins(PluginLoadOrder::Startup); });
 }
 
 void EndstoneServer::setLevel(::Level &level)
@@ -99,11 +109,15 @@ void EndstoneServer::setLevel(::Level &level)
     scoreboard_ = std::make_unique<EndstoneScoreboard>(level.getScoreboard());
     command_map_ = std::make_unique<EndstoneCommandMap>(*this);
     loadResourcePacks();
+    language_->clearCache();  // translated before the language packs were loaded
+    item_type_cache_->clear();
     registerEventListeners();
     level._getPlayerDeathManager()->sender_.reset();  // prevent BDS from sending the death message
-    enablePlugins(PluginLoadOrder::PostWorld);
+    auto &timer = StartupTimer::getInstance();
+    timer.measure("Plugin enabling (post world)", [this] { enablePlugins(PluginLoadOrder::PostWorld); });
     ServerLoadEvent event{ServerLoadEvent::LoadType::Startup};
     getPluginManager().callEvent(event);
+    getLogger().info("Startup phases: {}", timer.toString());
 }
 
 void EndstoneServer::setResourcePackRepository(Bedrock::NotNullNonOwnerPtr<IResourcePackRepository> repo)
@@ -392,6 +406,8 @@ void EndstoneServer::reloadData()
 {
     server_instance_->getMinecraft()->requestResourceReload();
     level_->getHandle().loadFunctionManager();
+    language_->clearCache();
+    item_type_cache_->clear();
 }
 
 void EndstoneServer::broadcast(const Message &message, const std::string &permission) const
@@ -403,15 +419,42 @@ void EndstoneServer::broadcast(const Message &message, const std::string &permis
         }
     }
 
-    BroadcastMessageEvent event{!isPrimaryThread(), EndstoneMessage::toString(message), recipients};
+    const auto text = EndstoneMessage::toString(message);
+    BroadcastMessageEvent event{!isPrimaryThread(), text, recipients};
     getPluginManager().callEvent(event);
 
     if (event.isCancelled()) {
         return;
     }
 
-    for (const auto &recipient : recipients) {
-        recipient->sendMessage(event.getMessage());
+    if (event.getMessage() != text) {
+        sendMessage(recipients, event.getMessage());
+        return;
+    }
+    sendMessage(recipients, message);
+}
+
+void EndstoneServer::sendMessage(const std::unordered_set<const CommandSender *> &recipients,
+                                 const Message &message) const
+{
+    // a translatable is rendered once for each locale, and players of the same locale share the packet
+    const auto *translatable = std::get_if<Translatable>(&message);
+    std::vector<std::pair<std::string, std::shared_ptr<::Packet>>> packets;
+    for (const auto *recipient : recipients) {
+        const auto *player = static_cast<EndstonePlayer *>(recipient->asPlayer());
+        if (!player) {
+            recipient->sendMessage(message);
+            continue;
+        }
+
+        auto locale = translatable ? player->getLocale() : std::string{};
+        auto it = std::ranges::find(packets, locale, &decltype(packets)::value_type::first);
+        if (it == packets.end()) {
+            auto packet = EndstonePlayer::createTextPacket(translatable ? language_->translate(*translatable, locale)
+                                                                        : std::get<std::string>(message));
+            it = packets.emplace(packets.end(), std::move(locale), std::move(packet));
+        }
+        player->getHandle().sendNetworkPacket(*it->second);
     }
 }
 
@@ -478,6 +521,16 @@ std::chrono::system_clock::time_point EndstoneServer::getStartTime()
     return start_time_;
 }
 
+ViewDistanceHintSettings EndstoneServer::getViewDistanceHintSettings() const
+{
+    return view_distance_hint_->getSettings();
+}
+
+Result<void> EndstoneServer::setViewDistanceHintSettings(ViewDistanceHintSettings settings)
+{
+    return view_distance_hint_->setSettings(settings);
+}
+
 std::unique_ptr<BossBar> EndstoneServer::createBossBar(std::string title, BarColor color, BarStyle style) const
 {
     return std::make_unique<EndstoneBossBar>(std::move(title), color, style);
@@ -489,6 +542,11 @@ std::unique_ptr<BossBar> EndstoneServer::createBossBar(std::string title, BarCol
     return std::make_unique<EndstoneBossBar>(std::move(title), color, style, flags);
 }
 
+std::unique_ptr<FormTemplate> EndstoneServer::createFormTemplate(FormTemplate::FormVariant form) const
+{
+    return std::make_unique<EndstoneFormTemplate>(std::move(form));
+}
+
 Result<std::shared_ptr<BlockData>> EndstoneServer::createBlockData(std::string type) const
 {
     return createBlockData(type, {});
@@ -568,6 +626,9 @@ void EndstoneServer::tick(std::uint64_t current_tick, const std::function<void()
     const auto tick_time = steady_clock::now();
 
     scheduler_->mainThreadHeartbeat(current_tick);
+    if (level_) {
+        level_->tick(current_tick);
+    }
     tick_function();
 
     current_mspt_ = static_cast<float>(duration_cast<milliseconds>(steady_clock::now() - tick_time).count());
@@ -578,6 +639,39 @@ void EndstoneServer::tick(std::uint64_t current_tick, const std::function<void()
     average_mspt_[idx] = current_mspt_;
     average_tps_[idx] = current_tps_;
     average_usage_[idx] = current_usage_;
+
+    view_distance_hint_->tick(current_tick);
+    login_queue_->tick();
+    chat_queue_->tick();
+    movement_tracker_->tick();
+    flushBossBars();
+    flushScoreboards();
+}
+
+void EndstoneServer::flushBossBars()
+{
+    std::lock_guard lock{boss_bars_mtx_};
+    for (auto *boss_bar : boss_bars_) {
+        boss_bar->flush();
+    }
+}
+
+void EndstoneServer::flushScoreboards()
+{
+    if (scoreboard_) {
+        scoreboard_->flush();
+    }
+    std::erase_if(scoreboards_, [](const auto &weak) {
+        auto board = weak.lock();
+        if (!board) {
+            return true;
+        }
+        board->flush();
+        return false;
+    });
+    for (const auto &[id, player] : players_) {
+        player->flushVirtualScoreboard();
+    }
 }
 
 ServerInstance &EndstoneServer::getServer() const
@@ -585,4 +679,34 @@ ServerInstance &EndstoneServer::getServer() const
     return *server_instance_;
 }
 
+ViewDistanceHint &EndstoneServer::getViewDistanceHint() const
+{
+    return *view_distance_hint_;
+}
+
+LoginQueue &EndstoneServer::getLoginQueue() const
+{
+    return *login_queue_;
+}
+
+ChatQueue &EndstoneServer::getChatQueue() const
+{
+    return *chat_queue_;
+}
+
+SkinCache &EndstoneServer::getSkinCache() const
+{
+    return *skin_cache_;
+}
+
+ItemTypeCache &EndstoneServer::getItemTypeCache() const
+{
+    return *item_type_cache_;
+}
+
+int EndstoneServer::getMaxViewDistance() const
+{
+    return getServer().getMinecraft()->getServerNetworkHandler()->max_chunk_radius_;
+}
+
 }  // namespace endstone::core
@@ -16,24 +16,33 @@
 
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 
 #include "bedrock/resources/resource_pack_repository_interface.h"
 #include "bedrock/server/server_instance.h"
 #include "bedrock/shared_constants.h"
 #include "endstone/core/ban/ip_ban_list.h"
 #include "endstone/core/ban/player_ban_list.h"
+#include "endstone/core/boss/boss_bar.h"
+#include "endstone/core/chat_queue.h"
 #include "endstone/core/command/command_map.h"
 #include "endstone/core/command/console_command_sender.h"
 #include "endstone/core/crash_handler.h"
+#include "endstone/core/inventory/item_type_cache.h"
 #include "endstone/core/lang/language.h"
 #include "endstone/core/level/level.h"
+#include "endstone/core/login_queue.h"
+#include "endstone/core/movement_tracker.h"
 #include "endstone/core/packs/endstone_pack_source.h"
 #include "endstone/core/player.h"
 #include "endstone/core/plugin/plugin_manager.h"
 #include "endstone/core/scheduler/scheduler.h"
 #include "endstone/core/scoreboard/scoreboard.h"
 #include "endstone/core/signal_handler.h"
+#include "endstone/core/skin_cache.h"
+#include "endstone/core/view_distance_hint.h"
 #include "endstone/plugin/plugin_manager.h"
 #include "endstone/server.h"
 
@@ -82,6 +91,8 @@ public:
 
     void broadcast(const Message &message, const std::string &permission) const override;
     void broadcastMessage(const Message &message) const override;
+    // Sends the message to all recipients, rendering a translatable once for each locale among them
+    void sendMessage(const std::unordered_set<const CommandSender *> &recipients, const Message &message) const;
 
     [[nodiscard]] bool isPrimaryThread() const override;
 
@@ -94,10 +105,13 @@ public:
     float getCurrentTickUsage() override;
     float getAverageTickUsage() override;
     [[nodiscard]] std::chrono::system_clock::time_point getStartTime() override;
+    [[nodiscard]] ViewDistanceHintSettings getViewDistanceHintSettings() const override;
+    Result<void> setViewDistanceHintSettings(ViewDistanceHintSettings settings) override;
     [[nodiscard]] std::unique_ptr<BossBar> createBossBar(std::string title, BarColor color,
                                                          BarStyle style) const override;
     [[nodiscard]] std::unique_ptr<BossBar> createBossBar(std::string title, BarColor color, BarStyle style,
                                                          std::vector<BarFlag> flags) const override;
+    [[nodiscard]] std::unique_ptr<FormTemplate> createFormTemplate(FormTemplate::FormVariant form) const override;
     [[nodiscard]] Result<std::shared_ptr<BlockData>> createBlockData(std::string type) const override;
     [[nodiscard]] Result<std::shared_ptr<BlockData>> createBlockData(std::string type,
                                                                      BlockStates block_states) const override;
@@ -115,12 +129,21 @@ public:
     [[nodiscard]] PackSource &getPackSource() const;
 
     [[nodiscard]] ServerInstance &getServer() const;
+    [[nodiscard]] ViewDistanceHint &getViewDistanceHint() const;
+    [[nodiscard]] LoginQueue &getLoginQueue() const;
+    [[nodiscard]] ChatQueue &getChatQueue() const;
+    [[nodiscard]] SkinCache &getSkinCache() const;
+    [[nodiscard]] ItemTypeCache &getItemTypeCache() const;
+    [[nodiscard]] int getMaxViewDistance() const;
 
     static constexpr int MaxPlayers = 200;
 
 private:
+    friend class EndstoneBossBar;
     friend class EndstonePlayer;
     void enablePlugin(Plugin &plugin);
+    void flushBossBars();
+    void flushScoreboards();
     void loadResourcePacks();
     template <typename Wrapper, typename T>
     void wrap(std::unique_ptr<T> &target)
@@ -145,11 +168,19 @@ private:
     std::unique_ptr<EndstonePluginManager> plugin_manager_;
     std::shared_ptr<EndstoneConsoleCommandSender> command_sender_;
     std::unique_ptr<EndstoneScheduler> scheduler_;
+    std::unique_ptr<ViewDistanceHint> view_distance_hint_;
+    std::unique_ptr<LoginQueue> login_queue_;
+    std::unique_ptr<ChatQueue> chat_queue_;
+    std::unique_ptr<MovementTracker> movement_tracker_;
+    std::unique_ptr<SkinCache> skin_cache_;
+    std::unique_ptr<ItemTypeCache> item_type_cache_;
     std::unique_ptr<EndstoneCommandMap> command_map_;
     std::unique_ptr<EndstoneLevel> level_;
     std::unordered_map<UUID, EndstonePlayer *> players_;
     std::shared_ptr<EndstoneScoreboard> scoreboard_;
     std::vector<std::weak_ptr<EndstoneScoreboard>> scoreboards_;
+    std::vector<EndstoneBossBar *> boss_bars_;  // registered by the bars themselves
+    std::mutex boss_bars_mtx_;                  // bars may be created and destroyed on any thread
     std::unordered_map<const EndstonePlayer *, std::shared_ptr<EndstoneScoreboard>> player_boards_;
     std::chrono::system_clock::time_point start_time_;
     Bedrock::NonOwnerPointer<IResourcePackRepository> resource_pack_repository_;
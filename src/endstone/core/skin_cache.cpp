@@ -0,0 +1,122 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "endstone/core/skin_cache.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "endstone/core/base64.h"
+
+namespace endstone::core {
+
+namespace {
+std::size_t hash(std::string_view skin_id, const SkinCache::EncodedImage &skin, std::string_view cape_id,
+                 const SkinCache::EncodedImage &cape)
+{
+    constexpr std::hash<std::string_view> hasher;
+    auto seed = hasher(skin.data);
+    for (const auto value : {hasher(cape.data), hasher(skin_id), hasher(cape_id),
+                             static_cast<std::size_t>(skin.height) << 32 | static_cast<std::uint32_t>(skin.width),
+                             static_cast<std::size_t>(cape.height) << 32 | static_cast<std::uint32_t>(cape.width)}) {
+        seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+}  // namespace
+
+const Skin &SkinCache::Entry::getSkin() const
+{
+    std::call_once(decode_flag_, [this] {
+        auto skin_data = base64_decode(skin_data_.data).value_or("");
+        auto cape_data = base64_decode(cape_data_.data).value_or("");
+        skin_ = {skin_id_, Skin::ImageData{skin_data_.height, skin_data_.width, std::move(skin_data)}, cape_id_,
+                 Skin::ImageData{cape_data_.height, cape_data_.width, std::move(cape_data)}};
+        decoded_.store(true, std::memory_order_release);
+    });
+    return skin_;
+}
+
+bool SkinCache::Entry::isDecoded() const
+{
+    return decoded_.load(std::memory_order_acquire);
+}
+
+bool SkinCache::Entry::equals(std::string_view skin_id, const EncodedImage &skin, std::string_view cape_id,
+                              const EncodedImage &cape) const
+{
+    return skin_id_ == skin_id && cape_id_ == cape_id &&                                  //
+           skin_data_.height == skin.height && skin_data_.width == skin.width &&          //
+           cape_data_.height == cape.height && cape_data_.width == cape.width &&          //
+           skin_data_.data.size() == skin.data.size() && cape_data_.data == cape.data &&  //
+           skin_data_.data == skin.data;
+}
+
+std::shared_ptr<const SkinCache::Entry> SkinCache::get(std::string_view skin_id, const EncodedImage &skin,
+                                                      std::string_view cape_id, const EncodedImage &cape)
+{
+    const auto key = hash(skin_id, skin, cape_id, cape);
+    std::scoped_lock lock{mutex_};
+    auto [begin, end] = entries_.equal_range(key);
+    for (auto it = begin; it != end;) {
+        auto entry = it->second.lock();
+        if (!entry) {
+            it = entries_.erase(it);
+            continue;
+        }
+        if (entry->equals(skin_id, skin, cape_id, cape)) {
+            return entry;
+        }
+        ++it;
+    }
+
+    // not make_shared, so that the weak references left in the map do not keep the memory of the entry
+    auto entry = std::shared_ptr<Entry>(new Entry());
+    entry->skin_id_ = skin_id;
+    entry->skin_data_ = {skin.height, skin.width, std::string(skin.data)};
+    entry->cape_id_ = cape_id;
+    entry->cape_data_ = {cape.height, cape.width, std::string(cape.data)};
+    entries_.emplace(key, entry);
+    // entries of skins that nobody asks for again are only found here
+    if (entries_.size() >= prune_at_) {
+        std::erase_if(entries_, [](const auto &item) { return item.second.expired(); });
+        prune_at_ = std::max(MinPruneSize, entries_.size() * 2);
+    }
+    return entry;
+}
+
+SkinCache::Usage SkinCache::getUsage() const
+{
+    std::scoped_lock lock{mutex_};
+    Usage usage{};
+    for (const auto &[key, weak] : entries_) {
+        const auto entry = weak.lock();
+        if (!entry) {
+            continue;
+        }
+        ++usage.skins;
+        usage.players += entry.use_count() - 1;
+        usage.bytes += entry->skin_data_.data.size() + entry->cape_data_.data.size();
+        if (entry->isDecoded()) {
+            ++usage.decoded;
+            const auto &skin = entry->skin_;
+            usage.bytes += skin.getSkinData().data.size();
+            usage.bytes += skin.getCapeData() ? skin.getCapeData()->data.size() : 0;
+        }
+    }
+    return usage;
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,94 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "endstone/skin.h"
+
+namespace endstone::core {
+
+/**
+ * Holds the skins of the players, shared between all players with the same skin and cape.
+ *
+ * Skins are kept base64 encoded as they arrive in the connection request, and are only decoded the first time a plugin
+ * asks for them. A skin is dropped once the last player that uses it is gone.
+ */
+class SkinCache {
+public:
+    struct EncodedImage {
+        int height;
+        int width;
+        std::string_view data;  // base64 encoded
+    };
+
+    class Entry {
+    public:
+        /**
+         * Returns the decoded skin, decoding it on the first call. Safe to call from any thread.
+         */
+        [[nodiscard]] const Skin &getSkin() const;
+        [[nodiscard]] bool isDecoded() const;
+
+    private:
+        friend class SkinCache;
+        struct Image {
+            int height;
+            int width;
+            std::string data;
+        };
+
+        [[nodiscard]] bool equals(std::string_view skin_id, const EncodedImage &skin, std::string_view cape_id,
+                                  const EncodedImage &cape) const;
+
+        std::string skin_id_;
+        Image skin_data_;
+        std::string cape_id_;
+        Image cape_data_;
+        mutable std::once_flag decode_flag_;
+        mutable std::atomic<bool> decoded_{false};
+        mutable Skin skin_;
+    };
+
+    struct Usage {
+        std::size_t skins;    // distinct skins
+        std::size_t decoded;  // skins that were decoded
+        std::size_t players;  // players that share them
+        std::size_t bytes;    // held by the encoded and decoded images
+    };
+
+    /**
+     * Returns the entry for the skin, shared with all other players that sent the same one.
+     */
+    std::shared_ptr<const Entry> get(std::string_view skin_id, const EncodedImage &skin, std::string_view cape_id,
+                                     const EncodedImage &cape);
+    [[nodiscard]] Usage getUsage() const;
+
+private:
+    static constexpr std::size_t MinPruneSize = 64;
+
+    mutable std::mutex mutex_;
+    std::unordered_multimap<std::size_t, std::weak_ptr<Entry>> entries_;  // keyed by the hash of the content
+    std::size_t prune_at_{MinPruneSize};
+};
+
+}  // namespace endstone::core
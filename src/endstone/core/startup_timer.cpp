@@ -0,0 +1,65 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "endstone/core/startup_timer.h"
+
+#include <fmt/format.h>
+
+namespace endstone::core {
+
+void StartupTimer::record(std::string name, std::chrono::nanoseconds duration)
+{
+    phases_.push_back({std::move(name), duration});
+}
+
+void StartupTimer::clear()
+{
+    phases_.clear();
+}
+
+const std::vector<StartupTimer::Phase> &StartupTimer::getPhases() const
+{
+    return phases_;
+}
+
+std::chrono::nanoseconds StartupTimer::getTotal() const
+{
+    std::chrono::nanoseconds total{0};
+    for (const auto &phase : phases_) {
+        total += phase.duration;
+    }
+    return total;
+}
+
+std::string StartupTimer::toString() const
+{
+    std::string result;
+    for (const auto &phase : phases_) {
+        if (!result.empty()) {
+            result += ", ";
+        }
+        fmt::format_to(std::back_inserter(result), "{}: {:.1f} ms", phase.name,
+                       std::chrono::duration<double, std::milli>(phase.duration).count());
+    }
+    return result;
+}
+
+StartupTimer &StartupTimer::getInstance()
+{
+    static StartupTimer instance;
+    return instance;
+}
+
+}  // namespace endstone::core
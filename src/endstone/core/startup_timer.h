@@ -0,0 +1,73 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace endstone::core {
+
+/**
+ * Records how long each phase of the startup takes, from the initialisation of the runtime to the plugins being
+ * enabled, so that the time spent in each of them can be logged once the server has started.
+ *
+ * Phases are recorded from the main thread only.
+ */
+class StartupTimer {
+public:
+    struct Phase {
+        std::string name;
+        std::chrono::nanoseconds duration;
+    };
+
+    /**
+     * Calls func() and records how long it took as the given phase, even if it throws.
+     */
+    template <typename Func>
+    decltype(auto) measure(std::string name, Func &&func)
+    {
+        struct Guard {
+            StartupTimer &timer;
+            std::string name;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            ~Guard()
+            {
+                timer.record(std::move(name), std::chrono::steady_clock::now() - start);
+            }
+        } guard{*this, std::move(name)};
+        return std::invoke(std::forward<Func>(func));
+    }
+
+    void record(std::string name, std::chrono::nanoseconds duration);
+    void clear();
+    [[nodiscard]] const std::vector<Phase> &getPhases() const;
+    [[nodiscard]] std::chrono::nanoseconds getTotal() const;
+
+    /**
+     * Returns the phases and their durations in milliseconds, e.g. "Python init: 310.2 ms, Hook install: 3.1 ms".
+     */
+    [[nodiscard]] std::string toString() const;
+
+    static StartupTimer &getInstance();
+
+private:
+    std::vector<Phase> phases_;
+};
+
+}  // namespace endstone::core
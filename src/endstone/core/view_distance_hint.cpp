@@ -0,0 +1,135 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/view_distance_hint.h"
+
+#include <algorithm>
+
+#include "endstone/core/player.h"
+#include "endstone/core/server.h"
+#include "endstone/core/util/error.h"
+#include "endstone/event/player/player_view_distance_change_event.h"
+
+namespace endstone::core {
+
+ViewDistanceHint::ViewDistanceHint(EndstoneServer &server) : server_(server) {}
+
+const ViewDistanceHintSettings &ViewDistanceHint::getSettings() const
+{
+    return settings_;
+}
+
+Result<void> ViewDistanceHint::setSettings(const ViewDistanceHintSettings &settings)
+{
+    if (settings.low_mspt >= settings.high_mspt) {
+        return nonstd::make_unexpected(make_error("Low MSPT ({}) must be lower than high MSPT ({}).",
+                                                  settings.low_mspt, settings.high_mspt));
+    }
+    if (settings.min_view_distance < 2) {
+        return nonstd::make_unexpected(
+            make_error("Minimum view distance ({}) must be at least 2.", settings.min_view_distance));
+    }
+    if (settings.max_view_distance != 0 && settings.max_view_distance < settings.min_view_distance) {
+        return nonstd::make_unexpected(
+            make_error("Maximum view distance ({}) must be 0 or at least the minimum view distance ({}).",
+                       settings.max_view_distance, settings.min_view_distance));
+    }
+    if (settings.step < 1) {
+        return nonstd::make_unexpected(make_error("Step ({}) must be at least 1.", settings.step));
+    }
+    if (settings.cooldown < 1) {
+        return nonstd::make_unexpected(make_error("Cooldown ({}) must be at least 1.", settings.cooldown));
+    }
+    settings_ = settings;
+    return {};
+}
+
+int ViewDistanceHint::getViewDistance() const
+{
+    return view_distance_;
+}
+
+void ViewDistanceHint::tick(std::uint64_t current_tick)
+{
+    if (!settings_.enabled) {
+        if (view_distance_ != 0) {
+            server_.getLogger().info("View distance hint disabled, restoring view distance.");
+            setViewDistance(0, current_tick);
+        }
+        return;
+    }
+
+    if (current_tick < last_change_tick_ + settings_.cooldown) {
+        return;
+    }
+
+    const auto max_view_distance = getMaxViewDistance();
+    const auto current = view_distance_ > 0 ? view_distance_ : max_view_distance;
+    const auto mspt = server_.getAverageMillisecondsPerTick();
+    if (mspt > settings_.high_mspt && current > settings_.min_view_distance) {
+        const auto target = std::max(settings_.min_view_distance, current - settings_.step);
+        server_.getLogger().info("Average MSPT {:.2f}ms is above {:.2f}ms, reducing view distance from {} to {}.",
+                                 mspt, settings_.high_mspt, current, target);
+        setViewDistance(target, current_tick);
+    }
+    else if (mspt < settings_.low_mspt && view_distance_ > 0 && current < max_view_distance) {
+        const auto target = current + settings_.step;
+        server_.getLogger().info("Average MSPT {:.2f}ms is below {:.2f}ms, restoring view distance from {} to {}.",
+                                 mspt, settings_.low_mspt, current, std::min(target, max_view_distance));
+        if (target < max_view_distance) {
+            setViewDistance(target, current_tick);
+        }
+        else {
+            // Lift the limit entirely once restored, unless the settings cap it below the server view distance
+            setViewDistance(max_view_distance < server_.getMaxViewDistance() ? max_view_distance : 0, current_tick);
+        }
+    }
+}
+
+void ViewDistanceHint::apply(EndstonePlayer &player) const
+{
+    if (player.getViewDistanceHint() == view_distance_) {
+        return;
+    }
+    if (view_distance_ > 0 && player.hasPermission("endstone.viewdistance.exempt")) {
+        return;
+    }
+
+    const auto new_view_distance = view_distance_ > 0 ? view_distance_ : getMaxViewDistance();
+    PlayerViewDistanceChangeEvent e{player, player.getViewDistance(), new_view_distance};
+    server_.getPluginManager().callEvent(e);
+    if (e.isCancelled()) {
+        return;
+    }
+    player.setViewDistanceHint(view_distance_);
+}
+
+int ViewDistanceHint::getMaxViewDistance() const
+{
+    if (settings_.max_view_distance > 0) {
+        return std::min(settings_.max_view_distance, server_.getMaxViewDistance());
+    }
+    return server_.getMaxViewDistance();
+}
+
+void ViewDistanceHint::setViewDistance(int view_distance, std::uint64_t current_tick)
+{
+    view_distance_ = view_distance;
+    last_change_tick_ = current_tick;
+    for (auto *player : server_.getOnlinePlayers()) {
+        apply(static_cast<EndstonePlayer &>(*player));
+    }
+}
+
+}  // namespace endstone::core
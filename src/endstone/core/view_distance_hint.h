@@ -0,0 +1,57 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "endstone/util/result.h"
+#include "endstone/view_distance_hint.h"
+
+namespace endstone::core {
+
+class EndstonePlayer;
+class EndstoneServer;
+
+/**
+ * Asks clients to use a smaller view distance while the average MSPT stays above the high watermark, and restores it
+ * step by step once the average MSPT drops below the low watermark. The reduced view distance is only sent to the
+ * clients with ChunkRadiusUpdatedPacket, the radius published and simulated by the server is left unchanged.
+ */
+class ViewDistanceHint {
+public:
+    explicit ViewDistanceHint(EndstoneServer &server);
+
+    [[nodiscard]] const ViewDistanceHintSettings &getSettings() const;
+    Result<void> setSettings(const ViewDistanceHintSettings &settings);
+
+    /**
+     * Gets the view distance currently hinted to players, or 0 if no reduction is hinted.
+     */
+    [[nodiscard]] int getViewDistance() const;
+
+    void tick(std::uint64_t current_tick);
+    void apply(EndstonePlayer &player) const;
+
+private:
+    [[nodiscard]] int getMaxViewDistance() const;
+    void setViewDistance(int view_distance, std::uint64_t current_tick);
+
+    EndstoneServer &server_;
+    ViewDistanceHintSettings settings_;
+    int view_distance_{0};
+    std::uint64_t last_change_tick_{0};
+};
+
+}  // namespace endstone::core
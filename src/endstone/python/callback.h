@@ -0,0 +1,41 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <utility>
+
+#include <pybind11/pybind11.h>
+
+namespace endstone::python {
+
+/**
+ * @brief Wraps a Python callable into a callback that receives its argument by reference.
+ *
+ * The std::function caster of pybind11 passes lvalue references to Python with the copy policy, which fails for
+ * abstract types such as Chunk or Inventory and would hide any change made by the callable. The argument is instead
+ * wrapped as a reference, so it is only valid for the duration of the call.
+ *
+ * The callback must be invoked while the GIL is held, e.g. synchronously from the bound function that received it.
+ */
+template <typename T>
+std::function<void(T &)> by_reference(pybind11::function func)
+{
+    return [func = std::move(func)](T &arg) {
+        func(pybind11::cast(&arg, pybind11::return_value_policy::reference));
+    };
+}
+
+}  // namespace endstone::python
@@ -47,7 +47,7 @@ void init_player(py::module_ &, py::class_<OfflinePlayer> &offline_player,
 void init_plugin(py::module_ &);
 void init_scheduler(py::module_ &);
 void init_scoreboard(py::module_ &);
-void init_server(py::class_<Server> &server);
+void init_server(py::module_ &, py::class_<Server> &server);
 void init_util(py::module_ &);
 
 PYBIND11_MODULE(endstone_python, m)  // NOLINT(*-use-anonymous-namespace)
@@ -100,7 +100,7 @@ PYBIND11_MODULE(endstone_python, m)  // NOLINT(*-use-anonymous-namespace)
     init_plugin(m);
     init_scheduler(m);
     init_permissions(m, permissible, permission, permission_default);
-    init_server(server);
+    init_server(m, server);
     init_event(m, event, event_priority);
 }
 
@@ -192,8 +192,28 @@ void init_logger(py::module &m)
         .def_property_readonly("name", &Logger::getName, "Get the name of this Logger instance.");
 }
 
-void init_server(py::class_<Server> &server)
+void init_server(py::module_ &m, py::class_<Server> &server)
 {
+    py::class_<ViewDistanceHintSettings>(
+        m, "ViewDistanceHintSettings",
+        "Represents the settings of the view distance hint, which asks clients to use a smaller view distance while "
+        "the server is under heavy load and restores it once the load recovers. The server keeps publishing chunks "
+        "within the radius each client requests.")
+        .def(py::init<>())
+        .def_readwrite("enabled", &ViewDistanceHintSettings::enabled, "Whether the view distance hint is enabled.")
+        .def_readwrite("high_mspt", &ViewDistanceHintSettings::high_mspt,
+                       "The average MSPT above which the view distance is reduced.")
+        .def_readwrite("low_mspt", &ViewDistanceHintSettings::low_mspt,
+                       "The average MSPT below which the view distance is restored.")
+        .def_readwrite("min_view_distance", &ViewDistanceHintSettings::min_view_distance,
+                       "The view distance in chunks the hint never goes below.")
+        .def_readwrite("max_view_distance", &ViewDistanceHintSettings::max_view_distance,
+                       "The view distance in chunks the hint never goes above, or 0 to use the server's.")
+        .def_readwrite("step", &ViewDistanceHintSettings::step,
+                       "The number of chunks the view distance is changed by in a single adjustment.")
+        .def_readwrite("cooldown", &ViewDistanceHintSettings::cooldown,
+                       "The minimum number of ticks between two adjustments.");
+
     server.def_property_readonly("name", &Server::getVersion, "Gets the name of this server implementation.")
         .def_property_readonly("version", &Server::getVersion, "Gets the version of this server implementation.")
         .def_property_readonly("minecraft_version", &Server::getMinecraftVersion,
@@ -251,6 +271,8 @@ void init_server(py::class_<Server> &server)
         .def_property_readonly("average_tick_usage", &Server::getAverageTickUsage,
                                "Gets the average tick usage of the server.")
         .def_property_readonly("start_time", &Server::getStartTime, "Gets the start time of the server.")
+        .def_property("view_distance_hint_settings", &Server::getViewDistanceHintSettings,
+                      &Server::setViewDistanceHintSettings, "Gets or sets the settings of the view distance hint.")
         .def(
             "create_boss_bar",
             [](const Server &self, std::string title, BarColor color, BarStyle style,
@@ -259,6 +281,8 @@ void init_server(py::class_<Server> &server)
             },
             py::arg("title"), py::arg("color"), py::arg("style"), py::arg("flags") = std::nullopt,
             "Creates a boss bar instance to display to players. The progress defaults to 1.0.")
+        .def("create_form_template", &Server::createFormTemplate, py::arg("form"),
+             "Creates a form template, serializing the form once so that it can be sent to many players.")
         .def(
             "create_block_data",
             [](const Server &self, std::string type, const std::optional<BlockStates> &block_states) {
@@ -368,6 +392,9 @@ void init_player(py::module_ &m, py::class_<OfflinePlayer> &offline_player,
                       "Gets or sets the current allowed speed that a client can walk.")
         .def_property("scoreboard", &Player::getScoreboard, &Player::setScoreboard,
                       "Gets or sets the player's visible Scoreboard.", py::return_value_policy::reference)
+        .def_property_readonly("virtual_scoreboard", &Player::getVirtualScoreboard,
+                               py::return_value_policy::reference,
+                               "Gets the VirtualScoreboard of this player, whose displays are only shown to this player.")
         .def("send_title", py::overload_cast<std::string, std::string, int, int, int>(&Player::sendTitle, py::const_),
              "Sends a title and a subtitle message to the player. If they are empty strings, the display will be "
              "updated as such.",
@@ -394,12 +421,26 @@ void init_player(py::module_ &m, py::class_<OfflinePlayer> &offline_player,
         .def_property_readonly("inventory", &Player::getInventory, py::return_value_policy::reference,
                                "Get the player's inventory.")
         .def_property_readonly("locale", &Player::getLocale, "Get the player's current locale.")
+        .def_property_readonly("view_distance", &Player::getViewDistance,
+                               "Gets the view distance last sent to the player, including any reduction hinted under "
+                               "heavy load.")
         .def_property_readonly("device_os", &Player::getDeviceOS,
                                "Get the player's current device's operation system (OS).")
         .def_property_readonly("device_id", &Player::getDeviceId, "Get the player's current device id.")
         .def_property_readonly("game_version", &Player::getGameVersion, "Get the player's current game version.")
         .def_property_readonly("skin", &Player::getSkin, "Get the player's skin.")
-        .def("send_form", &Player::sendForm, "Sends a form to the player.", py::arg("form"))
+        .def(
+            "send_form",
+            [](Player &self, std::variant<MessageForm, ActionForm, ModalForm> form) { self.sendForm(std::move(form)); },
+            "Sends a form to the player.", py::arg("form"))
+        .def(
+            "send_form",
+            [](Player &self, const FormTemplate &form,
+               const std::optional<std::unordered_map<std::string, std::string>> &values) {
+                self.sendForm(form, values.value_or(std::unordered_map<std::string, std::string>{}));
+            },
+            "Sends a form template to the player, filling in its placeholders.", py::arg("form"),
+            py::arg("values") = std::nullopt)
         .def("close_form", &Player::closeForm, "Closes the forms that are currently open for the player.")
         .def("send_packet", &Player::sendPacket, py::arg("packet"), "Sends a packet to the player.");
 }
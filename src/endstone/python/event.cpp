@@ -124,6 +124,29 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
         .def_property_readonly("block_against", &BlockPlaceEvent::getBlockAgainst, py::return_value_policy::reference,
                                "Gets the block that this block was placed against");
 
+    py::class_<AsyncPlayerChatEvent, Event, ICancellable>(
+        m, "AsyncPlayerChatEvent", "Called on a worker thread when a player sends a chat message.")
+        .def_property_readonly("player_name", &AsyncPlayerChatEvent::getPlayerName,
+                               "Gets the name of the player who sent the message.")
+        .def_property_readonly("player_unique_id", &AsyncPlayerChatEvent::getPlayerUniqueId,
+                               "Gets the unique ID of the player who sent the message.")
+        .def_property("message", &AsyncPlayerChatEvent::getMessage, &AsyncPlayerChatEvent::setMessage,
+                      "Gets or sets the message that the player will send.")
+        .def_property("recipients", &AsyncPlayerChatEvent::getRecipients, &AsyncPlayerChatEvent::setRecipients,
+                      "Gets or sets the unique IDs of the players who will receive the message.");
+
+    py::class_<AsyncPlayerPreLoginEvent, Event, ICancellable>(
+        m, "AsyncPlayerPreLoginEvent",
+        "Called on a worker thread when a player attempts to log in, before PlayerLoginEvent.")
+        .def_property_readonly("name", &AsyncPlayerPreLoginEvent::getName, "Gets the player's name.")
+        .def_property_readonly("unique_id", &AsyncPlayerPreLoginEvent::getUniqueId, "Gets the player's unique ID.")
+        .def_property_readonly("xuid", &AsyncPlayerPreLoginEvent::getXuid, "Gets the player's XUID.")
+        .def_property_readonly("address", &AsyncPlayerPreLoginEvent::getAddress,
+                               "Gets the socket address of the player.")
+        .def_property("kick_message", &AsyncPlayerPreLoginEvent::getKickMessage,
+                      &AsyncPlayerPreLoginEvent::setKickMessage,
+                      "Gets or sets kick message to display if event is cancelled");
+
     py::class_<PlayerEvent, Event>(m, "PlayerEvent", "Represents a player related event")
         .def_property_readonly("player", &PlayerEvent::getPlayer, py::return_value_policy::reference,
                                "Returns the player involved in this event.");
@@ -171,6 +194,25 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
                                                             "Called when a player attempts to login in.")
         .def_property("kick_message", &PlayerLoginEvent::getKickMessage, &PlayerLoginEvent::setKickMessage,
                       "Gets or sets kick message to display if event is cancelled");
+    py::class_<PlayerMoveThreshold>(m, "PlayerMoveThreshold",
+                                    "Declares how far a player must move before a handler of PlayerMoveEvent is "
+                                    "called. When no criterion is enabled, any change in position or rotation counts.")
+        .def(py::init([](double distance, float rotation, bool block, bool chunk) {
+                 return PlayerMoveThreshold{distance, rotation, block, chunk};
+             }),
+             py::arg("distance") = 0.0, py::arg("rotation") = 0.0F, py::arg("block") = false,
+             py::arg("chunk") = false)
+        .def_readwrite("distance", &PlayerMoveThreshold::distance,
+                       "The minimum distance moved, in blocks, or 0 to disable.")
+        .def_readwrite("rotation", &PlayerMoveThreshold::rotation,
+                       "The minimum change in pitch or yaw, in degrees, or 0 to disable.")
+        .def_readwrite("block", &PlayerMoveThreshold::block, "Whether entering another block counts.")
+        .def_readwrite("chunk", &PlayerMoveThreshold::chunk, "Whether entering another chunk counts.");
+    py::class_<PlayerMoveEvent, PlayerEvent, ICancellable>(
+        m, "PlayerMoveEvent", "Called when a player moves past the threshold declared by a handler.")
+        .def_property_readonly("from_location", &PlayerMoveEvent::getFrom,
+                               "Gets the location that this player moved from.")
+        .def_property_readonly("to_location", &PlayerMoveEvent::getTo, "Gets the location that this player moved to.");
     py::class_<PlayerQuitEvent, PlayerEvent>(m, "PlayerQuitEvent", "Called when a player leaves a server.")
         .def_property("quit_message", &PlayerQuitEvent::getQuitMessage, &PlayerQuitEvent::setQuitMessage,
                       "Gets or sets the quit message to send to all online players.");
@@ -181,6 +223,12 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
                       "Gets or sets the location that this player moved from.")
         .def_property("to_location", &PlayerTeleportEvent::getTo, &PlayerTeleportEvent::setTo,
                       "Gets or sets the location that this player moved to.");
+    py::class_<PlayerViewDistanceChangeEvent, PlayerEvent, ICancellable>(
+        m, "PlayerViewDistanceChangeEvent", "Called when the view distance hint sent to a player is about to change.")
+        .def_property_readonly("old_view_distance", &PlayerViewDistanceChangeEvent::getOldViewDistance,
+                               "Gets the view distance of the player before the change.")
+        .def_property_readonly("new_view_distance", &PlayerViewDistanceChangeEvent::getNewViewDistance,
+                               "Gets the view distance the player is changed to.");
 
     py::class_<ServerEvent, Event>(m, "ServerEvent", "Represents a server-related event");
     py::class_<BroadcastMessageEvent, ServerEvent, ICancellable>(
@@ -0,0 +1,88 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <memory>
+#include <typeinfo>
+#include <utility>
+
+#include <pybind11/pybind11.h>
+
+#include "endstone/event/event.h"
+
+namespace endstone::python {
+
+/**
+ * @brief Calls a Python event handler with an event delivered from C++.
+ *
+ * Every event delivered to a handler has the same type, so the Python wrapper type of the event is resolved on the
+ * first call and reused afterwards instead of being looked up through the polymorphic type hook each time. The handler
+ * is then invoked through vectorcall, skipping the argument tuple built by pybind11::object::operator().
+ *
+ * The GIL is acquired for each call, which is almost free when the caller already holds it, as
+ * EndstonePluginManager::callEvent does across consecutive Python handlers.
+ */
+class PyEventExecutor {
+public:
+    explicit PyEventExecutor(pybind11::object handler)
+        : state_(new State{std::move(handler)}, [](const State *state) {
+              // the handler may be unregistered from any thread, the GIL is required to release the reference
+              pybind11::gil_scoped_acquire gil{};
+              delete state;
+          })
+    {
+    }
+
+    void operator()(Event &event) const
+    {
+        pybind11::gil_scoped_acquire gil{};
+        auto arg = cast(event);
+        PyObject *args[] = {nullptr, arg.ptr()};
+        auto result = pybind11::reinterpret_steal<pybind11::object>(
+            PyObject_Vectorcall(state_->handler.ptr(), args + 1, 1 | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr));
+        if (!result) {
+            throw pybind11::error_already_set();
+        }
+    }
+
+private:
+    struct State {
+        pybind11::object handler;
+        const std::type_info *cpp_type = nullptr;
+        const pybind11::detail::type_info *py_type = nullptr;
+    };
+
+    [[nodiscard]] pybind11::object cast(Event &event) const
+    {
+        const auto &cpp_type = typeid(event);
+        if (state_->cpp_type != &cpp_type) {
+            state_->cpp_type = &cpp_type;
+            state_->py_type = pybind11::detail::get_type_info(cpp_type);
+        }
+        if (!state_->py_type) {
+            // not bound as its own class, let pybind11 fall back to the closest registered base
+            return pybind11::cast(&event, pybind11::return_value_policy::reference);
+        }
+        // the cached type describes the most derived class, so the pointer must point to the most derived object
+        return pybind11::reinterpret_steal<pybind11::object>(pybind11::detail::type_caster_generic::cast(
+            dynamic_cast<const void *>(&event), pybind11::return_value_policy::reference, pybind11::handle(),
+            state_->py_type, nullptr, nullptr));
+    }
+
+    std::shared_ptr<State> state_;
+};
+
+}  // namespace endstone::python
@@ -174,6 +174,11 @@ void init_form(py::module_ &m)
                       py::return_value_policy::reference)
         .def_property("submit_button", &ModalForm::getSubmitButton, &ModalForm::setSubmitButton,
                       "Gets or sets the submit button message of the form.", py::return_value_policy::reference);
+
+    py::class_<FormTemplate>(m, "FormTemplate",
+                             "Represents a form that is serialized once and then sent to any number of players.")
+        .def_property_readonly("placeholders", &FormTemplate::getPlaceholders,
+                               "Gets the names of the placeholders in the form, in the order they first appear.");
 }
 
 }  // namespace endstone::python
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "callback.h"
 #include "endstone_python.h"
 
 namespace py = pybind11;
@@ -49,6 +50,14 @@ void init_inventory(py::module_ &m)
                                " Check whether this inventory is empty. An inventory is considered to be empty if "
                                "there are no ItemStacks in any slot of this inventory.")
         .def("clear", &Inventory::clear, "Clears out the whole Inventory.")
+        .def(
+            "batch_update",
+            [](Inventory &self, py::function callback) {
+                self.batchUpdate(by_reference<Inventory>(std::move(callback)));
+            },
+            py::arg("callback"),
+             "Runs several changes to the inventory as one update. For player inventories, the changes are sent to "
+             "the player once, after the callback returns.")
         .def("__len__", &Inventory::getSize, "Returns the size of the inventory")
         .def("__get_item__", &Inventory::getItem, py::arg("index"),
              "Returns the ItemStack found in the slot at the given index")
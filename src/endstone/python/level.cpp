@@ -12,12 +12,47 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
+#include <pybind11/numpy.h>
+
+#include "callback.h"
 #include "endstone_python.h"
 
 namespace py = pybind11;
 
 namespace endstone::python {
 
+namespace {
+// Creates a read-only numpy view over the given vector without copying. The owner is kept alive by the returned array
+// and must not change the vector afterwards.
+template <typename T>
+py::array_t<T> as_array(const std::vector<T> &data, py::ssize_t rows, py::ssize_t cols, const py::object &owner)
+{
+    py::array_t<T> array;
+    if (cols == 1) {
+        array = py::array_t<T>({rows}, {static_cast<py::ssize_t>(sizeof(T))}, data.data(), owner);
+    }
+    else {
+        array = py::array_t<T>({rows, cols},
+                               {static_cast<py::ssize_t>(sizeof(T) * cols), static_cast<py::ssize_t>(sizeof(T))},
+                               data.data(), owner);
+    }
+    array.attr("flags").attr("writeable") = false;
+    return array;
+}
+
+// Creates a read-only numpy array holding a copy of the given vector, for storage that may be refilled later.
+template <typename T>
+py::array_t<T> copy_array(const std::vector<T> &data, py::ssize_t rows, py::ssize_t cols)
+{
+    py::array_t<T> array = cols == 1 ? py::array_t<T>({rows}) : py::array_t<T>({rows, cols});
+    std::copy_n(data.data(), static_cast<std::size_t>(rows * cols), array.mutable_data());
+    array.attr("flags").attr("writeable") = false;
+    return array;
+}
+}  // namespace
+
 void init_level(py::module_ &m)
 {
     auto level = py::class_<Level>(m, "Level");
@@ -59,13 +94,124 @@ void init_level(py::module_ &m)
         .def("__repr__", location_to_string)
         .def("__str__", location_to_string);
 
+    py::class_<ChunkSnapshot, std::shared_ptr<ChunkSnapshot>>(
+        m, "ChunkSnapshot",
+        "Represents an immutable copy of the blocks in a chunk, which can be read from any thread. Coordinates are "
+        "relative to the chunk.")
+        .def_property_readonly("x", &ChunkSnapshot::getX,
+                               "Gets the X-coordinate of the chunk this snapshot was taken from")
+        .def_property_readonly("z", &ChunkSnapshot::getZ,
+                               "Gets the Z-coordinate of the chunk this snapshot was taken from")
+        .def_property_readonly("min_height", &ChunkSnapshot::getMinHeight,
+                               "Gets the minimum height (inclusive) covered by this snapshot")
+        .def_property_readonly("max_height", &ChunkSnapshot::getMaxHeight,
+                               "Gets the maximum height (exclusive) covered by this snapshot")
+        .def_property_readonly("palette", &ChunkSnapshot::getPalette, "Gets the distinct block data found in the chunk")
+        .def_property_readonly(
+            "blocks",
+            [](const py::object &self) {
+                const auto &s = self.cast<const ChunkSnapshot &>();
+                constexpr auto width = static_cast<py::ssize_t>(ChunkSnapshot::Width);
+                constexpr auto size = static_cast<py::ssize_t>(sizeof(std::uint16_t));
+                auto blocks = py::array_t<std::uint16_t>({s.getMaxHeight() - s.getMinHeight(), width, width},
+                                                         {width * width * size, width * size, size},
+                                                         s.getBlocks().data(), self);
+                blocks.attr("flags").attr("writeable") = false;
+                return blocks;
+            },
+            "Gets the palette indices of all blocks, with shape (height, 16, 16) indexed by [y - min_height, z, x].")
+        .def_property_readonly(
+            "heightmap",
+            [](const py::object &self) {
+                const auto &s = self.cast<const ChunkSnapshot &>();
+                return as_array(s.getHeightmap(), ChunkSnapshot::Width, ChunkSnapshot::Width, self);
+            },
+            "Gets the highest non-air block of each column, with shape (16, 16) indexed by [z, x].")
+        .def(
+            "get_block_data",
+            [](const ChunkSnapshot &self, int x, int y, int z) {
+                if (!self.contains(x, y, z)) {
+                    throw py::index_error(
+                        fmt::format("Coordinates ({}, {}, {}) are outside of the chunk snapshot.", x, y, z));
+                }
+                return self.getBlockData(x, y, z);
+            },
+            py::arg("x"), py::arg("y"), py::arg("z"), "Gets the block data of the block at the given coordinates")
+        .def(
+            "get_highest_block_y_at",
+            [](const ChunkSnapshot &self, int x, int z) {
+                if (!self.contains(x, self.getMinHeight(), z)) {
+                    throw py::index_error(fmt::format("Coordinates ({}, {}) are outside of the chunk snapshot.", x, z));
+                }
+                return self.getHighestBlockYAt(x, z);
+            },
+            py::arg("x"), py::arg("z"), "Gets the y-coordinate of the highest non-air block at the given coordinates");
+
     py::class_<Chunk>(m, "Chunk", "Represents a chunk of blocks.")
         .def_property_readonly("x", &Chunk::getX, "Gets the X-coordinate of this chunk")
         .def_property_readonly("z", &Chunk::getZ, "Gets the Z-coordinate of this chunk")
         .def_property_readonly("level", &Chunk::getLevel, "Gets the level containing this chunk",
                                py::return_value_policy::reference)
         .def_property_readonly("dimension", &Chunk::getDimension, "Gets the dimension containing this chunk",
-                               py::return_value_policy::reference);
+                               py::return_value_policy::reference)
+        .def("get_snapshot", &Chunk::getSnapshot,
+             "Captures an immutable snapshot of the blocks in this chunk. Must be called from the server thread.");
+
+    auto actor_snapshot = py::class_<ActorSnapshot>(
+        m, "ActorSnapshot",
+        "Represents a structure-of-arrays snapshot of the actors in a level. Arrays are read-only copies that keep "
+        "their values when the snapshot is filled again.");
+    actor_snapshot.attr("RUNTIME_IDS") = ActorSnapshot::RuntimeIds;
+    actor_snapshot.attr("POSITIONS") = ActorSnapshot::Positions;
+    actor_snapshot.attr("VELOCITIES") = ActorSnapshot::Velocities;
+    actor_snapshot.attr("ROTATIONS") = ActorSnapshot::Rotations;
+    actor_snapshot.attr("DIMENSION_IDS") = ActorSnapshot::DimensionIds;
+    actor_snapshot.attr("FLAGS") = ActorSnapshot::Flags;
+    actor_snapshot.attr("ALL_FIELDS") = ActorSnapshot::AllFields;
+    actor_snapshot.attr("ON_GROUND") = ActorSnapshot::OnGround;
+    actor_snapshot.attr("IN_WATER") = ActorSnapshot::InWater;
+    actor_snapshot.attr("IN_LAVA") = ActorSnapshot::InLava;
+    actor_snapshot.attr("DEAD") = ActorSnapshot::Dead;
+    actor_snapshot.attr("IS_PLAYER") = ActorSnapshot::IsPlayer;
+    actor_snapshot.def(py::init<>())
+        .def("__len__", &ActorSnapshot::size)
+        .def_property_readonly("fields", &ActorSnapshot::getFields, "Gets the fields captured by this snapshot.")
+        .def_property_readonly(
+            "runtime_ids",
+            [](const ActorSnapshot &s) {
+                return copy_array(s.getRuntimeIds(), static_cast<py::ssize_t>(s.getRuntimeIds().size()), 1);
+            },
+            "Gets a copy of the runtime ids of the actors, with shape (n,).")
+        .def_property_readonly(
+            "positions",
+            [](const ActorSnapshot &s) {
+                return copy_array(s.getPositions(), static_cast<py::ssize_t>(s.getPositions().size() / 3), 3);
+            },
+            "Gets a copy of the feet positions of the actors, with shape (n, 3).")
+        .def_property_readonly(
+            "velocities",
+            [](const ActorSnapshot &s) {
+                return copy_array(s.getVelocities(), static_cast<py::ssize_t>(s.getVelocities().size() / 3), 3);
+            },
+            "Gets a copy of the velocities of the actors, with shape (n, 3).")
+        .def_property_readonly(
+            "rotations",
+            [](const ActorSnapshot &s) {
+                return copy_array(s.getRotations(), static_cast<py::ssize_t>(s.getRotations().size() / 2), 2);
+            },
+            "Gets a copy of the rotations (pitch, yaw) of the actors in degrees, with shape (n, 2).")
+        .def_property_readonly(
+            "dimension_ids",
+            [](const ActorSnapshot &s) {
+                return copy_array(s.getDimensionIds(), static_cast<py::ssize_t>(s.getDimensionIds().size()), 1);
+            },
+            "Gets a copy of the runtime ids of the dimensions the actors reside in, with shape (n,).")
+        .def_property_readonly(
+            "flags",
+            [](const ActorSnapshot &s) {
+                return copy_array(s.getFlags(), static_cast<py::ssize_t>(s.getFlags().size()), 1);
+            },
+            "Gets a copy of the state flags of the actors, with shape (n,).");
 
     py::enum_<Dimension::Type>(dimension, "Type", "Represents various dimension types.")
         .value("OVERWORLD", Dimension::Type::Overworld)
@@ -82,11 +228,43 @@ void init_level(py::module_ &m)
              py::arg("location").noconvert(), "Gets the Block at the given Location")
         .def("get_block_at", py::overload_cast<int, int, int>(&Dimension::getBlockAt, py::const_), py::arg("x"),
              py::arg("y"), py::arg("z"), "Gets the Block at the given coordinates")
-        .def_property_readonly("loaded_chunks", &Dimension::getLoadedChunks, "Gets a list of all loaded Chunks");
+        .def_property_readonly("loaded_chunks", &Dimension::getLoadedChunks, "Gets a list of all loaded Chunks")
+        .def(
+            "for_each_loaded_chunk",
+            [](Dimension &self, py::function visitor) {
+                self.forEachLoadedChunk(by_reference<Chunk>(std::move(visitor)));
+            },
+            py::arg("visitor"),
+            "Visits all loaded Chunks without allocating a list. The chunk is only valid during the call.")
+        .def_property_readonly("loaded_chunk_count", &Dimension::getLoadedChunkCount,
+                               "Gets the number of loaded Chunks.");
 
     level.def_property_readonly("name", &Level::getName, "Gets the unique name of this level")
         .def_property_readonly("actors", &Level::getActors, "Get a list of all actors in this level",
                                py::return_value_policy::reference_internal)
+        .def(
+            "snapshot_actors",
+            [](const Level &self, py::object snapshot, ActorSnapshot::Fields fields, Dimension *dimension,
+               std::string type, bool players_only) {
+                if (snapshot.is_none()) {
+                    snapshot = py::cast(ActorSnapshot{});
+                }
+                self.snapshotActors(snapshot.cast<ActorSnapshot &>(), fields,
+                                    ActorSnapshot::Filter{dimension, std::move(type), players_only});
+                return snapshot;
+            },
+            py::arg("snapshot") = py::none(), py::arg("fields") = ActorSnapshot::AllFields,
+            py::arg("dimension") = py::none(), py::arg("type") = "", py::arg("players_only") = false,
+            "Captures the state of all actors in this level into a structure-of-arrays snapshot. Pass the previous "
+            "snapshot to reuse its storage.")
+        .def_property("item_merge_radius", &Level::getItemMergeRadius, &Level::setItemMergeRadius,
+                      "Gets or sets the radius within which dropped items are merged, or 0 to disable merging.")
+        .def_property("experience_merge_radius", &Level::getExperienceMergeRadius, &Level::setExperienceMergeRadius,
+                      "Gets or sets the radius within which experience orbs are merged, or 0 to disable merging.")
+        .def_property("merge_interval", &Level::getMergeInterval, &Level::setMergeInterval,
+                      "Gets or sets the interval, in ticks, between two merge passes.")
+        .def_property("merge_budget", &Level::getMergeBudget, &Level::setMergeBudget,
+                      "Gets or sets the maximum number of actors a merge pass may examine per tick.")
         .def_property("time", &Level::getTime, &Level::setTime, "Gets and sets the relative in-game time on the server")
         .def_property_readonly("dimensions", &Level::getDimensions, "Gets a list of all dimensions within this level.",
                                py::return_value_policy::reference_internal)
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "endstone_python.h"
+#include "event_executor.h"
 
 namespace py = pybind11;
 
@@ -79,6 +80,11 @@ public:
     {
         return {"\\.whl"};
     }
+
+    void disablePlugin(Plugin &plugin) const override
+    {
+        PYBIND11_OVERRIDE_NAME(void, PluginLoader, "disable_plugin", disablePlugin, std::ref(plugin));
+    }
 };
 
 namespace {
@@ -192,7 +198,7 @@ void init_plugin(py::module &m)
         .def("load_plugins", &PluginLoader::loadPlugins, py::arg("directory"),
              py::return_value_policy::reference_internal, "Loads the plugin contained within the specified directory")
         .def("enable_plugin", &PluginLoader::enablePlugin, py::arg("plugin"), "Enables the specified plugin")
-        .def("disable_plugin", &PluginLoader::enablePlugin, py::arg("plugin"), "Disables the specified plugin")
+        .def("disable_plugin", &PluginLoader::disablePlugin, py::arg("plugin"), "Disables the specified plugin")
         .def_property_readonly("plugin_file_filters", &PluginLoader::getPluginFileFilters,
                                "Returns a list of all filename filters expected by this PluginLoader")
         .def_property_readonly("server", &PluginLoader::getServer, py::return_value_policy::reference,
@@ -222,13 +228,22 @@ void init_plugin(py::module &m)
              "Calls an event which will be passed to plugins.")
         .def(
             "register_event",
-            [](PluginManager &self, std::string event, const std::function<void(Event *)> &executor,
-               EventPriority priority, Plugin &plugin, bool ignore_cancelled) {
-                self.registerEvent(
-                    std::move(event), [executor](Event &e) { executor(&e); }, priority, plugin, ignore_cancelled);
+            [](PluginManager &self, std::string event, const py::function &executor, EventPriority priority,
+               Plugin &plugin, bool ignore_cancelled) {
+                self.registerEvent(std::move(event), PyEventExecutor(executor), priority, plugin, ignore_cancelled);
             },
             py::arg("name"), py::arg("executor"), py::arg("priority"), py::arg("plugin"), py::arg("ignore_cancelled"),
             "Registers the given event")
+        .def(
+            "register_move_event",
+            [](PluginManager &self, const py::function &executor, PlayerMoveThreshold threshold,
+               EventPriority priority, Plugin &plugin, bool ignore_cancelled) {
+                self.registerMoveEvent(PyEventExecutor(executor), threshold, priority, plugin, ignore_cancelled);
+            },
+            py::arg("executor"), py::arg("threshold"), py::arg("priority"), py::arg("plugin"),
+            py::arg("ignore_cancelled"),
+            "Registers a handler of PlayerMoveEvent that is only called once a player has moved past the given "
+            "threshold")
         .def("get_permission", &PluginManager::getPermission, py::arg("name"), py::return_value_policy::reference,
              "Gets a Permission from its fully qualified name.")
         .def("remove_permission", py::overload_cast<Permission &>(&PluginManager::removePermission), py::arg("perm"),
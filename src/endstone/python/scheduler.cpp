@@ -32,13 +32,56 @@ void init_scheduler(py::module &m)
         .def("run_task", &Scheduler::runTaskTimer, py::arg("plugin"), py::arg("task"), py::arg("delay") = 0,
              py::arg("period") = 0, "Returns a task that will be executed synchronously",
              py::return_value_policy::reference)
+        .def("post_sync", &Scheduler::postSync, py::arg("plugin"), py::arg("callback"),
+             "Queues a callback to be run by the server thread on the next tick. The callbacks of a plugin are "
+             "discarded once it is disabled.")
         .def("cancel_task", &Scheduler::cancelTask, py::arg("id"), "Removes task from scheduler.")
         .def("cancel_tasks", &Scheduler::cancelTasks, py::arg("plugin"),
              "Removes all tasks associated with a particular plugin from the scheduler.")
         .def("is_running", &Scheduler::isRunning, py::arg("id"), "Check if the task currently running.")
         .def("is_queued", &Scheduler::isQueued, py::arg("id"), "Check if the task queued to be run later.")
         .def("get_pending_tasks", &Scheduler::getPendingTasks, "Returns a vector of all pending tasks.",
-             py::return_value_policy::reference_internal);
+             py::return_value_policy::reference_internal)
+        .def(
+            "call_sync",
+            [](Scheduler &self, const py::object &plugin, const py::object &func, const py::args &args) {
+                return py::module_::import("endstone._internal.event_loop")
+                    .attr("call_sync")(py::cast(&self, py::return_value_policy::reference), plugin, func, *args);
+            },
+            py::arg("plugin"), py::arg("func"),
+            "Calls a function on the server thread on the next tick and returns a future of its result.")
+        .def(
+            "call_async",
+            [](const Scheduler & /*self*/, const py::object &plugin, const py::object &func, const py::args &args) {
+                return py::module_::import("endstone._internal.event_loop").attr("call_async")(plugin, func, *args);
+            },
+            py::arg("plugin"), py::arg("func"),
+            "Calls a function on a worker thread and returns a future of its result.")
+        .def(
+            "next_tick",
+            [](const Scheduler & /*self*/) {
+                return py::module_::import("endstone._internal.event_loop").attr("next_tick")();
+            },
+            "Returns an awaitable that completes at the beginning of the next tick.")
+        .def(
+            "sleep_ticks",
+            [](const Scheduler & /*self*/, int ticks) {
+                return py::module_::import("endstone._internal.event_loop").attr("sleep_ticks")(ticks);
+            },
+            py::arg("ticks"), "Returns an awaitable that completes after the given number of ticks.")
+        .def(
+            "run_async",
+            [](const Scheduler & /*self*/, const py::object &func, const py::args &args) {
+                return py::module_::import("endstone._internal.event_loop").attr("run_async")(func, *args);
+            },
+            py::arg("func"),
+            "Runs a blocking function or a coroutine off the server thread and returns an awaitable of its result.")
+        .def_property_readonly(
+            "event_loop",
+            [](const Scheduler & /*self*/) {
+                return py::module_::import("endstone._internal.event_loop").attr("get_event_loop")().attr("loop");
+            },
+            "Gets the asyncio event loop run by the server thread on every tick.");
 }
 
 }  // namespace endstone::python
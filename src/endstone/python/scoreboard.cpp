@@ -97,6 +97,13 @@ void init_scoreboard(py::module_ &m)
         .def_property("render_type", &Objective::getRenderType, &Objective::setRenderType,
                       "Gets and sets the manner in which this objective will be rendered.")
         .def("get_score", &Objective::getScore, "Gets an entry's Score for this objective", py::arg("entry"))
+        .def(
+            "set_scores",
+            [](Objective &self, const std::vector<std::pair<ScoreEntry, int>> &scores) {
+                return self.setScores(scores);
+            },
+            "Sets the scores of many entries for this objective at once, sending a single packet to clients.",
+            py::arg("scores"))
         .def(py::self == py::self)
         .def(py::self != py::self);
 
@@ -121,7 +128,33 @@ void init_scoreboard(py::module_ &m)
              py::arg("entry"))
         .def_property_readonly("entries", &Scoreboard::getEntries, "Gets all entries tracked by this Scoreboard",
                                py::return_value_policy::reference_internal)
-        .def("clear_slot", &Scoreboard::clearSlot, "Clears any objective in the specified slot", py::arg("slot"));
+        .def("clear_slot", &Scoreboard::clearSlot, "Clears any objective in the specified slot", py::arg("slot"))
+        .def_property("buffered", &Scoreboard::isBuffered, &Scoreboard::setBuffered,
+                      "Gets or sets whether score changes on this Scoreboard are buffered until the end of the tick.");
+
+    py::class_<VirtualScoreboard>(m, "VirtualScoreboard",
+                                  "Represents the scoreboard displays that are only shown to a single player.")
+        .def(
+            "set_display",
+            [](VirtualScoreboard &self, DisplaySlot slot, std::string display_name,
+               std::optional<ObjectiveSortOrder> order) {
+                self.setDisplay(slot, std::move(display_name), order.value_or(ObjectiveSortOrder::Ascending));
+            },
+            "Displays an objective in the specified slot, replacing anything this VirtualScoreboard showed there.",
+            py::arg("slot"), py::arg("display_name"), py::arg("order") = std::nullopt)
+        .def("clear_display", &VirtualScoreboard::clearDisplay,
+             "Removes the display and all scores of the specified slot.", py::arg("slot"))
+        .def("is_displayed", &VirtualScoreboard::isDisplayed,
+             "Gets if an objective is displayed in the specified slot.", py::arg("slot"))
+        .def("get_score", &VirtualScoreboard::getScore, "Gets the score of an entry in the specified slot.",
+             py::arg("slot"), py::arg("entry"))
+        .def("set_score", &VirtualScoreboard::setScore, "Sets the score of an entry in the specified slot.",
+             py::arg("slot"), py::arg("entry"), py::arg("score"))
+        .def("reset_score", &VirtualScoreboard::resetScore, "Removes the score of an entry in the specified slot.",
+             py::arg("slot"), py::arg("entry"))
+        .def("set_lines", &VirtualScoreboard::setLines,
+             "Replaces all scores in the specified slot with lines of text, shown from top to bottom.",
+             py::arg("slot"), py::arg("lines"));
 }
 
 }  // namespace endstone::python
@@ -14,10 +14,103 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <pybind11/pybind11.h>
 
 #include "endstone/endstone.hpp"
 
+namespace endstone::python {
+
+/**
+ * @brief Caches the Python objects needed to convert between endstone::UUID and uuid.UUID.
+ *
+ * The objects are created on first use and released when the interpreter finalizes, so that a new interpreter starts
+ * with fresh ones. Must only be used while holding the GIL.
+ */
+class UUIDTypeCache {
+public:
+    static UUIDTypeCache &get()
+    {
+        auto &cache = instance();
+        if (!cache.type_) {
+            cache.init();
+        }
+        return cache;
+    }
+
+    /**
+     * @brief The uuid.UUID class
+     */
+    [[nodiscard]] PyObject *type() const
+    {
+        return type_;
+    }
+
+    /**
+     * @brief The keyword names used to call uuid.UUID(bytes=...) through vectorcall
+     */
+    [[nodiscard]] PyObject *kwnames() const
+    {
+        return kwnames_;
+    }
+
+    /**
+     * @brief The interned name of the uuid.UUID.int slot
+     */
+    [[nodiscard]] PyObject *intName() const
+    {
+        return int_name_;
+    }
+
+    /**
+     * @brief The number of bits in each half of the 128-bit integer
+     */
+    [[nodiscard]] PyObject *shift() const
+    {
+        return shift_;
+    }
+
+private:
+    static UUIDTypeCache &instance()
+    {
+        static UUIDTypeCache cache;
+        return cache;
+    }
+
+    void init()
+    {
+        auto type = pybind11::module_::import("uuid").attr("UUID");
+        auto kwnames = pybind11::make_tuple("bytes");
+        auto int_name = pybind11::reinterpret_steal<pybind11::object>(PyUnicode_InternFromString("int"));
+        auto shift = pybind11::reinterpret_steal<pybind11::object>(PyLong_FromLong(64));
+        if (!int_name || !shift) {
+            throw pybind11::error_already_set();
+        }
+        pybind11::module_::import("atexit").attr("register")(pybind11::cpp_function([] { instance().reset(); }));
+
+        type_ = type.release().ptr();
+        kwnames_ = kwnames.release().ptr();
+        int_name_ = int_name.release().ptr();
+        shift_ = shift.release().ptr();
+    }
+
+    void reset()
+    {
+        Py_CLEAR(type_);
+        Py_CLEAR(kwnames_);
+        Py_CLEAR(int_name_);
+        Py_CLEAR(shift_);
+    }
+
+    PyObject *type_ = nullptr;
+    PyObject *kwnames_ = nullptr;
+    PyObject *int_name_ = nullptr;
+    PyObject *shift_ = nullptr;
+};
+
+}  // namespace endstone::python
+
 namespace pybind11::detail {
 template <>
 class type_caster<endstone::UUID> {
@@ -25,62 +118,50 @@ public:
     // Python -> C++
     bool load(handle src, bool)
     {
-        /* Extract PyObject from handle */
-        PyObject *source = src.ptr();
-
-        /* Check if the Python Object is a UUID instance */
-        PyObject *uuid_module = PyImport_ImportModule("uuid");
-        PyObject *uuid_class = PyObject_GetAttrString(uuid_module, "UUID");
-        if (!PyObject_IsInstance(source, uuid_class)) {
-            PyErr_SetString(PyExc_TypeError, "Object is not an instance of UUID");
-            Py_XDECREF(uuid_module);
-            Py_XDECREF(uuid_class);
+        const auto &cache = endstone::python::UUIDTypeCache::get();
+        if (PyObject_IsInstance(src.ptr(), cache.type()) != 1) {
+            PyErr_Clear();
             return false;
         }
 
-        /* Now try to convert into C++ object */
-        PyObject *bytes = PyObject_GetAttrString(source, "bytes");
-        if (PyBytes_GET_SIZE(bytes) != 16) {
-            PyErr_SetString(PyExc_ValueError, "UUID bytes size must be 16");
-            Py_XDECREF(bytes);
-            Py_XDECREF(uuid_module);
-            Py_XDECREF(uuid_class);
+        // Read the 128-bit integer stored in the slot of uuid.UUID, which is cheaper than computing uuid.UUID.bytes
+        auto number = reinterpret_steal<object>(PyObject_GetAttr(src.ptr(), cache.intName()));
+        if (!number) {
+            PyErr_Clear();
+            return false;
+        }
+        auto high = reinterpret_steal<object>(PyNumber_Rshift(number.ptr(), cache.shift()));
+        if (!high) {
+            PyErr_Clear();
             return false;
         }
 
-        const char *bytes_data = PyBytes_AS_STRING(bytes);
-        for (int i = 0; i < 16; i++) {
-            value.data[i] = bytes_data[i];
+        const auto lo = PyLong_AsUnsignedLongLongMask(number.ptr());
+        const auto hi = PyLong_AsUnsignedLongLongMask(high.ptr());
+        if (PyErr_Occurred()) {
+            PyErr_Clear();
+            return false;
         }
 
-        /* Clean up */
-        Py_XDECREF(bytes);
-        Py_XDECREF(uuid_module);
-        Py_XDECREF(uuid_class);
-        return PyErr_Occurred() == nullptr;
+        for (int i = 0; i < 8; i++) {
+            value.data[i] = static_cast<std::uint8_t>(hi >> (56 - 8 * i));
+            value.data[8 + i] = static_cast<std::uint8_t>(lo >> (56 - 8 * i));
+        }
+        return true;
     }
 
     // C++ -> Python
     static handle cast(endstone::UUID src, return_value_policy /* policy */, handle /* parent */)
     {
-        PyObject *uuid_module = PyImport_ImportModule("uuid");
-        PyObject *uuid_class = PyObject_GetAttrString(uuid_module, "UUID");
-
-        // Create Python bytes object from the UUID struct data.
-        PyObject *py_bytes = PyBytes_FromStringAndSize(reinterpret_cast<const char *>(src.data), 16);
-
-        // Create a dictionary to hold keyword arguments for the UUID constructor.
-        PyObject *kwargs = PyDict_New();
-        PyDict_SetItemString(kwargs, "bytes", py_bytes);
-
-        PyObject *res = PyObject_Call(uuid_class, PyTuple_New(0), kwargs);
-
-        Py_XDECREF(py_bytes);
-        Py_XDECREF(kwargs);
-        Py_XDECREF(uuid_module);
-        Py_XDECREF(uuid_class);
+        const auto &cache = endstone::python::UUIDTypeCache::get();
+        auto bytes = reinterpret_steal<object>(PyBytes_FromStringAndSize(reinterpret_cast<const char *>(src.data), 16));
+        if (!bytes) {
+            return nullptr;
+        }
 
-        return {res};
+        // uuid.UUID(bytes=...)
+        PyObject *args[] = {nullptr, bytes.ptr()};
+        return PyObject_Vectorcall(cache.type(), args + 1, 0 | PY_VECTORCALL_ARGUMENTS_OFFSET, cache.kwnames());
     }
 
     PYBIND11_TYPE_CASTER(endstone::UUID, const_name("uuid.UUID"));
@@ -32,6 +32,10 @@ MCRESULT MinecraftCommands::executeCommand(CommandContext &ctx, bool suppress_ou
         auto command_line = ctx.getCommand();
 
         if (auto *player = sender->asPlayer(); player) {
+            if (server.getLoginQueue().isPending(*player)) {
+                return MCRESULT_CommandsDisabled;
+            }
+
             endstone::PlayerCommandEvent event(*player, ctx.getCommand());
             server.getPluginManager().callEvent(event);
 
@@ -23,7 +23,6 @@
 #include "endstone/core/server.h"
 #include "endstone/event/player/player_chat_event.h"
 #include "endstone/event/player/player_kick_event.h"
-#include "endstone/event/player/player_login_event.h"
 #include "endstone/runtime/hook.h"
 
 using endstone::core::EndstonePlayer;
@@ -71,12 +70,7 @@ bool ServerNetworkHandler::trytLoadPlayer(ServerPlayer &server_player, const Con
         return new_player;
     }
 
-    endstone::PlayerLoginEvent e{endstone_player};
-    server.getPluginManager().callEvent(e);
-
-    if (e.isCancelled()) {
-        endstone_player.kick(e.getKickMessage());
-    }
+    server.getLoginQueue().login(endstone_player);
     return new_player;
 }
 
@@ -101,12 +95,7 @@ ServerPlayer &ServerNetworkHandler::_createNewPlayer(const NetworkIdentifier &ne
         return server_player;
     }
 
-    endstone::PlayerLoginEvent e{endstone_player};
-    server.getPluginManager().callEvent(e);
-
-    if (e.isCancelled()) {
-        endstone_player.kick(e.getKickMessage());
-    }
+    server.getLoginQueue().login(endstone_player);
     return server_player;
 }
 
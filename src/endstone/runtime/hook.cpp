@@ -16,9 +16,11 @@
 
 #include <funchook.h>
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <system_error>
-#include <unordered_map>
+#include <type_traits>
 
 #include <entt/core/hashed_string.hpp>
 #include <spdlog/spdlog.h>
@@ -28,35 +30,22 @@
 
 namespace endstone::hook {
 namespace details {
-using OriginalMap = std::unordered_map<entt::hashed_string::hash_type, void *>;
-static OriginalMap &originals()  // NOLINT(*-use-anonymous-namespace)
+static_assert(std::is_same_v<entt::hashed_string::hash_type, std::uint32_t>, "symbols are looked up by 32-bit hashes");
+
+using OriginalArray = std::array<void *, detail::symbols.size()>;
+static OriginalArray &originals()  // NOLINT(*-use-anonymous-namespace)
 {
-    static OriginalMap originals;
+    static OriginalArray originals{};
     return originals;
 }
 
 void *&get_original(entt::hashed_string::hash_type name)
 {
-    const auto it = originals().find(name);
-    if (it == originals().end()) {
+    const auto index = detail::find_symbol(name);
+    if (index == detail::symbols.size() || originals()[index] == nullptr) {
         throw std::runtime_error("original function not found");
     }
-    return it->second;
-}
-
-const std::unordered_map<std::string, void *> &get_targets()
-{
-    static std::unordered_map<std::string, void *> targets;
-    if (!targets.empty()) {
-        return targets;
-    }
-    auto *executable_base = detail::get_executable_base();
-    detail::foreach_symbol([executable_base](const auto &key, auto offset) {
-        SPDLOG_DEBUG("T: {} -> 0x{:x}", key, offset);
-        auto *target = static_cast<char *>(executable_base) + offset;
-        targets.emplace(key, target);
-    });
-    return targets;
+    return originals()[index];
 }
 
 const std::error_category &error_category()
@@ -108,32 +97,50 @@ const std::error_category &error_category()
 
 void install()
 {
-    const auto &detours = details::get_detours();
-    const auto &targets = details::get_targets();
-
-    for (const auto &[name, detour] : detours) {
-        if (auto it = targets.find(name); it != targets.end()) {
-            void *target = it->second;
-            void *original = target;
-
-            funchook_t *hook = funchook_create();
-            int status = funchook_prepare(hook, &original, detour);
-            if (status != 0) {
-                throw std::system_error(status, details::error_category(), fmt::format("Unable to hook {}", name));
-            }
+    // Every function exported by this module is a detour, so a detour with a misspelled name, or one missing from the
+    // symbols or without an address for this version, is caught here rather than silently never installed.
+    for (const auto &name : details::get_detour_names()) {
+        const auto index = detail::find_symbol(entt::hashed_string::value(name.data(), name.size()));
+        if (index == detail::symbols.size() || detail::symbols[index].first != name) {
+            throw std::runtime_error(fmt::format("Unable to find target function for detour: {}.", name));
+        }
+    }
 
-            status = funchook_install(hook, 0);
-            if (status != 0) {
-                throw std::system_error(status, details::error_category(), fmt::format("Unable to hook {}", name));
-            }
+    // All detours are prepared in one session and installed together, so the code pages of the server are made
+    // writable once rather than once per hook.
+    funchook_t *hook = funchook_create();
+    if (hook == nullptr) {
+        throw std::system_error(FUNCHOOK_ERROR_OUT_OF_MEMORY, details::error_category(), "Unable to create hooks");
+    }
 
-            SPDLOG_DEBUG("{}: {} -> {} -> {}", name, target, detour, original);
-            details::originals().emplace(entt::hashed_string::value(name.c_str()), original);
+    auto *executable_base = static_cast<char *>(detail::get_executable_base());
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < detail::symbols.size(); ++i) {
+        const auto &[name, offset] = detail::symbols[i];
+        void *detour = details::get_detour(name.data());
+        if (detour == nullptr) {
+            continue;  // used with BEDROCK_CALL only
         }
-        else {
-            throw std::runtime_error(fmt::format("Unable to find target function for detour: {}.", name));
+
+        void *target = executable_base + offset;
+        void *original = target;
+        const int status = funchook_prepare(hook, &original, detour);
+        if (status != 0) {
+            auto message = fmt::format("Unable to hook {}: {}", name, funchook_error_message(hook));
+            funchook_destroy(hook);
+            throw std::system_error(status, details::error_category(), message);
         }
+        SPDLOG_DEBUG("{}: {} -> {} -> {}", name, target, detour, original);
+        details::originals()[i] = original;
+        ++count;
+    }
+
+    if (const int status = funchook_install(hook, 0); status != 0) {
+        auto message = fmt::format("Unable to install hooks: {}", funchook_error_message(hook));
+        funchook_destroy(hook);
+        throw std::system_error(status, details::error_category(), message);
     }
+    SPDLOG_DEBUG("{} hooks installed.", count);
 }
 
 }  // namespace endstone::hook
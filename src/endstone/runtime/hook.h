@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <string>
 #include <system_error>
+#include <vector>
 
 #include <entt/entt.hpp>
 
@@ -24,8 +26,8 @@ namespace endstone::hook {
 namespace details {
 const std::error_category &error_category();
 void *&get_original(entt::hashed_string::hash_type name);
-const std::unordered_map<std::string, void *> &get_targets();
-const std::unordered_map<std::string, void *> &get_detours();
+void *get_detour(const char *name);
+std::vector<std::string> get_detour_names();
 }  // namespace details
 
 void install();
@@ -16,91 +16,118 @@
 
 #ifdef __linux__
 
-#include <fcntl.h>
-#include <gelf.h>
-#include <libelf.h>
-#include <unistd.h>
+#include <dlfcn.h>
+#include <elf.h>
+#include <link.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 #include "endstone/detail/platform.h"
 
 namespace {
-void read_elf(const std::string &module_pathname, uint32_t section_type,
-              const std::function<void(Elf *, GElf_Shdr &, GElf_Sym &)> &sym_handler)
+void *get_module_handle()
 {
-    if (elf_version(EV_CURRENT) == EV_NONE) {
-        throw std::runtime_error("ELF library initialization failed");
-    }
-
-    int fd = open(module_pathname.c_str(), O_RDONLY);
-    if (fd < 0) {
-        throw std::runtime_error("Failed to open file: " + module_pathname);
-    }
-
-    Elf *elf = elf_begin(fd, ELF_C_READ, nullptr);
-    if (!elf) {
-        throw std::runtime_error("elf_begin() failed.");
-    }
-
-    Elf_Scn *scn = nullptr;
-    while ((scn = elf_nextscn(elf, scn)) != nullptr) {
-        GElf_Shdr shdr;
-        if (gelf_getshdr(scn, &shdr) != &shdr) {
-            throw std::runtime_error("gelf_getshdr() failed.");
+    static void *handle = [] {
+        void *result = dlopen(endstone::detail::get_module_pathname().c_str(), RTLD_LAZY | RTLD_NOLOAD);
+        if (result == nullptr) {
+            throw std::runtime_error(std::string("dlopen() failed: ") + dlerror());
         }
+        return result;
+    }();
+    return handle;
+}
 
-        if (shdr.sh_type == section_type) {
-            // Found the dynamic symbol table. Read it.
-            Elf_Data *data = elf_getdata(scn, nullptr);
-            const auto symbol_count = shdr.sh_size / shdr.sh_entsize;
-
-            for (auto i = 0; i < symbol_count; ++i) {
-                GElf_Sym sym;
-                if (gelf_getsym(data, i, &sym) != &sym) {
-                    throw std::runtime_error("gelf_getsym() failed.");
-                }
-
-                sym_handler(elf, shdr, sym);
-            }
-
-            break;  // No need to check further sections
-        }
+// Returns the number of symbols in a GNU hash table, which does not store it, from the end of its longest chain
+std::size_t get_symbol_count(const std::uint32_t *gnu_hash)
+{
+    const auto bucket_count = gnu_hash[0];
+    const auto symbol_offset = gnu_hash[1];
+    const auto bloom_size = gnu_hash[2];
+    const auto *buckets = reinterpret_cast<const std::uint32_t *>(
+        reinterpret_cast<const ElfW(Addr) *>(gnu_hash + 4) + bloom_size);
+    const auto *chains = buckets + bucket_count;
+
+    const auto last = *std::max_element(buckets, buckets + bucket_count);
+    if (last < symbol_offset) {
+        return symbol_offset;
     }
-
-    elf_end(elf);
-    close(fd);
+    auto index = last;
+    while ((chains[index - symbol_offset] & 1) == 0) {
+        ++index;
+    }
+    return index + 1;
 }
 }  // namespace
 
 namespace endstone::hook::details {
-const std::unordered_map<std::string, void *> &get_detours()
+void *get_detour(const char *name)
 {
-    static std::unordered_map<std::string, void *> detours;
-    if (!detours.empty()) {
-        return detours;
+    // Detours are the functions of this module exported under the same name as their targets in the server, so they
+    // are found through the dynamic symbol table that is already loaded, rather than by reading the ELF file.
+    void *detour = dlsym(get_module_handle(), name);
+    if (detour == nullptr) {
+        return nullptr;
     }
+    // dlsym also searches the dependencies of this module
+    Dl_info info;
+    if (dladdr(detour, &info) == 0 || info.dli_fbase != detail::get_module_base()) {
+        return nullptr;
+    }
+    return detour;
+}
 
-    auto *module_base = detail::get_module_base();
-    auto module_pathname = detail::get_module_pathname();
+std::vector<std::string> get_detour_names()
+{
+    link_map *map = nullptr;
+    if (dlinfo(get_module_handle(), RTLD_DI_LINKMAP, &map) != 0) {
+        throw std::runtime_error(std::string("dlinfo() failed: ") + dlerror());
+    }
 
-    read_elf(module_pathname, SHT_DYNSYM, [&](auto *elf, auto &shdr, auto &sym) {
-        if (sym.st_shndx == SHN_UNDEF || GELF_ST_TYPE(sym.st_info) != STT_FUNC ||
-            GELF_ST_BIND(sym.st_info) != STB_GLOBAL) {
-            return;
+    // glibc relocates the addresses in the dynamic section when it loads the module, other loaders may not
+    const auto relocate = [map](ElfW(Addr) address) {
+        return address < map->l_addr ? address + map->l_addr : address;
+    };
+    const ElfW(Sym) *symbol_table = nullptr;
+    const char *string_table = nullptr;
+    std::size_t symbol_count = 0;
+    for (const auto *dyn = map->l_ld; dyn->d_tag != DT_NULL; ++dyn) {
+        switch (dyn->d_tag) {
+        case DT_SYMTAB:
+            symbol_table = reinterpret_cast<const ElfW(Sym) *>(relocate(dyn->d_un.d_ptr));
+            break;
+        case DT_STRTAB:
+            string_table = reinterpret_cast<const char *>(relocate(dyn->d_un.d_ptr));
+            break;
+        case DT_HASH:
+            symbol_count = reinterpret_cast<const ElfW(Word) *>(relocate(dyn->d_un.d_ptr))[1];
+            break;
+        case DT_GNU_HASH:
+            if (symbol_count == 0) {
+                symbol_count = get_symbol_count(reinterpret_cast<const std::uint32_t *>(relocate(dyn->d_un.d_ptr)));
+            }
+            break;
+        default:
+            break;
         }
+    }
+    if (symbol_table == nullptr || string_table == nullptr) {
+        throw std::runtime_error("Unable to find the dynamic symbol table");
+    }
 
-        char *name = elf_strptr(elf, shdr.sh_link, sym.st_name);
-        if (name == nullptr) {
-            return;
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < symbol_count; ++i) {
+        const auto &symbol = symbol_table[i];
+        if (symbol.st_shndx == SHN_UNDEF || ELF64_ST_TYPE(symbol.st_info) != STT_FUNC ||
+            ELF64_ST_BIND(symbol.st_info) != STB_GLOBAL) {
+            continue;
         }
-
-        auto offset = sym.st_value;
-        auto *detour = static_cast<char *>(module_base) + offset;
-        detours.emplace(name, detour);
-    });
-    return detours;
+        names.emplace_back(string_table + symbol.st_name);
+    }
+    return names;
 }
 }  // namespace endstone::hook::details
 
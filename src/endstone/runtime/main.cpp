@@ -21,6 +21,7 @@
 
 #include "endstone/core/devtools/devtools.h"
 #include "endstone/core/logger_factory.h"
+#include "endstone/core/startup_timer.h"
 #include "endstone/runtime/hook.h"
 
 #if __GNUC__
@@ -37,22 +38,27 @@ ENDSTONE_RUNTIME_CTOR int main()
     const auto &logger = endstone::core::LoggerFactory::getLogger("EndstoneRuntime");
     try {
         logger.info("Initialising...");
+        auto &timer = endstone::core::StartupTimer::getInstance();
 
         // Initialise an isolated Python environment to avoid installing signal handlers
         // https://docs.python.org/3/c-api/init_config.html#init-isolated-conf
-        PyConfig config;
-        PyConfig_InitIsolatedConfig(&config);
-        config.isolated = 0;
-        config.use_environment = 1;
-        config.install_signal_handlers = 0;
-        py::initialize_interpreter(&config);
-        py::module_::import("threading");  // https://github.com/pybind/pybind11/issues/2197
-        py::module_::import("numpy");      // https://github.com/numpy/numpy/issues/24833
+        timer.measure("Python init", [] {
+            PyConfig config;
+            PyConfig_InitIsolatedConfig(&config);
+            config.isolated = 0;
+            config.use_environment = 1;
+            config.install_signal_handlers = 0;
+            py::initialize_interpreter(&config);
+            py::module_::import("threading");  // https://github.com/pybind/pybind11/issues/2197
+        });
+        timer.measure("numpy import", [] {
+            py::module_::import("numpy");  // https://github.com/numpy/numpy/issues/24833
+        });
         py::gil_scoped_release release{};
         release.disarm();
 
         // Install hooks
-        endstone::hook::install();
+        timer.measure("Hook install", [] { endstone::hook::install(); });
 
 #ifdef ENDSTONE_WITH_DEVTOOLS
         // Create devtools window
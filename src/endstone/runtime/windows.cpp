@@ -18,85 +18,38 @@
 
 #include <Windows.h>
 
-// DbgHelp.h must be included after Windows.h
-#include <DbgHelp.h>
-
-#include <chrono>
 #include <string>
-#include <system_error>
-#include <unordered_map>
+#include <vector>
 
 #include "endstone/detail/platform.h"
 
-enum SymTagEnum {
-    SymTagPublicSymbol = 10,
-};
-
-namespace {
-void enumerate_symbols(const char *path, std::function<bool(const std::string &, std::size_t, std::uint32_t)> callback,
-                       bool load_symbol)
+namespace endstone::hook::details {
+void *get_detour(const char *name)
 {
-    HANDLE current_process = GetCurrentProcess();
-    HANDLE handle;
-    if (!DuplicateHandle(current_process, current_process, current_process, &handle, 0, FALSE, DUPLICATE_SAME_ACCESS)) {
-        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "DuplicateHandle failed");
-    }
-
-    if (!SymInitialize(handle, nullptr, FALSE)) {
-        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "SymInitialize failed");
-    }
-
-    SymSetOptions(NULL);  // do not undecorate symbols by default
-
-    auto module_base =
-        SymLoadModuleEx(handle, nullptr, path, nullptr, 0, 0, nullptr, load_symbol ? 0 : SLMFLAG_NO_SYMBOLS);
-    if (!module_base) {
-        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "SymLoadModuleEx failed");
-    }
-
-    struct UserContext {
-        std::size_t module_base;
-        std::function<bool(const std::string &, std::size_t, std::uint32_t)> callback;
-    };
-    auto user_context = UserContext{module_base, std::move(callback)};
-
-    SymSearch(
-        handle, module_base, 0, SymTagPublicSymbol, "*", 0,
-        [](PSYMBOL_INFO info /*pSymInfo*/, ULONG /*SymbolSize*/, PVOID user_context /*UserContext*/) -> BOOL {
-            auto *ctx = static_cast<UserContext *>(user_context);
-            if (!(ctx->callback)(info->Name, info->Address - ctx->module_base, info->Flags)) {
-                return FALSE;
-            }
-            return TRUE;
-        },
-        &user_context, SYMSEARCH_GLOBALSONLY);
-
-    SymCleanup(handle);
+    // Detours are exported from this module under the same decorated name as their targets in the server, so they
+    // are found through the export table that is already loaded, rather than by enumerating symbols with DbgHelp.
+    auto *module = static_cast<HMODULE>(detail::get_module_base());
+    return reinterpret_cast<void *>(GetProcAddress(module, name));
 }
-}  // namespace
 
-namespace endstone::hook::details {
-const std::unordered_map<std::string, void *> &get_detours()
+std::vector<std::string> get_detour_names()
 {
-    static std::unordered_map<std::string, void *> detours;
-    if (!detours.empty()) {
-        return detours;
+    const auto *base = static_cast<const char *>(detail::get_module_base());
+    const auto *dos_header = reinterpret_cast<const IMAGE_DOS_HEADER *>(base);
+    const auto *nt_headers = reinterpret_cast<const IMAGE_NT_HEADERS *>(base + dos_header->e_lfanew);
+    const auto &directory = nt_headers->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+    if (directory.Size == 0) {
+        return {};
     }
 
-    auto *module_base = detail::get_module_base();
-    const auto module_pathname = detail::get_module_pathname();
-
-    enumerate_symbols(  //
-        module_pathname.c_str(),
-        [&](const std::string &name, std::size_t offset, std::uint32_t flags) -> bool {
-            if (flags & SYMFLAG_EXPORT) {
-                auto *detour = static_cast<char *>(module_base) + offset;
-                detours.emplace(name, detour);
-            }
-            return true;
-        },
-        false);  // set load_symbol to false so symbols are limited to the export table
-    return detours;
+    const auto *exports = reinterpret_cast<const IMAGE_EXPORT_DIRECTORY *>(base + directory.VirtualAddress);
+    const auto *name_addresses = reinterpret_cast<const DWORD *>(base + exports->AddressOfNames);
+    std::vector<std::string> names;
+    names.reserve(exports->NumberOfNames);
+    for (DWORD i = 0; i < exports->NumberOfNames; ++i) {
+        names.emplace_back(base + name_addresses[i]);
+    }
+    return names;
 }
 }  // namespace endstone::hook::details
 
@@ -0,0 +1,339 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "bedrock/nbt/compound_tag.h"
+#include "bedrock/nbt/list_tag.h"
+#include "bedrock/util/string_byte_output.h"
+
+namespace {
+// reads little endian NBT from a buffer, as the server does from disk
+class StringByteInput : public IDataInput {
+public:
+    explicit StringByteInput(std::string_view buffer) : buffer_(buffer) {}
+
+    Bedrock::Result<std::string> readStringResult() override
+    {
+        auto length = readShortResult();
+        if (!length) {
+            return nonstd::make_unexpected(length.error());
+        }
+        return readString(static_cast<std::uint16_t>(length.value()));
+    }
+
+    Bedrock::Result<std::string> readLongStringResult() override
+    {
+        auto length = readIntResult();
+        if (!length) {
+            return nonstd::make_unexpected(length.error());
+        }
+        return readString(static_cast<std::uint32_t>(length.value()));
+    }
+
+    Bedrock::Result<float> readFloatResult() override
+    {
+        return read<float>();
+    }
+
+    Bedrock::Result<double> readDoubleResult() override
+    {
+        return read<double>();
+    }
+
+    Bedrock::Result<std::uint8_t> readByteResult() override
+    {
+        return read<std::uint8_t>();
+    }
+
+    Bedrock::Result<std::int16_t> readShortResult() override
+    {
+        return read<std::int16_t>();
+    }
+
+    Bedrock::Result<std::int32_t> readIntResult() override
+    {
+        return read<std::int32_t>();
+    }
+
+    Bedrock::Result<std::int64_t> readLongLongResult() override
+    {
+        return read<std::int64_t>();
+    }
+
+    Bedrock::Result<void> readBytesResult(void *data, std::uint64_t bytes) override
+    {
+        if (bytes > numBytesLeft()) {
+            return nonstd::make_unexpected(
+                Bedrock::ErrorInfo<std::error_code>{std::make_error_code(std::errc::result_out_of_range)});
+        }
+        std::memcpy(data, buffer_.data() + offset_, bytes);
+        offset_ += bytes;
+        return {};
+    }
+
+    [[nodiscard]] std::uint64_t numBytesLeft() const override
+    {
+        return buffer_.size() - offset_;
+    }
+
+private:
+    template <typename T>
+    Bedrock::Result<T> read()
+    {
+        T value;
+        if (auto result = readBytesResult(&value, sizeof(T)); !result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        return value;
+    }
+
+    Bedrock::Result<std::string> readString(std::uint64_t length)
+    {
+        std::string value(std::min(length, numBytesLeft()), '\0');
+        if (auto result = readBytesResult(value.data(), length); !result) {
+            return nonstd::make_unexpected(result.error());
+        }
+        return value;
+    }
+
+    std::string_view buffer_;
+    std::size_t offset_{0};
+};
+
+// an item stack as stored in a player inventory, with enchantments and a custom name and lore
+CompoundTag makeItem()
+{
+    CompoundTag item;
+    item.putByte("Count", 1);
+    item.putShort("Damage", 0);
+    item.putString("Name", "minecraft:diamond_sword");
+    item.putBoolean("WasPickedUp", false);
+
+    CompoundTag tag;
+    tag.putInt("Damage", 3);
+    tag.putInt64("UniqueId", 0x123456789abcdefLL);
+    tag.putFloat("Weight", 1.5F);
+    tag.putDouble("Value", 2.25);
+    auto enchantments = std::make_unique<ListTag>();
+    for (int i = 0; i < 3; ++i) {
+        auto enchantment = std::make_unique<CompoundTag>();
+        enchantment->putShort("id", static_cast<std::int16_t>(9 + i));
+        enchantment->putShort("lvl", static_cast<std::int16_t>(i + 1));
+        enchantments->add(std::move(enchantment));
+    }
+    tag.put("ench", std::move(enchantments));
+
+    CompoundTag display;
+    display.putString("Name", "§6Excalibur");
+    auto lore = std::make_unique<ListTag>();
+    lore->add(std::make_unique<StringTag>("§7Forged in the depths"));
+    lore->add(std::make_unique<StringTag>("§7of the Nether"));
+    display.put("Lore", std::move(lore));
+    tag.putCompound("display", std::move(display));
+    item.putCompound("tag", std::move(tag));
+    return item;
+}
+
+std::string write(const Tag &tag)
+{
+    StringByteOutput output;
+    tag.write(output);
+    return output.buffer;
+}
+
+// a compound holding the given number of compounds nested in one another
+std::string nestedCompounds(int depth)
+{
+    std::string buffer;
+    for (int i = 0; i < depth; ++i) {
+        buffer += std::string("\x0a\x00\x00", 3);  // a compound with an empty name
+    }
+    buffer.append(depth + 1, '\x00');
+    return buffer;
+}
+
+// a list holding the given number of lists nested in one another
+std::string nestedLists(int depth)
+{
+    std::string buffer;
+    for (int i = 0; i < depth; ++i) {
+        buffer += std::string("\x09\x01\x00\x00\x00", 5);  // a list of one list
+    }
+    buffer += std::string("\x01\x00\x00\x00\x00", 5);  // an empty list of bytes
+    return buffer;
+}
+
+std::string listOfBytes(std::int32_t length)
+{
+    std::string buffer("\x01", 1);
+    buffer.append(reinterpret_cast<const char *>(&length), sizeof(length));
+    return buffer;
+}
+}  // namespace
+
+TEST(CompoundTagTest, RoundTrip)
+{
+    const auto item = makeItem();
+    const auto buffer = write(item);
+
+    StringByteInput input{buffer};
+    CompoundTag loaded;
+    ASSERT_TRUE(loaded.load(input));
+    EXPECT_EQ(input.numBytesLeft(), 0);
+    EXPECT_TRUE(loaded.equals(item));
+    EXPECT_EQ(loaded.getString("Name"), "minecraft:diamond_sword");
+    const auto *tag = loaded.getCompound("tag");
+    ASSERT_NE(tag, nullptr);
+    ASSERT_TRUE(tag->contains("ench", Tag::Type::List));
+    EXPECT_EQ(static_cast<const ListTag *>(tag->get("ench"))->size(), 3);
+    EXPECT_EQ(write(loaded), buffer);
+}
+
+TEST(CompoundTagTest, LoadReplacesExistingTags)
+{
+    CompoundTag tag;
+    tag.putString("Stale", "value");
+
+    const auto buffer = write(makeItem());
+    StringByteInput input{buffer};
+    ASSERT_TRUE(tag.load(input));
+    EXPECT_FALSE(tag.contains("Stale"));
+    EXPECT_TRUE(tag.equals(makeItem()));
+}
+
+TEST(CompoundTagTest, TruncatedInput)
+{
+    const auto buffer = write(makeItem());
+    for (std::size_t size = 0; size < buffer.size(); ++size) {
+        StringByteInput input{std::string_view(buffer).substr(0, size)};
+        CompoundTag tag;
+        EXPECT_FALSE(tag.load(input)) << "loaded from the first " << size << " bytes";
+    }
+}
+
+TEST(CompoundTagTest, UnknownTagType)
+{
+    const std::string buffer("\x0c\x00\x00\x00", 4);
+    StringByteInput input{buffer};
+    CompoundTag tag;
+    EXPECT_FALSE(tag.load(input));
+}
+
+TEST(CompoundTagTest, NestingDepth)
+{
+    // the outermost compound counts as one level
+    {
+        const auto buffer = nestedCompounds(Tag::MaxDepth - 1);
+        StringByteInput input{buffer};
+        CompoundTag tag;
+        EXPECT_TRUE(tag.load(input));
+    }
+    {
+        const auto buffer = nestedCompounds(Tag::MaxDepth);
+        StringByteInput input{buffer};
+        CompoundTag tag;
+        EXPECT_FALSE(tag.load(input));
+    }
+
+    // a failed load leaves nothing behind for the next one
+    const auto buffer = nestedCompounds(1);
+    StringByteInput input{buffer};
+    CompoundTag tag;
+    EXPECT_TRUE(tag.load(input));
+}
+
+TEST(ListTagTest, RoundTrip)
+{
+    ListTag list;
+    for (int i = 0; i < 4; ++i) {
+        list.add(std::make_unique<IntTag>(i * 100));
+    }
+    const auto buffer = write(list);
+
+    StringByteInput input{buffer};
+    ListTag loaded;
+    ASSERT_TRUE(loaded.load(input));
+    EXPECT_TRUE(loaded.equals(list));
+    EXPECT_EQ(loaded.getInt(3), 300);
+}
+
+TEST(ListTagTest, Length)
+{
+    {
+        const auto buffer = listOfBytes(-1);
+        StringByteInput input{buffer};
+        ListTag list;
+        EXPECT_FALSE(list.load(input));
+    }
+    {
+        // more elements than bytes left, so nothing is reserved for them
+        auto buffer = listOfBytes(0x7fffffff);
+        buffer += "\x01\x02";
+        StringByteInput input{buffer};
+        ListTag list;
+        EXPECT_FALSE(list.load(input));
+    }
+    {
+        auto buffer = listOfBytes(3);
+        buffer += "\x01\x02";
+        StringByteInput input{buffer};
+        ListTag list;
+        EXPECT_FALSE(list.load(input));
+    }
+    {
+        auto buffer = listOfBytes(3);
+        buffer += "\x01\x02\x03";
+        StringByteInput input{buffer};
+        ListTag list;
+        ASSERT_TRUE(list.load(input));
+        EXPECT_EQ(list.size(), 3);
+        EXPECT_EQ(list.getByte(2), 3);
+    }
+}
+
+TEST(ListTagTest, NestingDepth)
+{
+    // lists of lists do not go through CompoundTag, so they are limited on their own
+    {
+        const auto buffer = nestedLists(Tag::MaxDepth - 1);
+        StringByteInput input{buffer};
+        ListTag list;
+        EXPECT_TRUE(list.load(input));
+    }
+    {
+        const auto buffer = nestedLists(Tag::MaxDepth);
+        StringByteInput input{buffer};
+        ListTag list;
+        EXPECT_FALSE(list.load(input));
+    }
+
+    // compounds and lists count towards the same limit
+    std::string buffer;
+    for (int i = 0; i < Tag::MaxDepth / 2; ++i) {
+        buffer += std::string("\x09\x00\x00", 3);        // a list with an empty name ...
+        buffer += std::string("\x0a\x01\x00\x00\x00", 5);  // ... of one compound
+    }
+    buffer.append(Tag::MaxDepth / 2 + 1, '\x00');
+    StringByteInput input{buffer};
+    CompoundTag tag;
+    EXPECT_FALSE(tag.load(input));
+}
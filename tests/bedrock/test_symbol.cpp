@@ -0,0 +1,38 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include "bedrock/symbol.h"
+
+using endstone::detail::find_symbol;
+using endstone::detail::symbols;
+using endstone::detail::unresolved_symbols;
+
+TEST(SymbolTest, FindsEverySymbolByHash)
+{
+    for (std::size_t i = 0; i < symbols.size(); ++i) {
+        const auto &[name, offset] = symbols[i];
+        ASSERT_EQ(find_symbol(entt::hashed_string::value(name.data(), name.size())), i) << name;
+    }
+}
+
+TEST(SymbolTest, DoesNotFindOtherNames)
+{
+    for (const auto &name : unresolved_symbols) {
+        EXPECT_EQ(find_symbol(entt::hashed_string::value(name.data(), name.size())), symbols.size()) << name;
+    }
+    EXPECT_EQ(find_symbol(entt::hashed_string::value("not_a_symbol")), symbols.size());
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "endstone/core/form/form_codec.h"
+#include "endstone/core/form/form_template.h"
+#include "endstone/form/action_form.h"
+
+using endstone::ActionForm;
+using endstone::core::EndstoneFormTemplate;
+namespace FormCodec = endstone::core::FormCodec;
+
+namespace {
+nlohmann::json rawtext(const std::string &text)
+{
+    return {{"rawtext", {{{"text", text}}}}};
+}
+
+ActionForm makeMenu(int buttons)
+{
+    ActionForm form;
+    form.setTitle("§l{server} selector").setContent("Welcome back, {player}! You have {coins} coins.");
+    for (int i = 0; i < buttons; ++i) {
+        form.addButton("Server #" + std::to_string(i) + "\n§7Click to join",
+                       i % 2 == 0 ? "textures/ui/world_glyph" : "https://example.com/icon.png");
+    }
+    return form;
+}
+}  // namespace
+
+// A 50-button action form, built as a JSON document and dumped, written directly, and rendered from a template with
+// per-player values
+TEST(FormTemplateBenchmark, ActionForm)
+{
+    constexpr int iterations = 2000;
+    const auto form = makeMenu(50);
+    using std::chrono::steady_clock;
+
+    std::size_t bytes = 0;
+    auto start = steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        nlohmann::json json;
+        json["type"] = "form";
+        json["title"] = rawtext(std::get<std::string>(form.getTitle()));
+        json["content"] = rawtext(std::get<std::string>(form.getContent()));
+        json["buttons"] = nlohmann::json::array();
+        for (const auto &button : form.getButtons()) {
+            nlohmann::json b;
+            b["text"] = rawtext(std::get<std::string>(button.getText()));
+            b["image"]["type"] = "path";
+            b["image"]["data"] = button.getIcon().value();
+            json["buttons"].push_back(b);
+        }
+        bytes += json.dump().size();
+    }
+    const auto dom = steady_clock::now() - start;
+
+    start = steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        bytes += FormCodec::toJson(form).size();
+    }
+    const auto direct = steady_clock::now() - start;
+
+    const EndstoneFormTemplate form_template(form);
+    start = steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        // a different player every time, so that nothing comes from the cache
+        bytes += form_template.render({{"server", "Lobby"}, {"player", std::to_string(i)}, {"coins", "100"}}).size();
+    }
+    const auto rendered = steady_clock::now() - start;
+
+    start = steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        bytes += form_template.render({{"server", "Lobby"}, {"player", "Steve"}, {"coins", "100"}}).size();
+    }
+    const auto cached = steady_clock::now() - start;
+
+    EXPECT_GT(bytes, 0);
+    const auto us = [](auto duration) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / iterations / 1000.0;
+    };
+    std::cout << "dom: " << us(dom) << " us/form, direct: " << us(direct) << " us/form, template: " << us(rendered)
+              << " us/form, cached: " << us(cached) << " us/form\n";
+}
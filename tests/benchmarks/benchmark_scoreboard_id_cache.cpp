@@ -0,0 +1,82 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "bedrock/world/scores/objective.h"
+#include "endstone/core/scoreboard/objective.h"
+#include "endstone/core/scoreboard/scoreboard_id_cache.h"
+
+using endstone::core::ObjectiveHandle;
+using endstone::core::ScoreboardIdCache;
+
+// 1M score reads of 1000 fake players, looking up the objective and the identity by name every time, against checking
+// the objective handle and using the cached ids
+TEST(ScoreboardIdCacheBenchmark, ScoreReads)
+{
+    constexpr int entries = 1000;
+    constexpr int reads = 1000000;
+
+    const ObjectiveCriteria criteria{};
+    std::unordered_map<std::string, std::unique_ptr<Objective>> objectives;
+    auto &objective = *(objectives["kills"] = std::make_unique<Objective>("kills", criteria));
+    const auto handle = std::make_shared<ObjectiveHandle>(objective);
+
+    std::unordered_map<std::string, ScoreboardId> identities;
+    std::vector<std::string> names;
+    for (int i = 0; i < entries; ++i) {
+        names.push_back("player" + std::to_string(i));
+        identities.emplace(names.back(), ScoreboardId{i});
+    }
+    std::vector<ScoreboardIdCache> caches(entries);
+
+    std::int64_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < reads; ++i) {
+        const auto &name = names[i % entries];
+        auto it = objectives.find("kills");
+        ASSERT_NE(it, objectives.end());
+        const auto &id = identities.find(name)->second;
+        found += it->second->getScores().contains(id) ? 1 : id.raw_id;
+    }
+    const auto uncached = std::chrono::steady_clock::now() - start;
+
+    int resolved = 0;
+    std::int64_t found_cached = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < reads; ++i) {
+        auto &cache = caches[i % entries];
+        ASSERT_TRUE(handle->ref.isValid());
+        const auto &id = cache.get(0, [&]() -> const ScoreboardId & {
+            ++resolved;
+            return identities.find(names[i % entries])->second;
+        });
+        found_cached += handle->objective->getScores().contains(id) ? 1 : id.raw_id;
+    }
+    const auto cached = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(found, found_cached);
+    EXPECT_EQ(resolved, entries);  // each entry is looked up by name only once
+    std::cout << "uncached: " << std::chrono::duration_cast<std::chrono::nanoseconds>(uncached).count() / reads
+              << " ns/read, cached: " << std::chrono::duration_cast<std::chrono::nanoseconds>(cached).count() / reads
+              << " ns/read\n";
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/base64.h"
+#include "endstone/core/skin_cache.h"
+
+using endstone::Skin;
+using endstone::core::base64_decode;
+using endstone::core::base64_encode;
+using endstone::core::SkinCache;
+
+namespace {
+std::string makeImage(int height, int width, int seed)
+{
+    std::string image(static_cast<std::size_t>(height) * width * 4, '\0');
+    for (std::size_t i = 0; i < image.size(); ++i) {
+        image[i] = static_cast<char>((i * 31 + seed * 7) & 0xff);
+    }
+    return image;
+}
+}  // namespace
+
+// 200 players joining with 10 distinct skins, decoding every skin on join and sharing them through the cache, and the
+// memory held by the skins in each case
+TEST(SkinCacheBenchmark, Join)
+{
+    constexpr int players = 200;
+    constexpr int distinct = 10;
+    std::vector<std::string> skins;
+    for (int i = 0; i < distinct; ++i) {
+        skins.push_back(base64_encode(makeImage(128, 128, i)));
+    }
+    const auto cape = base64_encode(makeImage(32, 64, 0));
+    using std::chrono::steady_clock;
+
+    std::vector<Skin> eager;
+    std::size_t eager_bytes = 0;
+    auto start = steady_clock::now();
+    for (int i = 0; i < players; ++i) {
+        auto skin_data = base64_decode(skins[i % distinct]).value_or("");
+        auto cape_data = base64_decode(cape).value_or("");
+        eager_bytes += skin_data.size() + cape_data.size();
+        eager.emplace_back("skin", Skin::ImageData{128, 128, std::move(skin_data)}, "cape",
+                           Skin::ImageData{32, 64, std::move(cape_data)});
+    }
+    const auto eager_time = steady_clock::now() - start;
+
+    SkinCache cache;
+    std::vector<std::shared_ptr<const SkinCache::Entry>> shared;
+    start = steady_clock::now();
+    for (int i = 0; i < players; ++i) {
+        // the connection request is copied once, as Json::Value::get returns a copy
+        const auto skin_data = skins[i % distinct];
+        shared.push_back(cache.get("skin", {128, 128, skin_data}, "cape", {32, 64, cape}));
+    }
+    const auto lazy_time = steady_clock::now() - start;
+
+    const auto usage = cache.getUsage();
+    EXPECT_EQ(usage.skins, distinct);
+    EXPECT_EQ(usage.players, players);
+    std::cout << "eager: " << std::chrono::duration_cast<std::chrono::microseconds>(eager_time).count() / players
+              << " us/join, " << eager_bytes / 1024 << " KiB; cached: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(lazy_time).count() / players << " us/join, "
+              << usage.bytes / 1024 << " KiB\n";
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/lang/translation_cache.h"
+
+using endstone::core::TranslationCache;
+
+namespace {
+std::string format(const std::string &pattern, const std::vector<std::string> &params)
+{
+    std::string result;
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < pattern.size(); ++i) {
+        if (pattern[i] == '%' && i + 1 < pattern.size()) {
+            const auto c = pattern[i + 1];
+            if (c == 's' && next < params.size()) {
+                result += params[next++];
+                ++i;
+                continue;
+            }
+            if (c >= '1' && c <= '9' && static_cast<std::size_t>(c - '1') < params.size()) {
+                result += params[c - '1'];
+                ++i;
+                continue;
+            }
+        }
+        result += pattern[i];
+    }
+    return result;
+}
+}  // namespace
+
+// A broadcast of the same message to 200 players in 10 locales: translated for every player, through the cache for
+// every player, and once per locale as EndstoneServer::sendMessage does
+TEST(TranslationCacheBenchmark, Broadcast)
+{
+    constexpr int broadcasts = 2000;
+    constexpr int players = 200;
+    const std::vector<std::string> locales{"en_US", "de_DE", "fr_FR", "es_ES", "pt_BR",
+                                           "ja_JP", "zh_CN", "ru_RU", "ko_KR", "it_IT"};
+    const std::vector<std::string> params{"Steve", "Zombie", "Diamond Sword"};
+
+    // stands in for the language files, with a few thousand keys per locale
+    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> languages;
+    for (const auto &locale : locales) {
+        auto &strings = languages[locale];
+        for (int i = 0; i < 4000; ++i) {
+            strings.emplace("key." + std::to_string(i), "value");
+        }
+        strings.emplace("death.attack.player.item", "[" + locale + "] %1 was slain by %2 using %3");
+    }
+    const auto translate = [&](const std::string &locale) {
+        return format(languages.at(locale).at("death.attack.player.item"), params);
+    };
+    using std::chrono::steady_clock;
+
+    std::size_t bytes = 0;
+    auto start = steady_clock::now();
+    for (int i = 0; i < broadcasts; ++i) {
+        for (int p = 0; p < players; ++p) {
+            bytes += translate(locales[p % locales.size()]).size();
+        }
+    }
+    const auto uncached = steady_clock::now() - start;
+
+    TranslationCache cache;
+    start = steady_clock::now();
+    for (int i = 0; i < broadcasts; ++i) {
+        for (int p = 0; p < players; ++p) {
+            const auto &locale = locales[p % locales.size()];
+            bytes += cache.get(locale, "death.attack.player.item", params, [&] { return translate(locale); }).size();
+        }
+    }
+    const auto cached = steady_clock::now() - start;
+
+    start = steady_clock::now();
+    for (int i = 0; i < broadcasts; ++i) {
+        std::vector<std::pair<std::string, std::string>> rendered;
+        for (int p = 0; p < players; ++p) {
+            const auto &locale = locales[p % locales.size()];
+            auto it = std::ranges::find(rendered, locale, &std::pair<std::string, std::string>::first);
+            if (it == rendered.end()) {
+                it = rendered.emplace(rendered.end(), locale, translate(locale));
+            }
+            bytes += it->second.size();
+        }
+    }
+    const auto per_locale = steady_clock::now() - start;
+
+    EXPECT_GT(bytes, 0);
+    const auto ns = [](auto duration) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / (broadcasts * players);
+    };
+    std::cout << "uncached: " << ns(uncached) << " ns/player, cached: " << ns(cached)
+              << " ns/player, per locale: " << ns(per_locale) << " ns/player\n";
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/level/actor_snapshot.h"
+
+using endstone::ActorSnapshot;
+
+class ActorSnapshotTest : public ::testing::Test {
+protected:
+    static void fill(ActorSnapshot &snapshot, int count)
+    {
+        for (int i = 0; i < count; i++) {
+            const auto f = static_cast<float>(i);
+            snapshot.add(i, {f, f + 1, f + 2}, {-f, -f, -f}, {f, 2 * f}, i % 3, ActorSnapshot::OnGround);
+        }
+    }
+};
+
+TEST_F(ActorSnapshotTest, CapturesAllFields)
+{
+    ActorSnapshot snapshot;
+    snapshot.reset(ActorSnapshot::AllFields);
+    fill(snapshot, 4);
+
+    EXPECT_EQ(snapshot.size(), 4);
+    EXPECT_EQ(snapshot.getRuntimeIds().size(), 4);
+    EXPECT_EQ(snapshot.getPositions().size(), 12);
+    EXPECT_EQ(snapshot.getVelocities().size(), 12);
+    EXPECT_EQ(snapshot.getRotations().size(), 8);
+    EXPECT_EQ(snapshot.getDimensionIds().size(), 4);
+    EXPECT_EQ(snapshot.getFlags().size(), 4);
+
+    EXPECT_EQ(snapshot.getRuntimeIds()[2], 2);
+    EXPECT_EQ(snapshot.getPositions()[3 * 2 + 1], 3.0F);
+    EXPECT_EQ(snapshot.getRotations()[2 * 3 + 1], 6.0F);
+    EXPECT_EQ(snapshot.getDimensionIds()[3], 0);
+}
+
+TEST_F(ActorSnapshotTest, SkipsUnrequestedFields)
+{
+    ActorSnapshot snapshot;
+    snapshot.reset(ActorSnapshot::Positions | ActorSnapshot::Flags);
+    fill(snapshot, 3);
+
+    EXPECT_TRUE(snapshot.has(ActorSnapshot::Positions));
+    EXPECT_FALSE(snapshot.has(ActorSnapshot::Velocities));
+    EXPECT_EQ(snapshot.size(), 3);
+    EXPECT_EQ(snapshot.getPositions().size(), 9);
+    EXPECT_EQ(snapshot.getFlags().size(), 3);
+    EXPECT_TRUE(snapshot.getRuntimeIds().empty());
+    EXPECT_TRUE(snapshot.getVelocities().empty());
+}
+
+TEST_F(ActorSnapshotTest, ResetKeepsCapacity)
+{
+    ActorSnapshot snapshot;
+    snapshot.reset(ActorSnapshot::AllFields);
+    snapshot.reserve(64);
+    fill(snapshot, 64);
+    const auto *data = snapshot.getPositions().data();
+
+    snapshot.reset(ActorSnapshot::AllFields);
+    EXPECT_EQ(snapshot.size(), 0);
+    fill(snapshot, 32);
+    EXPECT_EQ(snapshot.getPositions().data(), data);
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "endstone/level/chunk_snapshot.h"
+
+using endstone::BlockData;
+using endstone::BlockStates;
+using endstone::ChunkSnapshot;
+
+namespace {
+class TestBlockData : public BlockData {
+public:
+    explicit TestBlockData(std::string type) : type_(std::move(type)) {}
+
+    [[nodiscard]] std::string getType() const override
+    {
+        return type_;
+    }
+
+    [[nodiscard]] BlockStates getBlockStates() const override
+    {
+        return {};
+    }
+
+private:
+    std::string type_;
+};
+}  // namespace
+
+class ChunkSnapshotTest : public ::testing::Test {
+protected:
+    static constexpr int MinHeight = -4;
+    static constexpr int MaxHeight = 4;
+
+    // Fills the bottom layer with stone, and puts a single block of ore at (3, 1, 5).
+    static ChunkSnapshot create()
+    {
+        std::vector<std::shared_ptr<BlockData>> palette{std::make_shared<TestBlockData>("minecraft:air"),
+                                                        std::make_shared<TestBlockData>("minecraft:stone"),
+                                                        std::make_shared<TestBlockData>("minecraft:diamond_ore")};
+        constexpr auto width = ChunkSnapshot::Width;
+        std::vector<std::uint16_t> blocks((MaxHeight - MinHeight) * width * width, 0);
+        std::vector<std::int16_t> heightmap(width * width, MinHeight);
+        std::fill_n(blocks.begin(), width * width, 1);
+        blocks[((1 - MinHeight) * width + 5) * width + 3] = 2;
+        heightmap[5 * width + 3] = 1;
+        return {2, -3, MinHeight, MaxHeight, std::move(palette), std::move(blocks), std::move(heightmap)};
+    }
+};
+
+TEST_F(ChunkSnapshotTest, IndexesBlocksByRelativeCoordinates)
+{
+    const auto snapshot = create();
+
+    EXPECT_EQ(snapshot.getX(), 2);
+    EXPECT_EQ(snapshot.getZ(), -3);
+    EXPECT_EQ(snapshot.getPaletteIndex(0, MinHeight, 0), 1);
+    EXPECT_EQ(snapshot.getPaletteIndex(15, MinHeight, 15), 1);
+    EXPECT_EQ(snapshot.getPaletteIndex(0, MinHeight + 1, 0), 0);
+    EXPECT_EQ(snapshot.getBlockData(3, 1, 5)->getType(), "minecraft:diamond_ore");
+    EXPECT_EQ(snapshot.getBlockData(5, 1, 3)->getType(), "minecraft:air");
+}
+
+TEST_F(ChunkSnapshotTest, ReadsHeightmap)
+{
+    const auto snapshot = create();
+
+    EXPECT_EQ(snapshot.getHighestBlockYAt(3, 5), 1);
+    EXPECT_EQ(snapshot.getHighestBlockYAt(0, 0), MinHeight);
+}
+
+TEST_F(ChunkSnapshotTest, ChecksBounds)
+{
+    const auto snapshot = create();
+
+    EXPECT_TRUE(snapshot.contains(0, MinHeight, 15));
+    EXPECT_FALSE(snapshot.contains(16, 0, 0));
+    EXPECT_FALSE(snapshot.contains(0, MaxHeight, 0));
+    EXPECT_FALSE(snapshot.contains(0, MinHeight - 1, 0));
+}
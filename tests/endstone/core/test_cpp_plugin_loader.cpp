@@ -61,6 +61,8 @@ public:
     MOCK_METHOD(float, getCurrentTickUsage, (), (override));
     MOCK_METHOD(float, getAverageTickUsage, (), (override));
     MOCK_METHOD(std::chrono::system_clock::time_point, getStartTime, (), (override));
+    MOCK_METHOD(endstone::ViewDistanceHintSettings, getViewDistanceHintSettings, (), (const, override));
+    MOCK_METHOD(endstone::Result<void>, setViewDistanceHintSettings, (endstone::ViewDistanceHintSettings), (override));
     MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
                 (std::string, endstone::BarColor, endstone::BarStyle), (const, override));
     MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
@@ -72,6 +74,8 @@ public:
                 (std::string, endstone::BlockStates), (const, override));
     MOCK_METHOD(endstone::PlayerBanList &, getBanList, (), (const, override));
     MOCK_METHOD(endstone::IpBanList &, getIpBanList, (), (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::FormTemplate>, createFormTemplate, (endstone::FormTemplate::FormVariant),
+                (const, override));
 
     MockServer()
     {
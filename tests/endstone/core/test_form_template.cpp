@@ -0,0 +1,119 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "endstone/core/form/form_codec.h"
+#include "endstone/core/form/form_template.h"
+#include "endstone/form/action_form.h"
+#include "endstone/form/controls/slider.h"
+#include "endstone/form/controls/toggle.h"
+#include "endstone/form/message_form.h"
+#include "endstone/form/modal_form.h"
+
+using endstone::ActionForm;
+using endstone::MessageForm;
+using endstone::ModalForm;
+using endstone::Slider;
+using endstone::Toggle;
+using endstone::Translatable;
+using endstone::core::EndstoneFormTemplate;
+namespace FormCodec = endstone::core::FormCodec;
+
+namespace {
+nlohmann::json rawtext(const std::string &text)
+{
+    return {{"rawtext", {{{"text", text}}}}};
+}
+
+ActionForm makeMenu(int buttons)
+{
+    ActionForm form;
+    form.setTitle("§l{server} selector").setContent("Welcome back, {player}! You have {coins} coins.");
+    for (int i = 0; i < buttons; ++i) {
+        form.addButton("Server #" + std::to_string(i) + "\n§7Click to join",
+                       i % 2 == 0 ? "textures/ui/world_glyph" : "https://example.com/icon.png");
+    }
+    return form;
+}
+}  // namespace
+
+TEST(FormCodecTest, ActionForm)
+{
+    ActionForm form;
+    form.setTitle("Say \"hi\"\n").setContent(Translatable{"menu.content", {"a", "b"}});
+    form.addButton("Plain").addButton("Url", "https://example.com/a.png").addButton("Path", "textures/a");
+
+    const auto json = nlohmann::json::parse(FormCodec::toJson(form));
+    EXPECT_EQ(json["type"], "form");
+    EXPECT_EQ(json["title"], rawtext("Say \"hi\"\n"));
+    EXPECT_EQ(json["content"]["rawtext"][0]["translate"], "menu.content");
+    EXPECT_EQ(json["content"]["rawtext"][0]["with"], nlohmann::json({"a", "b"}));
+    ASSERT_EQ(json["buttons"].size(), 3);
+    EXPECT_FALSE(json["buttons"][0].contains("image"));
+    EXPECT_EQ(json["buttons"][1]["image"], nlohmann::json({{"type", "url"}, {"data", "https://example.com/a.png"}}));
+    EXPECT_EQ(json["buttons"][2]["image"], nlohmann::json({{"type", "path"}, {"data", "textures/a"}}));
+}
+
+TEST(FormCodecTest, ModalForm)
+{
+    ModalForm form;
+    form.setTitle("Settings").addControl(Slider("Volume", 0.0F, 10.0F, 0.5F, 5.0F)).addControl(Toggle("Music", true));
+    form.setSubmitButton(std::optional<endstone::Message>("Save"));
+
+    const auto text = FormCodec::toJson(form);
+    const auto json = nlohmann::json::parse(text);
+    EXPECT_EQ(json["type"], "custom_form");
+    EXPECT_EQ(json["content"][0]["type"], "slider");
+    EXPECT_EQ(json["content"][0]["step"], 0.5);
+    EXPECT_EQ(json["content"][1]["default"], true);
+    EXPECT_EQ(json["submit"], rawtext("Save"));
+    EXPECT_NE(text.find(R"("max":10.0)"), std::string::npos);  // still read as a float by the client
+}
+
+TEST(FormTemplateTest, Placeholders)
+{
+    const EndstoneFormTemplate form_template(makeMenu(2));
+    EXPECT_EQ(form_template.getPlaceholders(), (std::vector<std::string>{"server", "player", "coins"}));
+
+    const auto json = nlohmann::json::parse(form_template.render({{"server", "Lobby"}, {"player", "Steve \"the\" 2nd"}}));
+    EXPECT_EQ(json["title"], rawtext("§lLobby selector"));
+    EXPECT_EQ(json["content"], rawtext("Welcome back, Steve \"the\" 2nd! You have {coins} coins."));
+    EXPECT_EQ(json["buttons"].size(), 2);
+}
+
+TEST(FormTemplateTest, NoPlaceholders)
+{
+    MessageForm form;
+    form.setTitle("Title").setContent("{}").setButton1("Yes").setButton2("No");
+    const EndstoneFormTemplate form_template(form);
+    EXPECT_TRUE(form_template.getPlaceholders().empty());
+    EXPECT_EQ(form_template.render({{"unused", "value"}}), FormCodec::toJson(form));
+}
+
+TEST(FormTemplateTest, RendersAreCachedByValue)
+{
+    const EndstoneFormTemplate form_template(makeMenu(2));
+    const auto a = form_template.render({{"server", "Lobby"}, {"player", "Alex"}, {"coins", "10"}});
+    const auto b = form_template.render({{"server", "Lobby"}, {"player", "Steve"}, {"coins", "10"}});
+    EXPECT_NE(a, b);
+    EXPECT_EQ(form_template.render({{"server", "Lobby"}, {"player", "Alex"}, {"coins", "10"}}), a);
+    // an empty value is not the same as a missing one
+    EXPECT_NE(form_template.render({{"server", ""}}), form_template.render({}));
+}
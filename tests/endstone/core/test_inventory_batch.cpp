@@ -0,0 +1,73 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/inventory/inventory_batch.h"
+
+using endstone::core::InventoryBatch;
+
+TEST(InventoryBatchTest, SendsRightAwayOutsideBatch)
+{
+    int sent = 0;
+    InventoryBatch batch{[&] { ++sent; }};
+    batch.markDirty();
+    batch.markDirty();
+    EXPECT_EQ(sent, 2);
+}
+
+TEST(InventoryBatchTest, SendsOnceWhenNested)
+{
+    int sent = 0;
+    InventoryBatch batch{[&] { ++sent; }};
+    batch.run([&] {
+        batch.markDirty();
+        batch.run([&] {
+            batch.markDirty();
+            batch.markDirty();
+        });
+        EXPECT_EQ(sent, 0);
+        batch.markDirty();
+    });
+    EXPECT_EQ(sent, 1);
+}
+
+TEST(InventoryBatchTest, SendsNothingWithoutChanges)
+{
+    int sent = 0;
+    InventoryBatch batch{[&] { ++sent; }};
+    batch.run([&] { batch.run([] {}); });
+    EXPECT_EQ(sent, 0);
+}
+
+TEST(InventoryBatchTest, SendsOnceWhenCallbackThrows)
+{
+    int sent = 0;
+    InventoryBatch batch{[&] { ++sent; }};
+    EXPECT_THROW(batch.run([&] {
+        batch.run([&] {
+            batch.markDirty();
+            throw std::runtime_error("oops");
+        });
+    }),
+                 std::runtime_error);
+    EXPECT_EQ(sent, 1);
+
+    // the batch is no longer running afterwards
+    batch.markDirty();
+    EXPECT_EQ(sent, 2);
+}
@@ -0,0 +1,213 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/inventory/inventory_contents.h"
+
+using endstone::ItemStackView;
+using endstone::core::replace_contents;
+
+namespace {
+struct FakeStack {
+    std::string type;
+    int count = 0;
+    std::string name;  // stands for the data that is not part of a view, e.g. enchantments
+};
+
+struct FakeSlots {
+    using Stack = FakeStack;
+
+    std::vector<FakeStack> stacks;
+    std::vector<int> writes;
+
+    [[nodiscard]] int size() const
+    {
+        return static_cast<int>(stacks.size());
+    }
+
+    [[nodiscard]] const FakeStack &get(int slot) const
+    {
+        return stacks[slot];
+    }
+
+    void set(int slot, const FakeStack &stack)
+    {
+        writes.push_back(slot);
+        stacks[slot] = stack;
+    }
+
+    [[nodiscard]] static bool isNull(const FakeStack &stack)
+    {
+        return stack.count == 0;
+    }
+
+    [[nodiscard]] static std::string_view getType(const FakeStack &stack)
+    {
+        return stack.type;
+    }
+
+    [[nodiscard]] static int getCount(const FakeStack &stack)
+    {
+        return stack.count;
+    }
+
+    [[nodiscard]] static int getMaxStackSize(const FakeStack &stack)
+    {
+        return stack.type == "minecraft:diamond_sword" ? 1 : 64;
+    }
+
+    [[nodiscard]] static FakeStack copy(const FakeStack &stack, int amount)
+    {
+        auto copy = stack;
+        copy.count = amount;
+        return copy;
+    }
+
+    [[nodiscard]] static std::optional<FakeStack> create(std::string_view type, int amount)
+    {
+        if (type == "minecraft:unknown") {
+            return std::nullopt;
+        }
+        return FakeStack{std::string(type), amount};
+    }
+
+    [[nodiscard]] std::vector<ItemStackView> views() const
+    {
+        std::vector<ItemStackView> views(stacks.size());
+        for (int i = 0; i < size(); ++i) {
+            if (!isNull(stacks[i])) {
+                views[i] = {stacks[i].type, stacks[i].count, i};
+            }
+        }
+        return views;
+    }
+};
+
+FakeSlots makeSlots()
+{
+    return FakeSlots{{{"minecraft:diamond", 3, "Shiny"}, {"minecraft:stone", 64, ""}, {}, {"minecraft:apple", 1, ""}}};
+}
+}  // namespace
+
+TEST(InventoryContentsTest, SkipsUnchangedSlots)
+{
+    auto slots = makeSlots();
+    auto views = slots.views();
+    ASSERT_TRUE(replace_contents(slots, views));
+    EXPECT_TRUE(slots.writes.empty());
+
+    views[1].amount = 32;
+    ASSERT_TRUE(replace_contents(slots, views));
+    EXPECT_EQ(slots.writes, std::vector<int>{1});
+    EXPECT_EQ(slots.stacks[1].count, 32);
+}
+
+TEST(InventoryContentsTest, BuildsAllStacksBeforeWriting)
+{
+    auto slots = makeSlots();
+    auto views = slots.views();
+    std::swap(views[0], views[1]);
+    ASSERT_TRUE(replace_contents(slots, views));
+
+    // slot 1 was built from slot 0 before slot 0 was overwritten by slot 1
+    EXPECT_EQ(slots.stacks[0].type, "minecraft:stone");
+    EXPECT_EQ(slots.stacks[0].count, 64);
+    EXPECT_EQ(slots.stacks[1].type, "minecraft:diamond");
+    EXPECT_EQ(slots.stacks[1].count, 3);
+    EXPECT_EQ(slots.stacks[1].name, "Shiny");
+}
+
+TEST(InventoryContentsTest, WritesNothingOnError)
+{
+    auto slots = makeSlots();
+    auto views = slots.views();
+    views[0] = {"minecraft:stick", 1};
+    views[3] = {"minecraft:unknown", 1};
+
+    const auto result = replace_contents(slots, views);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().getMessage(), "Unknown item type: minecraft:unknown");
+    EXPECT_TRUE(slots.writes.empty());
+    EXPECT_EQ(slots.stacks[0].type, "minecraft:diamond");
+}
+
+TEST(InventoryContentsTest, KeepsDataWhenSourceSlotHoldsSameType)
+{
+    auto slots = makeSlots();
+    std::vector<ItemStackView> views(4);
+    views[2] = {"minecraft:diamond", 2, 0};
+    ASSERT_TRUE(replace_contents(slots, views));
+    EXPECT_EQ(slots.stacks[2].count, 2);
+    EXPECT_EQ(slots.stacks[2].name, "Shiny");
+
+    // the source slot no longer holds the same type, a new stack is built
+    views.assign(4, {});
+    views[1] = {"minecraft:diamond", 2, 0};
+    ASSERT_TRUE(replace_contents(slots, views));
+    EXPECT_EQ(slots.stacks[1].type, "minecraft:diamond");
+    EXPECT_EQ(slots.stacks[1].count, 2);
+    EXPECT_TRUE(slots.stacks[1].name.empty());
+}
+
+TEST(InventoryContentsTest, ClearsSlotsMissingFromShorterSpans)
+{
+    auto slots = makeSlots();
+    const std::vector<ItemStackView> views{{"minecraft:diamond", 3, 0}};
+    ASSERT_TRUE(replace_contents(slots, views));
+    EXPECT_EQ(slots.writes, (std::vector<int>{1, 3}));
+    EXPECT_EQ(slots.stacks[0].name, "Shiny");
+    EXPECT_TRUE(FakeSlots::isNull(slots.stacks[1]));
+    EXPECT_TRUE(FakeSlots::isNull(slots.stacks[3]));
+}
+
+TEST(InventoryContentsTest, RejectsOversizeSpans)
+{
+    auto slots = makeSlots();
+    const std::vector<ItemStackView> views(5, {"minecraft:stick", 1});
+    const auto result = replace_contents(slots, views);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().getMessage(), "Invalid inventory contents size (5). Expected 4 or less.");
+    EXPECT_TRUE(slots.writes.empty());
+}
+
+TEST(InventoryContentsTest, RejectsAmountsAboveMaxStackSize)
+{
+    auto slots = makeSlots();
+    auto views = slots.views();
+    views[0].amount = 65;
+    auto result = replace_contents(slots, views);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().getMessage(), "Invalid amount (65) of minecraft:diamond in slot 0. Expected 64 or less.");
+
+    views = slots.views();
+    views[2] = {"minecraft:diamond_sword", 2};
+    result = replace_contents(slots, views);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().getMessage(),
+              "Invalid amount (2) of minecraft:diamond_sword in slot 2. Expected 1 or less.");
+
+    // amounts that do not fit into a stack are not wrapped around
+    views = slots.views();
+    views[1].amount = 256 + 64;
+    EXPECT_FALSE(replace_contents(slots, views));
+    EXPECT_TRUE(slots.writes.empty());
+}
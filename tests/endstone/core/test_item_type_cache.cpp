@@ -0,0 +1,115 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/inventory/item_type_cache.h"
+#include "endstone/inventory/item_stack_view.h"
+
+using endstone::ItemStackView;
+using endstone::core::ItemTypeCache;
+
+namespace {
+struct CountingResolver {
+    int *calls;
+    WeakPtr<Item> operator()(int &aux, std::string_view name) const
+    {
+        ++*calls;
+        aux = static_cast<int>(name.size());
+        return WeakPtr<Item>{};  // not in the registry
+    }
+};
+}  // namespace
+
+TEST(ItemTypeCacheTest, ResolvesEachNameOnce)
+{
+    ItemTypeCache cache;
+    int calls = 0;
+    for (int i = 0; i < 10; ++i) {
+        const auto entry = cache.get("minecraft:not_an_item", CountingResolver{&calls});
+        EXPECT_FALSE(entry.found);
+        EXPECT_TRUE(entry.item.isNull());
+        EXPECT_EQ(entry.aux, 21);
+    }
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(cache.size(), 1U);
+
+    (void)cache.get("minecraft:also_not_an_item", CountingResolver{&calls});
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(cache.size(), 2U);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0U);
+    (void)cache.get("minecraft:not_an_item", CountingResolver{&calls});
+    EXPECT_EQ(calls, 3);
+}
+
+TEST(ItemTypeCacheTest, LookupIsHeterogeneous)
+{
+    ItemTypeCache cache;
+    int calls = 0;
+    const std::string name = "minecraft:diamond_sword";
+    (void)cache.get(name, CountingResolver{&calls});
+    (void)cache.get(std::string_view(name).substr(0), CountingResolver{&calls});
+    (void)cache.get(std::string(name), CountingResolver{&calls});
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ItemTypeCacheTest, StaysBounded)
+{
+    ItemTypeCache cache;
+    int calls = 0;
+    for (std::size_t i = 0; i < ItemTypeCache::MaxSize + 10; ++i) {
+        (void)cache.get("minecraft:item_" + std::to_string(i), CountingResolver{&calls});
+    }
+    EXPECT_LE(cache.size(), ItemTypeCache::MaxSize);
+    EXPECT_GT(cache.size(), 0U);
+}
+
+TEST(ItemTypeCacheTest, ConcurrentLookups)
+{
+    ItemTypeCache cache;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache] {
+            for (int i = 0; i < 10000; ++i) {
+                const auto entry = cache.get("minecraft:item_" + std::to_string(i % 64), [](int &aux, std::string_view) {
+                    aux = 7;
+                    return WeakPtr<Item>{};
+                });
+                ASSERT_EQ(entry.aux, 7);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(cache.size(), 64U);
+}
+
+TEST(ItemStackViewTest, IsEmpty)
+{
+    EXPECT_TRUE(ItemStackView{}.isEmpty());
+    EXPECT_TRUE((ItemStackView{"minecraft:stone", 0}.isEmpty()));
+    EXPECT_TRUE((ItemStackView{"minecraft:air", 5}.isEmpty()));
+    EXPECT_TRUE((ItemStackView{"", 5}.isEmpty()));
+    EXPECT_FALSE((ItemStackView{"minecraft:stone", 64}.isEmpty()));
+    EXPECT_EQ(ItemStackView{}.slot, -1);
+}
@@ -0,0 +1,102 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/movement_tracker.h"
+
+using endstone::Location;
+using endstone::PlayerMoveThreshold;
+using endstone::core::MovementTracker;
+
+TEST(MovementTrackerTest, AnyMovement)
+{
+    const PlayerMoveThreshold threshold{};
+    const Location from{nullptr, 0.5F, 64.0F, 0.5F};
+    EXPECT_FALSE(MovementTracker::isCrossed(threshold, from, from));
+    EXPECT_TRUE(MovementTracker::isCrossed(threshold, from, {nullptr, 0.51F, 64.0F, 0.5F}));
+    EXPECT_TRUE(MovementTracker::isCrossed(threshold, from, {nullptr, 0.5F, 64.0F, 0.5F, 0.0F, 1.0F}));
+}
+
+TEST(MovementTrackerTest, Distance)
+{
+    const PlayerMoveThreshold threshold{2.0};
+    const Location from{nullptr, 0.0F, 64.0F, 0.0F};
+    EXPECT_FALSE(MovementTracker::isCrossed(threshold, from, {nullptr, 1.0F, 64.0F, 1.0F}));
+    EXPECT_TRUE(MovementTracker::isCrossed(threshold, from, {nullptr, 2.0F, 64.0F, 0.0F}));
+    // looking around does not count when only a distance is declared
+    EXPECT_FALSE(MovementTracker::isCrossed(threshold, from, {nullptr, 0.0F, 64.0F, 0.0F, 45.0F, 90.0F}));
+}
+
+TEST(MovementTrackerTest, Rotation)
+{
+    const PlayerMoveThreshold threshold{0.0, 10.0F};
+    const Location from{nullptr, 0.0F, 64.0F, 0.0F, 0.0F, 175.0F};
+    EXPECT_FALSE(MovementTracker::isCrossed(threshold, from, {nullptr, 0.0F, 64.0F, 0.0F, 5.0F, -178.0F}));
+    EXPECT_TRUE(MovementTracker::isCrossed(threshold, from, {nullptr, 0.0F, 64.0F, 0.0F, 5.0F, -170.0F}));
+    EXPECT_TRUE(MovementTracker::isCrossed(threshold, from, {nullptr, 0.0F, 64.0F, 0.0F, -10.0F, 175.0F}));
+}
+
+TEST(MovementTrackerTest, BlockAndChunk)
+{
+    const PlayerMoveThreshold block{0.0, 0.0F, true};
+    const PlayerMoveThreshold chunk{0.0, 0.0F, false, true};
+    const Location from{nullptr, 14.9F, 64.0F, 0.5F};
+    const Location same_block{nullptr, 14.1F, 64.5F, 0.9F};
+    const Location next_block{nullptr, 15.1F, 64.0F, 0.5F};
+    const Location next_chunk{nullptr, 16.1F, 64.0F, 0.5F};
+    EXPECT_FALSE(MovementTracker::isCrossed(block, from, same_block));
+    EXPECT_TRUE(MovementTracker::isCrossed(block, from, next_block));
+    EXPECT_FALSE(MovementTracker::isCrossed(chunk, from, next_block));
+    EXPECT_TRUE(MovementTracker::isCrossed(chunk, from, next_chunk));
+    // negative coordinates belong to the chunk below zero
+    EXPECT_TRUE(MovementTracker::isCrossed(chunk, {nullptr, 0.5F, 64.0F, 0.5F}, {nullptr, -0.5F, 64.0F, 0.5F}));
+}
+
+// Simulate 200 players walking around for a minute, against listeners with different thresholds
+TEST(MovementTrackerTest, CoarseThresholdsFireLess)
+{
+    constexpr int players = 200;
+    constexpr int ticks = 1200;
+
+    const std::vector<PlayerMoveThreshold> thresholds{{}, {0.0, 0.0F, true}, {0.0, 0.0F, false, true}, {5.0}};
+    std::vector<std::vector<Location>> baselines(thresholds.size(),
+                                                 std::vector<Location>(players, {nullptr, 0.0F, 64.0F, 0.0F}));
+    std::vector<Location> positions(players, {nullptr, 0.0F, 64.0F, 0.0F});
+    std::vector<int> events(thresholds.size(), 0);
+
+    std::mt19937 random{42};
+    std::uniform_real_distribution<float> direction{-0.2F, 0.2F};
+    for (int tick = 0; tick < ticks; ++tick) {
+        for (int i = 0; i < players; ++i) {
+            auto &to = positions[i];
+            to = {nullptr, to.getX() + direction(random), to.getY(), to.getZ() + direction(random)};
+            for (std::size_t g = 0; g < thresholds.size(); ++g) {
+                if (MovementTracker::isCrossed(thresholds[g], baselines[g][i], to)) {
+                    baselines[g][i] = to;
+                    ++events[g];
+                }
+            }
+        }
+    }
+
+    constexpr auto updates = players * ticks;
+    EXPECT_EQ(events[0], updates);
+    EXPECT_LT(events[1], updates / 2);
+    EXPECT_LT(events[2], events[1] / 4);
+    EXPECT_LT(events[3], events[1]);
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/pending_chats.h"
+
+using endstone::UUID;
+using endstone::core::PendingChats;
+
+class PendingChatsTest : public ::testing::Test {
+protected:
+    std::shared_ptr<PendingChats::Chat> makeChat(const UUID &player, std::string message)
+    {
+        auto chat = std::make_shared<PendingChats::Chat>();
+        chat->player_unique_id = player;
+        chat->message = std::move(message);
+        return chat;
+    }
+
+    void drain()
+    {
+        pending_.drain([this](PendingChats::Chat &chat) { delivered_.push_back(chat.message); },
+                       [this](const std::shared_ptr<PendingChats::Chat> &chat) { submitted_.push_back(chat); });
+    }
+
+    PendingChats pending_;
+    std::vector<std::string> delivered_;
+    std::vector<std::shared_ptr<PendingChats::Chat>> submitted_;
+    UUID alice_{0x0b, 0xd2, 0xc9, 0xc5, 0xc0, 0x18, 0x4f, 0x3c, 0x98, 0x13, 0x82, 0xe1, 0x75, 0x16, 0x2e, 0x37};
+    UUID bob_{0x1b, 0xd2, 0xc9, 0xc5, 0xc0, 0x18, 0x4f, 0x3c, 0x98, 0x13, 0x82, 0xe1, 0x75, 0x16, 0x2e, 0x37};
+};
+
+TEST_F(PendingChatsTest, OneMessageInFlightPerPlayer)
+{
+    auto first = makeChat(alice_, "first");
+    auto second = makeChat(alice_, "second");
+    EXPECT_TRUE(pending_.push(first));
+    EXPECT_FALSE(pending_.push(second));  // waits for the first one
+    EXPECT_TRUE(pending_.push(makeChat(bob_, "other")));
+
+    // nothing is submitted until the message in flight has completed
+    drain();
+    EXPECT_TRUE(submitted_.empty());
+    EXPECT_TRUE(delivered_.empty());
+
+    pending_.complete(first);
+    drain();
+    EXPECT_EQ(delivered_, std::vector<std::string>{"first"});
+    ASSERT_EQ(submitted_.size(), 1);
+    EXPECT_EQ(submitted_[0], second);
+
+    pending_.complete(second);
+    drain();
+    EXPECT_EQ(delivered_, (std::vector<std::string>{"first", "second"}));
+    EXPECT_FALSE(pending_.contains(alice_));
+    EXPECT_TRUE(pending_.contains(bob_));
+}
+
+TEST_F(PendingChatsTest, PerPlayerOrdering)
+{
+    std::vector<std::shared_ptr<PendingChats::Chat>> in_flight;
+    for (int i = 0; i < 5; ++i) {
+        auto chat = makeChat(alice_, std::to_string(i));
+        if (pending_.push(chat)) {
+            in_flight.push_back(chat);
+        }
+    }
+    ASSERT_EQ(in_flight.size(), 1);
+
+    // complete each message on a worker thread as it is submitted
+    while (!in_flight.empty()) {
+        std::thread worker([this, chat = in_flight.back()]() { pending_.complete(chat); });
+        worker.join();
+        in_flight.clear();
+        drain();
+        in_flight.swap(submitted_);
+    }
+    EXPECT_EQ(delivered_, (std::vector<std::string>{"0", "1", "2", "3", "4"}));
+    EXPECT_FALSE(pending_.contains(alice_));
+}
+
+TEST_F(PendingChatsTest, DrainSkipsCancelled)
+{
+    auto first = makeChat(alice_, "first");
+    auto second = makeChat(alice_, "second");
+    pending_.push(first);
+    pending_.push(second);
+
+    first->cancelled = true;
+    pending_.complete(first);
+    drain();
+    EXPECT_TRUE(delivered_.empty());
+    ASSERT_EQ(submitted_.size(), 1);  // the next one is still handed to the workers
+    EXPECT_EQ(submitted_[0], second);
+}
+
+TEST_F(PendingChatsTest, DrainDeliversAllCompleted)
+{
+    auto alice = makeChat(alice_, "alice");
+    auto bob = makeChat(bob_, "bob");
+    pending_.push(alice);
+    pending_.push(bob);
+
+    pending_.complete(bob);
+    pending_.complete(alice);
+    drain();
+    EXPECT_EQ(delivered_, (std::vector<std::string>{"bob", "alice"}));
+    EXPECT_TRUE(submitted_.empty());
+    EXPECT_FALSE(pending_.contains(alice_));
+    EXPECT_FALSE(pending_.contains(bob_));
+}
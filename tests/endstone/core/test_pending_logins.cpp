@@ -0,0 +1,94 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/pending_logins.h"
+
+using endstone::UUID;
+using endstone::core::PendingLogins;
+
+class PendingLoginsTest : public ::testing::Test {
+protected:
+    PendingLogins pending_;
+    PendingLogins::Clock::time_point now_{PendingLogins::Clock::now()};
+    PendingLogins::Clock::time_point deadline_{now_ + std::chrono::seconds(10)};
+    UUID alice_{0x0b, 0xd2, 0xc9, 0xc5, 0xc0, 0x18, 0x4f, 0x3c, 0x98, 0x13, 0x82, 0xe1, 0x75, 0x16, 0x2e, 0x37};
+    UUID bob_{0x1b, 0xd2, 0xc9, 0xc5, 0xc0, 0x18, 0x4f, 0x3c, 0x98, 0x13, 0x82, 0xe1, 0x75, 0x16, 0x2e, 0x37};
+};
+
+TEST_F(PendingLoginsTest, Allow)
+{
+    auto outcome = pending_.add(alice_, deadline_);
+    EXPECT_TRUE(pending_.contains(alice_));
+    EXPECT_TRUE(pending_.poll(now_).empty());
+
+    outcome->complete(false, "");
+    EXPECT_TRUE(pending_.contains(alice_));  // held back until the next poll
+
+    const auto resolutions = pending_.poll(now_);
+    ASSERT_EQ(resolutions.size(), 1);
+    EXPECT_EQ(resolutions[0].unique_id, alice_);
+    EXPECT_EQ(resolutions[0].result, PendingLogins::Result::Allowed);
+    EXPECT_FALSE(resolutions[0].join_deferred);
+    EXPECT_FALSE(pending_.contains(alice_));
+    EXPECT_TRUE(pending_.empty());
+}
+
+TEST_F(PendingLoginsTest, Deny)
+{
+    auto outcome = pending_.add(alice_, deadline_);
+    outcome->complete(true, "Not whitelisted");
+
+    const auto resolutions = pending_.poll(now_);
+    ASSERT_EQ(resolutions.size(), 1);
+    EXPECT_EQ(resolutions[0].result, PendingLogins::Result::Denied);
+    EXPECT_EQ(resolutions[0].kick_message, "Not whitelisted");
+    EXPECT_FALSE(pending_.contains(alice_));
+}
+
+TEST_F(PendingLoginsTest, Timeout)
+{
+    auto outcome = pending_.add(alice_, deadline_);
+    EXPECT_TRUE(pending_.poll(deadline_ - std::chrono::milliseconds(1)).empty());
+
+    const auto resolutions = pending_.poll(deadline_);
+    ASSERT_EQ(resolutions.size(), 1);
+    EXPECT_EQ(resolutions[0].result, PendingLogins::Result::TimedOut);
+    EXPECT_FALSE(pending_.contains(alice_));
+
+    // an outcome set after the timeout has no effect
+    outcome->complete(false, "");
+    EXPECT_TRUE(pending_.poll(deadline_).empty());
+}
+
+TEST_F(PendingLoginsTest, DeferJoin)
+{
+    EXPECT_FALSE(pending_.deferJoin(alice_));
+
+    auto alice = pending_.add(alice_, deadline_);
+    auto bob = pending_.add(bob_, deadline_);
+    EXPECT_TRUE(pending_.deferJoin(alice_));
+
+    alice->complete(false, "");
+    bob->complete(false, "");
+    auto resolutions = pending_.poll(now_);
+    ASSERT_EQ(resolutions.size(), 2);
+    for (const auto &resolution : resolutions) {
+        EXPECT_EQ(resolution.join_deferred, resolution.unique_id == alice_);
+    }
+}
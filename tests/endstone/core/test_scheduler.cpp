@@ -12,8 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -57,6 +60,8 @@ public:
     MOCK_METHOD(float, getCurrentTickUsage, (), (override));
     MOCK_METHOD(float, getAverageTickUsage, (), (override));
     MOCK_METHOD(std::chrono::system_clock::time_point, getStartTime, (), (override));
+    MOCK_METHOD(endstone::ViewDistanceHintSettings, getViewDistanceHintSettings, (), (const, override));
+    MOCK_METHOD(endstone::Result<void>, setViewDistanceHintSettings, (endstone::ViewDistanceHintSettings), (override));
     MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
                 (std::string, endstone::BarColor, endstone::BarStyle), (const, override));
     MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
@@ -68,6 +73,8 @@ public:
                 (std::string, endstone::BlockStates), (const, override));
     MOCK_METHOD(endstone::PlayerBanList &, getBanList, (), (const, override));
     MOCK_METHOD(endstone::IpBanList &, getIpBanList, (), (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::FormTemplate>, createFormTemplate, (endstone::FormTemplate::FormVariant),
+                (const, override));
 };
 
 class MockPlugin : public endstone::Plugin {
@@ -77,6 +84,11 @@ public:
     {
         setEnabled(true);
     }
+
+    void disable()
+    {
+        setEnabled(false);
+    }
 };
 
 class SchedulerTest : public ::testing::Test {
@@ -213,3 +225,206 @@ TEST_F(SchedulerTest, GetPendingTasks)
     EXPECT_NE(std::find(task_ids.begin(), task_ids.end(), task2->getTaskId()), task_ids.end());
     EXPECT_NE(std::find(task_ids.begin(), task_ids.end(), task3->getTaskId()), task_ids.end());
 }
+
+// Test that coroutines run until their first suspension point and resume in order of their schedule
+TEST_F(SchedulerTest, CoroutineResumptionOrder)
+{
+    std::vector<std::string> log;
+    auto worker = [&](std::string name, std::uint64_t delay) -> endstone::Coroutine<> {
+        log.push_back(name + ":start");
+        co_await scheduler_->delay(delay);
+        log.push_back(name + ":" + std::to_string(tick_count_));
+        co_await scheduler_->nextTick();
+        log.push_back(name + ":" + std::to_string(tick_count_));
+    };
+
+    scheduler_->runCoroutine(*plugin_, worker("a", 2));
+    scheduler_->runCoroutine(*plugin_, worker("b", 1));
+    scheduler_->runCoroutine(*plugin_, worker("c", 2));
+    EXPECT_EQ(log, (std::vector<std::string>{"a:start", "b:start", "c:start"}));
+
+    for (int i = 0; i < 4; ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+    }
+    EXPECT_EQ(log, (std::vector<std::string>{"a:start", "b:start", "c:start", "b:1", "a:2", "c:2", "b:2", "a:3",
+                                             "c:3"}));
+}
+
+// Test awaiting a coroutine from another coroutine
+TEST_F(SchedulerTest, CoroutineNested)
+{
+    auto child = [&](int value) -> endstone::Coroutine<int> {
+        co_await scheduler_->nextTick();
+        co_return value * 2;
+    };
+
+    int result = 0;
+    auto parent = [&]() -> endstone::Coroutine<> {
+        result = co_await child(21);
+        result += co_await child(1);
+    };
+
+    scheduler_->runCoroutine(*plugin_, parent());
+    EXPECT_EQ(result, 0);
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(result, 42);
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(result, 44);
+}
+
+// Test that a coroutine started by a task waits for whole ticks counted from the tick the task ran on
+TEST_F(SchedulerTest, CoroutineStartedByTask)
+{
+    std::vector<std::uint64_t> ticks;
+    auto coroutine = [&]() -> endstone::Coroutine<> {
+        ticks.push_back(tick_count_);
+        co_await scheduler_->nextTick();
+        ticks.push_back(tick_count_);
+        co_await scheduler_->delay(3);
+        ticks.push_back(tick_count_);
+    };
+
+    scheduler_->runTaskLater(*plugin_, [&]() { scheduler_->runCoroutine(*plugin_, coroutine()); }, 2);
+    for (int i = 0; i < 8; ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+    }
+    EXPECT_EQ(ticks, (std::vector<std::uint64_t>{2, 3, 6}));
+}
+
+// Test moving a coroutine between the server thread and worker threads
+TEST_F(SchedulerTest, CoroutineSwitchThreads)
+{
+    auto main_thread = std::this_thread::get_id();
+    std::thread::id async_thread;
+    std::atomic<bool> done = false;
+
+    auto coroutine = [&]() -> endstone::Coroutine<> {
+        co_await scheduler_->switchToAsync();
+        async_thread = std::this_thread::get_id();
+        co_await scheduler_->switchToMain();
+        EXPECT_EQ(std::this_thread::get_id(), main_thread);
+        done = true;
+    };
+
+    scheduler_->runCoroutine(*plugin_, coroutine());
+    for (int i = 0; i < 1000 && !done; ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(done);
+    EXPECT_NE(async_thread, main_thread);
+}
+
+// Test that suspended coroutines are destroyed, not resumed, once the tasks of their plugin are cancelled
+TEST_F(SchedulerTest, CoroutineCancelled)
+{
+    struct Guard {
+        bool &destroyed;
+        ~Guard()
+        {
+            destroyed = true;
+        }
+    };
+
+    bool resumed = false;
+    bool destroyed = false;
+    auto child = [&]() -> endstone::Coroutine<> {
+        Guard guard{destroyed};
+        co_await scheduler_->delay(100);
+        resumed = true;
+    };
+    auto parent = [&]() -> endstone::Coroutine<> {
+        co_await child();
+        resumed = true;
+    };
+
+    scheduler_->runCoroutine(*plugin_, parent());
+    scheduler_->cancelTasks(*plugin_);
+    EXPECT_TRUE(destroyed);
+
+    for (int i = 0; i < 101; ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+    }
+    EXPECT_FALSE(resumed);
+}
+
+// Test many coroutines that each wait for the next tick several times in a row
+TEST_F(SchedulerTest, CoroutineManyChains)
+{
+    constexpr int chains = 1000;
+    constexpr int steps = 20;
+
+    int completed = 0;
+    auto coroutine = [&]() -> endstone::Coroutine<> {
+        for (int i = 0; i < steps; ++i) {
+            co_await scheduler_->nextTick();
+        }
+        ++completed;
+    };
+
+    for (int i = 0; i < chains; ++i) {
+        scheduler_->runCoroutine(*plugin_, coroutine());
+    }
+    for (int i = 0; i < steps - 1; ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+    }
+    EXPECT_EQ(completed, 0);
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    EXPECT_EQ(completed, chains);
+}
+
+// Test calling a function on the server thread and chaining continuations on its result
+TEST_F(SchedulerTest, CallSync)
+{
+    auto future = scheduler_->callSync(*plugin_, [&]() { return static_cast<int>(tick_count_); });
+    auto doubled = future.then([](int value) { return value * 2; });
+    auto formatted = doubled.thenSync([](int value) { return std::to_string(value); });
+    EXPECT_FALSE(future.isDone());
+
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    ASSERT_TRUE(doubled.isDone());
+    EXPECT_EQ(future.get(), 1);
+    EXPECT_EQ(doubled.get(), 2);
+    EXPECT_FALSE(formatted.isDone());  // continuations on the server thread run in the next batch
+
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    ASSERT_TRUE(formatted.isDone());
+    EXPECT_EQ(formatted.get(), "2");
+}
+
+// Test calling a function on a worker thread and coming back to the server thread with its result
+TEST_F(SchedulerTest, CallAsync)
+{
+    auto main_thread = std::this_thread::get_id();
+    auto future = scheduler_->callAsync(*plugin_, []() { return std::this_thread::get_id(); });
+    auto result = future.thenSync([&](std::thread::id worker) {
+        EXPECT_EQ(std::this_thread::get_id(), main_thread);
+        return worker;
+    });
+
+    for (int i = 0; i < 1000 && !result.isDone(); ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_count_);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(result.isDone());
+    EXPECT_NE(result.get(), main_thread);
+}
+
+// Test that exceptions and cancellation propagate through continuations
+TEST_F(SchedulerTest, CallSyncFailure)
+{
+    bool called = false;
+    auto failed = scheduler_->callSync(*plugin_, []() -> int { throw std::runtime_error("failed"); });
+    auto chained = failed.then([&](int) { called = true; });
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    ASSERT_TRUE(chained.isDone());
+    EXPECT_THROW(chained.get(), std::runtime_error);
+    EXPECT_FALSE(called);
+
+    // functions of a disabled plugin are never called, their futures fail instead
+    auto cancelled = scheduler_->callSync(*plugin_, []() { return 1; }).then([](int value) { return value + 1; });
+    plugin_->disable();
+    scheduler_->mainThreadHeartbeat(++tick_count_);
+    ASSERT_TRUE(cancelled.isDone());
+    EXPECT_THROW(cancelled.get(), std::runtime_error);
+}
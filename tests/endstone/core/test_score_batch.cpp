@@ -0,0 +1,180 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/scoreboard/score_batch.h"
+
+using endstone::core::ScoreBatch;
+
+namespace {
+struct FakeObjective {
+    std::string name;
+    std::unordered_map<std::string, int> scores;
+};
+
+struct FakeBoard {
+    using Objective = FakeObjective;
+    using Id = std::string;
+
+    [[nodiscard]] std::string getName(const FakeObjective &objective) const
+    {
+        return objective.name;
+    }
+
+    [[nodiscard]] bool isRegistered(const FakeObjective &objective, const std::string &name) const
+    {
+        return registered && objective.name == name;
+    }
+
+    [[nodiscard]] std::optional<int> getScore(const FakeObjective &objective, const std::string &id) const
+    {
+        if (auto it = objective.scores.find(id); it != objective.scores.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    bool setScore(FakeObjective &objective, const std::string &id, int score)
+    {
+        if (!muted) {
+            ++unmuted_writes;  // the board would have sent a packet for this change
+        }
+        objective.scores[id] = score;
+        return true;
+    }
+
+    void setMuted(bool value)
+    {
+        muted = value;
+    }
+
+    void broadcast(const FakeObjective & /*objective*/, std::span<const std::pair<std::string, int>> changes)
+    {
+        broadcasts.emplace_back(changes.begin(), changes.end());
+    }
+
+    bool registered = true;
+    bool muted = false;
+    int unmuted_writes = 0;
+    std::vector<std::vector<std::pair<std::string, int>>> broadcasts;
+};
+}  // namespace
+
+class ScoreBatchTest : public ::testing::Test {
+protected:
+    FakeBoard board_;
+    FakeObjective objective_{"kills", {{"alice", 1}}};
+    ScoreBatch<FakeBoard> batch_;
+};
+
+TEST_F(ScoreBatchTest, Coalesces)
+{
+    batch_.add(board_, objective_, "bob", 1);
+    batch_.add(board_, objective_, "bob", 2);
+    batch_.add(board_, objective_, "carol", 5);
+    batch_.add(board_, objective_, "bob", 3);    // last write wins, and keeps its place
+    batch_.add(board_, objective_, "alice", 1);  // already the current score
+
+    batch_.flush(board_);
+    ASSERT_EQ(board_.broadcasts.size(), 1);
+    EXPECT_EQ(board_.broadcasts[0], (std::vector<std::pair<std::string, int>>{{"bob", 3}, {"carol", 5}}));
+    EXPECT_EQ(objective_.scores.at("bob"), 3);
+    EXPECT_EQ(objective_.scores.at("carol"), 5);
+}
+
+TEST_F(ScoreBatchTest, PendingScoreBeforeFlush)
+{
+    batch_.add(board_, objective_, "alice", 7);
+    EXPECT_EQ(batch_.find(objective_, "alice"), 7);
+    EXPECT_EQ(objective_.scores.at("alice"), 1);  // not applied yet
+    EXPECT_FALSE(batch_.find(objective_, "bob").has_value());
+
+    FakeObjective other{"deaths", {}};
+    EXPECT_FALSE(batch_.find(other, "alice").has_value());
+
+    batch_.flush(board_);
+    EXPECT_FALSE(batch_.find(objective_, "alice").has_value());
+    EXPECT_EQ(objective_.scores.at("alice"), 7);
+    EXPECT_TRUE(batch_.empty());
+}
+
+TEST_F(ScoreBatchTest, SingleFlushThroughMutedSender)
+{
+    FakeObjective deaths{"deaths", {}};
+    for (int i = 0; i < 10; ++i) {
+        batch_.add(board_, objective_, "player" + std::to_string(i), i);
+        batch_.add(board_, deaths, "player" + std::to_string(i), i);
+    }
+    EXPECT_TRUE(board_.broadcasts.empty());
+
+    batch_.flush(board_);
+    EXPECT_EQ(board_.unmuted_writes, 0);
+    EXPECT_FALSE(board_.muted);
+    ASSERT_EQ(board_.broadcasts.size(), 2);  // one per objective
+    EXPECT_EQ(board_.broadcasts[0].size(), 10);
+    EXPECT_EQ(board_.broadcasts[1].size(), 10);
+
+    // nothing is left to send
+    batch_.flush(board_);
+    EXPECT_EQ(board_.broadcasts.size(), 2);
+}
+
+TEST_F(ScoreBatchTest, FlushObjective)
+{
+    FakeObjective deaths{"deaths", {}};
+    batch_.add(board_, objective_, "bob", 1);
+    batch_.add(board_, deaths, "bob", 2);
+
+    EXPECT_TRUE(batch_.flush(board_, deaths));
+    ASSERT_EQ(board_.broadcasts.size(), 1);
+    EXPECT_EQ(deaths.scores.at("bob"), 2);
+    EXPECT_EQ(batch_.find(objective_, "bob"), 1);
+}
+
+TEST_F(ScoreBatchTest, Erase)
+{
+    FakeObjective deaths{"deaths", {}};
+    batch_.add(board_, objective_, "bob", 1);
+    batch_.add(board_, objective_, "carol", 2);
+    batch_.add(board_, deaths, "bob", 3);
+
+    batch_.erase("bob");
+    EXPECT_FALSE(batch_.find(objective_, "bob").has_value());
+    EXPECT_FALSE(batch_.find(deaths, "bob").has_value());
+    EXPECT_EQ(batch_.find(objective_, "carol"), 2);
+
+    batch_.flush(board_);
+    ASSERT_EQ(board_.broadcasts.size(), 1);
+    EXPECT_EQ(board_.broadcasts[0], (std::vector<std::pair<std::string, int>>{{"carol", 2}}));
+}
+
+TEST_F(ScoreBatchTest, UnregisteredObjective)
+{
+    batch_.add(board_, objective_, "bob", 1);
+    board_.registered = false;
+
+    EXPECT_FALSE(batch_.flush(board_, objective_));
+    EXPECT_TRUE(board_.broadcasts.empty());
+    EXPECT_FALSE(objective_.scores.contains("bob"));
+    EXPECT_FALSE(batch_.find(objective_, "bob").has_value());
+}
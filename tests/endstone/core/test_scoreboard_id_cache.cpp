@@ -0,0 +1,90 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "bedrock/world/scores/objective.h"
+#include "endstone/core/scoreboard/objective.h"
+#include "endstone/core/scoreboard/scoreboard_id_cache.h"
+
+using endstone::core::ObjectiveHandle;
+using endstone::core::ScoreboardIdCache;
+
+TEST(ScoreboardIdCacheTest, ResolvesOnce)
+{
+    ScoreboardIdCache cache;
+    int resolved = 0;
+    const ScoreboardId id{42};
+    const auto resolve = [&]() -> const ScoreboardId & {
+        ++resolved;
+        return id;
+    };
+
+    EXPECT_EQ(cache.get(0, resolve).raw_id, 42);
+    EXPECT_EQ(cache.get(0, resolve).raw_id, 42);
+    EXPECT_EQ(resolved, 1);
+    EXPECT_TRUE(cache.isCached(0));
+}
+
+TEST(ScoreboardIdCacheTest, MissesAreNotCached)
+{
+    ScoreboardIdCache cache;
+    int resolved = 0;
+    const auto resolve = [&]() -> const ScoreboardId & {
+        ++resolved;
+        return ScoreboardId::INVALID;
+    };
+
+    EXPECT_FALSE(cache.get(0, resolve).isValid());
+    EXPECT_FALSE(cache.get(0, resolve).isValid());
+    EXPECT_EQ(resolved, 2);
+    EXPECT_FALSE(cache.isCached(0));
+}
+
+TEST(ScoreboardIdCacheTest, Invalidation)
+{
+    ScoreboardIdCache cache;
+    int resolved = 0;
+    const ScoreboardId id{42};
+    const auto resolve = [&]() -> const ScoreboardId & {
+        ++resolved;
+        return id;
+    };
+
+    cache.get(0, resolve);
+    EXPECT_FALSE(cache.isCached(1));
+    cache.get(1, resolve);
+    EXPECT_EQ(resolved, 2);
+
+    cache.invalidate();
+    EXPECT_FALSE(cache.isCached(1));
+    cache.get(1, resolve);
+    EXPECT_EQ(resolved, 3);
+}
+
+TEST(ObjectiveHandleTest, DetectsDestroyedObjective)
+{
+    const ObjectiveCriteria criteria{};
+    auto objective = std::make_unique<Objective>("kills", criteria);
+    auto handle = std::make_shared<ObjectiveHandle>(*objective);
+    EXPECT_TRUE(handle->ref.isValid());
+    EXPECT_EQ(handle->name, "kills");
+
+    objective.reset();
+    EXPECT_FALSE(handle->ref.isValid());
+    EXPECT_NO_THROW(handle.reset());
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/base64.h"
+#include "endstone/core/skin_cache.h"
+
+using endstone::core::base64_encode;
+using endstone::core::SkinCache;
+
+namespace {
+std::string makeImage(int height, int width, int seed)
+{
+    std::string image(static_cast<std::size_t>(height) * width * 4, '\0');
+    for (std::size_t i = 0; i < image.size(); ++i) {
+        image[i] = static_cast<char>((i * 31 + seed * 7) & 0xff);
+    }
+    return image;
+}
+}  // namespace
+
+TEST(SkinCacheTest, SharesEqualSkins)
+{
+    SkinCache cache;
+    const auto skin = base64_encode(makeImage(64, 64, 1));
+    const auto cape = base64_encode(makeImage(32, 64, 2));
+
+    auto a = cache.get("skin", {64, 64, skin}, "cape", {32, 64, cape});
+    auto b = cache.get("skin", {64, 64, std::string(skin)}, "cape", {32, 64, cape});
+    EXPECT_EQ(a, b);
+
+    // any difference gives a skin of its own
+    EXPECT_NE(a, cache.get("other", {64, 64, skin}, "cape", {32, 64, cape}));
+    EXPECT_NE(a, cache.get("skin", {64, 64, skin}, "", {0, 0, ""}));
+    EXPECT_NE(a, cache.get("skin", {32, 128, skin}, "cape", {32, 64, cape}));
+    EXPECT_NE(a, cache.get("skin", {64, 64, base64_encode(makeImage(64, 64, 3))}, "cape", {32, 64, cape}));
+
+    const auto usage = cache.getUsage();
+    EXPECT_EQ(usage.skins, 1);  // the others are already gone
+    EXPECT_EQ(usage.players, 2);
+    EXPECT_EQ(usage.decoded, 0);
+    EXPECT_EQ(usage.bytes, skin.size() + cape.size());
+
+    a.reset();
+    b.reset();
+    EXPECT_EQ(cache.getUsage().skins, 0);
+}
+
+TEST(SkinCacheTest, DecodesOnFirstAccess)
+{
+    SkinCache cache;
+    const auto image = makeImage(64, 64, 1);
+    const auto entry = cache.get("skin", {64, 64, base64_encode(image)}, "", {0, 0, ""});
+    EXPECT_FALSE(entry->isDecoded());
+
+    const auto &skin = entry->getSkin();
+    EXPECT_TRUE(entry->isDecoded());
+    EXPECT_EQ(&skin, &entry->getSkin());
+    EXPECT_EQ(skin.getSkinId(), "skin");
+    EXPECT_EQ(skin.getSkinData().height, 64);
+    EXPECT_EQ(skin.getSkinData().width, 64);
+    EXPECT_EQ(skin.getSkinData().data, image);
+    EXPECT_EQ(cache.getUsage().decoded, 1);
+}
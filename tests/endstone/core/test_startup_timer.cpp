@@ -0,0 +1,60 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/startup_timer.h"
+
+using endstone::core::StartupTimer;
+using namespace std::chrono_literals;
+
+TEST(StartupTimerTest, MeasuresPhases)
+{
+    StartupTimer timer;
+    timer.measure("Sleep", [] { std::this_thread::sleep_for(5ms); });
+    const auto value = timer.measure("Compute", [] { return 42; });
+    EXPECT_EQ(value, 42);
+
+    const auto &phases = timer.getPhases();
+    ASSERT_EQ(phases.size(), 2U);
+    EXPECT_EQ(phases[0].name, "Sleep");
+    EXPECT_GE(phases[0].duration, 5ms);
+    EXPECT_EQ(phases[1].name, "Compute");
+    EXPECT_EQ(timer.getTotal(), phases[0].duration + phases[1].duration);
+
+    timer.clear();
+    EXPECT_TRUE(timer.getPhases().empty());
+}
+
+TEST(StartupTimerTest, RecordsPhasesThatThrow)
+{
+    StartupTimer timer;
+    EXPECT_THROW(timer.measure("Fail", []() -> int { throw std::runtime_error("fail"); }), std::runtime_error);
+    ASSERT_EQ(timer.getPhases().size(), 1U);
+    EXPECT_EQ(timer.getPhases()[0].name, "Fail");
+}
+
+TEST(StartupTimerTest, ToString)
+{
+    StartupTimer timer;
+    EXPECT_EQ(timer.toString(), "");
+    timer.record("Python init", 310240us);
+    timer.record("Hook install", 3100us);
+    EXPECT_EQ(timer.toString(), "Python init: 310.2 ms, Hook install: 3.1 ms");
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/lang/translation_cache.h"
+
+using endstone::core::TranslationCache;
+
+namespace {
+// formats like I18n::get, substituting %s and %1 to %9 with the parameters
+std::string format(const std::string &pattern, const std::vector<std::string> &params)
+{
+    std::string result;
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < pattern.size(); ++i) {
+        if (pattern[i] == '%' && i + 1 < pattern.size()) {
+            const auto c = pattern[i + 1];
+            if (c == 's' && next < params.size()) {
+                result += params[next++];
+                ++i;
+                continue;
+            }
+            if (c >= '1' && c <= '9' && static_cast<std::size_t>(c - '1') < params.size()) {
+                result += params[c - '1'];
+                ++i;
+                continue;
+            }
+        }
+        result += pattern[i];
+    }
+    return result;
+}
+}  // namespace
+
+TEST(TranslationCacheTest, RendersOnce)
+{
+    TranslationCache cache;
+    int renders = 0;
+    const std::vector<std::string> params{"Steve"};
+    const auto render = [&] {
+        ++renders;
+        return format("%s joined the game", params);
+    };
+
+    EXPECT_EQ(cache.get("en_US", "multiplayer.player.joined", params, render), "Steve joined the game");
+    EXPECT_EQ(cache.get("en_US", "multiplayer.player.joined", params, render), "Steve joined the game");
+    EXPECT_EQ(renders, 1);
+
+    cache.get("de_DE", "multiplayer.player.joined", params, render);
+    cache.get("en_US", "multiplayer.player.joined", {"Alex"}, render);
+    cache.get("en_US", "multiplayer.player.left", params, render);
+    EXPECT_EQ(renders, 4);
+    EXPECT_EQ(cache.size(), 4);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    cache.get("en_US", "multiplayer.player.joined", params, render);
+    EXPECT_EQ(renders, 5);
+}
+
+TEST(TranslationCacheTest, ParametersAreNotConcatenated)
+{
+    TranslationCache cache;
+    const auto a = cache.get("en_US", "key", {"ab", "c"}, [] { return std::string("a"); });
+    const auto b = cache.get("en_US", "key", {"a", "bc"}, [] { return std::string("b"); });
+    EXPECT_NE(a, b);
+}
+
+TEST(TranslationCacheTest, Bounded)
+{
+    TranslationCache cache{8};
+    int renders = 0;
+    const auto render = [&] {
+        ++renders;
+        return std::string("value");
+    };
+
+    for (int i = 0; i < 100; ++i) {
+        cache.get("en_US", "key." + std::to_string(i), {}, render);
+        // entries that keep being used survive the rotations
+        cache.get("en_US", "hot", {}, render);
+        EXPECT_LE(cache.size(), 16);
+    }
+    EXPECT_EQ(renders, 101);
+}
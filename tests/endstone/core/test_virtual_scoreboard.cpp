@@ -0,0 +1,190 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/scoreboard/virtual_scoreboard.h"
+
+using endstone::DisplaySlot;
+using endstone::ObjectiveSortOrder;
+using endstone::core::EndstoneVirtualScoreboard;
+
+namespace {
+std::vector<std::string> makeLines(int counter)
+{
+    std::vector<std::string> lines;
+    lines.reserve(15);
+    lines.emplace_back("§6Endstone Network");
+    lines.emplace_back("§1");
+    lines.emplace_back("Online: " + std::to_string(200));
+    lines.emplace_back("Counter: " + std::to_string(counter));
+    for (int i = 4; i < 15; ++i) {
+        lines.emplace_back("Line " + std::to_string(i));
+    }
+    return lines;
+}
+
+// the number of packets an update is sent with
+std::size_t countPackets(const EndstoneVirtualScoreboard::Update &update)
+{
+    return update.remove + update.display + !update.removed.empty() + !update.changed.empty();
+}
+}  // namespace
+
+TEST(VirtualScoreboardTest, DisplayLines)
+{
+    EndstoneVirtualScoreboard board;
+    board.setLines(DisplaySlot::SideBar, {"a", "b", "c"});
+    board.setDisplay(DisplaySlot::SideBar, "Title");
+    EXPECT_TRUE(board.isDisplayed(DisplaySlot::SideBar));
+    EXPECT_EQ(board.getScore(DisplaySlot::SideBar, "a"), 3);
+    EXPECT_EQ(board.getScore(DisplaySlot::SideBar, "c"), 1);
+
+    const auto updates = board.takeUpdates();
+    ASSERT_EQ(updates.size(), 1);
+    EXPECT_EQ(updates[0].slot, DisplaySlot::SideBar);
+    EXPECT_FALSE(updates[0].remove);
+    EXPECT_TRUE(updates[0].display);
+    EXPECT_EQ(updates[0].display_name, "Title");
+    EXPECT_EQ(updates[0].changed.size(), 3);
+    EXPECT_FALSE(board.isDirty());
+}
+
+TEST(VirtualScoreboardTest, OnlyChangesAreSent)
+{
+    EndstoneVirtualScoreboard board;
+    board.setDisplay(DisplaySlot::SideBar, "Title", ObjectiveSortOrder::Ascending);
+    board.setLines(DisplaySlot::SideBar, {"a", "b", "c"});
+    (void)board.takeUpdates();
+
+    // the same lines again
+    board.setLines(DisplaySlot::SideBar, {"a", "b", "c"});
+    EXPECT_FALSE(board.isDirty());
+
+    // a changed line replaces a single entry
+    board.setLines(DisplaySlot::SideBar, {"a", "B", "c"});
+    auto updates = board.takeUpdates();
+    ASSERT_EQ(updates.size(), 1);
+    EXPECT_FALSE(updates[0].display);
+    EXPECT_EQ(updates[0].removed.size(), 1);
+    ASSERT_EQ(updates[0].changed.size(), 1);
+    EXPECT_EQ(updates[0].changed[0]->name, "B");
+    EXPECT_EQ(updates[0].changed[0]->score, 2);
+
+    // a score changed back before the update is not sent
+    board.setScore(DisplaySlot::SideBar, "a", 10);
+    board.setScore(DisplaySlot::SideBar, "a", 1);
+    EXPECT_TRUE(board.takeUpdates().empty());
+
+    // a score added and removed before the update is not sent
+    board.setScore(DisplaySlot::SideBar, "d", 4);
+    board.resetScore(DisplaySlot::SideBar, "d");
+    EXPECT_TRUE(board.takeUpdates().empty());
+    EXPECT_FALSE(board.getScore(DisplaySlot::SideBar, "d").has_value());
+}
+
+TEST(VirtualScoreboardTest, ScoresAreKeptUntilDisplayed)
+{
+    EndstoneVirtualScoreboard board;
+    board.setScore(DisplaySlot::PlayerList, "a", 1);
+    EXPECT_TRUE(board.takeUpdates().empty());
+
+    board.setDisplay(DisplaySlot::PlayerList, "List");
+    auto updates = board.takeUpdates();
+    ASSERT_EQ(updates.size(), 1);
+    EXPECT_TRUE(updates[0].display);
+    EXPECT_EQ(updates[0].changed.size(), 1);
+}
+
+TEST(VirtualScoreboardTest, RenameSendsEverythingAgain)
+{
+    EndstoneVirtualScoreboard board;
+    board.setDisplay(DisplaySlot::SideBar, "Title");
+    board.setLines(DisplaySlot::SideBar, {"a", "b"});
+    (void)board.takeUpdates();
+
+    board.setDisplay(DisplaySlot::SideBar, "Title");
+    EXPECT_FALSE(board.isDirty());
+
+    board.setDisplay(DisplaySlot::SideBar, "Other");
+    auto updates = board.takeUpdates();
+    ASSERT_EQ(updates.size(), 1);
+    EXPECT_TRUE(updates[0].remove);
+    EXPECT_TRUE(updates[0].display);
+    EXPECT_TRUE(updates[0].removed.empty());
+    EXPECT_EQ(updates[0].changed.size(), 2);
+}
+
+TEST(VirtualScoreboardTest, ClearDisplay)
+{
+    EndstoneVirtualScoreboard board;
+    board.setDisplay(DisplaySlot::BelowName, "Health");
+    board.setScore(DisplaySlot::BelowName, "a", 20);
+    (void)board.takeUpdates();
+
+    board.clearDisplay(DisplaySlot::BelowName);
+    EXPECT_FALSE(board.isDisplayed(DisplaySlot::BelowName));
+    EXPECT_FALSE(board.getScore(DisplaySlot::BelowName, "a").has_value());
+    auto updates = board.takeUpdates();
+    ASSERT_EQ(updates.size(), 1);
+    EXPECT_TRUE(updates[0].remove);
+    EXPECT_FALSE(updates[0].display);
+    EXPECT_TRUE(updates[0].changed.empty());
+
+    // clearing a slot that is not displayed sends nothing
+    board.clearDisplay(DisplaySlot::SideBar);
+    EXPECT_FALSE(board.isDirty());
+}
+
+// Simulate 200 players with a 15-line sidebar, where one line changes every tick for a minute
+TEST(VirtualScoreboardTest, SidebarUpdatesStaySmall)
+{
+    constexpr int players = 200;
+    constexpr int ticks = 1200;
+
+    std::vector<EndstoneVirtualScoreboard> boards(players);
+    for (auto &board : boards) {
+        board.setDisplay(DisplaySlot::SideBar, "§lSidebar");
+        board.setLines(DisplaySlot::SideBar, makeLines(0));
+    }
+
+    std::size_t packets = 0;
+    for (auto &board : boards) {
+        for (const auto &update : board.takeUpdates()) {
+            packets += countPackets(update);
+        }
+    }
+    EXPECT_EQ(packets, players * 2);  // the objective and its scores
+    for (const auto &board : boards) {
+        EXPECT_LT(board.getMemoryUsage(), 4096);
+    }
+
+    packets = 0;
+    std::size_t entries = 0;
+    for (int tick = 1; tick <= ticks; ++tick) {
+        const auto lines = makeLines(tick);
+        for (auto &board : boards) {
+            board.setLines(DisplaySlot::SideBar, lines);
+            for (const auto &update : board.takeUpdates()) {
+                entries += update.removed.size() + update.changed.size();
+                packets += countPackets(update);
+            }
+        }
+    }
+    EXPECT_EQ(packets, players * ticks * 2);  // one to remove the old line, one to add the new line
+    EXPECT_EQ(entries, players * ticks * 2);
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <pybind11/embed.h>
+#include <pybind11/stl.h>
+
+#include "endstone/python/callback.h"
+
+namespace py = pybind11;
+
+namespace {
+// Abstract and non-copyable, like Chunk and Inventory
+class Counter {
+public:
+    Counter() = default;
+    Counter(const Counter &) = delete;
+    Counter &operator=(const Counter &) = delete;
+    virtual ~Counter() = default;
+
+    [[nodiscard]] virtual int getValue() const = 0;
+    virtual void increment() = 0;
+};
+
+class SimpleCounter : public Counter {
+public:
+    [[nodiscard]] int getValue() const override
+    {
+        return value_;
+    }
+
+    void increment() override
+    {
+        ++value_;
+    }
+
+private:
+    int value_ = 0;
+};
+
+struct CounterList {
+    explicit CounterList(std::size_t size) : counters(size) {}
+
+    void forEach(const std::function<void(Counter &)> &visitor)
+    {
+        for (auto &counter : counters) {
+            visitor(counter);
+        }
+    }
+
+    std::vector<SimpleCounter> counters;
+};
+}  // namespace
+
+PYBIND11_EMBEDDED_MODULE(endstone_test_callback, m)
+{
+    py::class_<Counter>(m, "Counter")
+        .def_property_readonly("value", &Counter::getValue)
+        .def("increment", &Counter::increment);
+    py::class_<CounterList>(m, "CounterList").def("for_each", [](CounterList &self, py::function visitor) {
+        self.forEach(endstone::python::by_reference<Counter>(std::move(visitor)));
+    });
+}
+
+class PyCallbackTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite()
+    {
+        interpreter_.emplace();
+        py::module_::import("endstone_test_callback");
+    }
+
+    static void TearDownTestSuite()
+    {
+        interpreter_.reset();
+    }
+
+    inline static std::optional<py::scoped_interpreter> interpreter_;
+};
+
+TEST_F(PyCallbackTest, PassesAbstractTypeByReference)
+{
+    CounterList list{3};
+    auto scope = py::dict();
+    scope["counters"] = py::cast(&list, py::return_value_policy::reference);
+    py::exec(R"(
+visited = []
+def visit(counter):
+    counter.increment()
+    visited.append(counter.value)
+counters.for_each(visit)
+)",
+             scope);
+
+    EXPECT_EQ(scope["visited"].cast<std::vector<int>>(), (std::vector<int>{1, 1, 1}));
+    for (const auto &counter : list.counters) {
+        EXPECT_EQ(counter.getValue(), 1);
+    }
+}
+
+TEST_F(PyCallbackTest, PropagatesExceptions)
+{
+    CounterList list{3};
+    auto scope = py::dict();
+    scope["counters"] = py::cast(&list, py::return_value_policy::reference);
+    py::exec(R"(
+def visit(counter):
+    counter.increment()
+    raise ValueError('oops')
+)",
+             scope);
+
+    EXPECT_THROW(scope["counters"].attr("for_each")(scope["visit"]), py::error_already_set);
+    EXPECT_EQ(list.counters[0].getValue(), 1);
+    EXPECT_EQ(list.counters[1].getValue(), 0);
+}
+
+TEST_F(PyCallbackTest, SupportsNestedCalls)
+{
+    CounterList list{2};
+    auto scope = py::dict();
+    scope["counters"] = py::cast(&list, py::return_value_policy::reference);
+    py::exec(R"(
+def outer(counter):
+    counter.increment()
+    counters.for_each(lambda inner: inner.increment())
+counters.for_each(outer)
+)",
+             scope);
+
+    EXPECT_EQ(list.counters[0].getValue(), 3);
+    EXPECT_EQ(list.counters[1].getValue(), 3);
+}
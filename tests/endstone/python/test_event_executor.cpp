@@ -0,0 +1,113 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <pybind11/embed.h>
+
+#include "endstone/python/event_executor.h"
+
+namespace py = pybind11;
+
+namespace {
+class TestEvent : public endstone::Event {
+public:
+    [[nodiscard]] std::string getEventName() const override
+    {
+        return "TestEvent";
+    }
+
+    int value = 0;
+};
+}  // namespace
+
+PYBIND11_EMBEDDED_MODULE(endstone_test_event, m)
+{
+    py::class_<endstone::Event>(m, "Event");
+    py::class_<TestEvent, endstone::Event>(m, "TestEvent").def_readwrite("value", &TestEvent::value);
+}
+
+class PyEventExecutorTest : public ::testing::Test {
+protected:
+    static constexpr int HandlerCount = 5;
+
+    static void SetUpTestSuite()
+    {
+        interpreter_.emplace();
+        py::module_::import("endstone_test_event");
+    }
+
+    static void TearDownTestSuite()
+    {
+        interpreter_.reset();
+    }
+
+    // A handler that increments the value of the event, like a listener mutating a cancellable event would.
+    static py::function createHandler()
+    {
+        py::dict scope;
+        py::exec("def handler(event):\n    event.value += 1\n", scope);
+        return scope["handler"];
+    }
+
+    inline static std::optional<py::scoped_interpreter> interpreter_;
+};
+
+TEST_F(PyEventExecutorTest, CallsHandlerWithMostDerivedType)
+{
+    auto scope = py::dict();
+    py::exec("def handler(event):\n    global received\n    received = type(event).__name__\n", scope);
+    endstone::python::PyEventExecutor executor(scope["handler"]);
+
+    TestEvent event;
+    executor(event);
+    EXPECT_EQ(scope["received"].cast<std::string>(), "TestEvent");
+
+    // the resolved type is reused for subsequent events
+    executor(event);
+    EXPECT_EQ(scope["received"].cast<std::string>(), "TestEvent");
+}
+
+TEST_F(PyEventExecutorTest, PropagatesExceptions)
+{
+    auto scope = py::dict();
+    py::exec("def handler(event):\n    raise ValueError('oops')\n", scope);
+    endstone::python::PyEventExecutor executor(scope["handler"]);
+
+    TestEvent event;
+    EXPECT_THROW(executor(event), py::error_already_set);
+}
+
+// Test dispatching to several handlers while the GIL is held across all of them, as EndstonePluginManager::callEvent does
+TEST_F(PyEventExecutorTest, DispatchesToSeveralHandlers)
+{
+    std::vector<endstone::python::PyEventExecutor> executors;
+    for (auto i = 0; i < HandlerCount; ++i) {
+        executors.emplace_back(createHandler());
+    }
+
+    py::gil_scoped_release release{};
+    TestEvent event;
+    {
+        py::gil_scoped_acquire gil{};
+        for (const auto &executor : executors) {
+            executor(event);
+        }
+    }
+    EXPECT_EQ(event.value, HandlerCount);
+}
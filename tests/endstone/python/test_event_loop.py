@@ -0,0 +1,153 @@
+import asyncio
+import importlib
+import threading
+import time
+
+import pytest
+
+
+@pytest.fixture
+def loop():
+    module = importlib.import_module("endstone._internal.event_loop")
+    loop = module.TickEventLoop()
+    module.set_event_loop(loop)
+    yield loop
+    module.set_event_loop(None)
+    loop.close()
+
+
+def test_sleep_ticks(loop):
+    module = importlib.import_module("endstone._internal.event_loop")
+    current_tick = [0]
+    ticks = []
+
+    async def run():
+        await module.next_tick()
+        ticks.append(current_tick[0])
+        await module.sleep_ticks(3)
+        ticks.append(current_tick[0])
+
+    # the task starts on the first pump (tick 1)
+    loop.loop.create_task(run())
+    for tick in range(1, 7):
+        current_tick[0] = tick
+        loop.pump(tick)
+
+    assert ticks == [2, 5]
+
+
+def test_run_async(loop):
+    module = importlib.import_module("endstone._internal.event_loop")
+    results = []
+    main_thread = threading.get_ident()
+
+    async def background():
+        await asyncio.sleep(0)
+        return threading.get_ident()
+
+    async def run():
+        results.append(await module.run_async(lambda x: x * 2, 21))
+        results.append(await module.run_async(background()))
+
+    task = loop.loop.create_task(run())
+    tick = 0
+    deadline = time.monotonic() + 5
+    while not task.done() and time.monotonic() < deadline:
+        tick += 1
+        loop.pump(tick)
+        time.sleep(0.001)
+
+    assert task.done()
+    assert results[0] == 42
+    assert results[1] != main_thread
+
+
+def test_time_slice(loop):
+    loop.time_slice = 0.01
+    count = [0]
+
+    async def spin():
+        while True:
+            count[0] += 1
+            time.sleep(0.001)
+            await asyncio.sleep(0)
+
+    loop.loop.create_task(spin())
+    start = time.perf_counter()
+    loop.pump(1)
+    elapsed = time.perf_counter() - start
+
+    # the pump yields back to the server once the slice is used up, even though the coroutine never finishes
+    assert count[0] > 0
+    assert elapsed < 0.1
+
+
+def test_pump_runs_ready_callbacks(loop):
+    loop.time_slice = 1.0
+    count = [0]
+
+    async def chain():
+        for _ in range(100):
+            count[0] += 1
+            await asyncio.sleep(0)
+
+    task = loop.loop.create_task(chain())
+    loop.pump(1)
+
+    # every step of the chain is ready right after the previous one, so they all run within the same pump
+    assert task.done()
+    assert count[0] == 100
+
+    # once nothing is ready, the pump returns without waiting for the end of the slice
+    start = time.perf_counter()
+    loop.pump(2)
+    assert time.perf_counter() - start < 0.5
+
+
+def test_call_sync_and_async(loop):
+    module = importlib.import_module("endstone._internal.event_loop")
+
+    class Plugin:
+        is_enabled = True
+
+    class Scheduler:
+        def __init__(self):
+            self.tasks = []
+
+        def post_sync(self, plugin, callback):
+            self.tasks.append(callback)
+
+    scheduler = Scheduler()
+    plugin = Plugin()
+    results = []
+
+    async def run():
+        results.append(await module.call_async(plugin, lambda: threading.get_ident()))
+        results.append(await module.call_sync(scheduler, plugin, lambda x: x + 1, 41))
+
+    task = loop.loop.create_task(run())
+    tick = 0
+    deadline = time.monotonic() + 5
+    while not task.done() and time.monotonic() < deadline:
+        tick += 1
+        for t in scheduler.tasks:
+            t()
+        scheduler.tasks.clear()
+        loop.pump(tick)
+        time.sleep(0.001)
+
+    assert task.done()
+    assert results[0] != threading.get_ident()
+    assert results[1] == 42
+
+    # functions of a disabled plugin are never called
+    plugin.is_enabled = False
+    future = module.call_sync(scheduler, plugin, lambda: 1)
+    scheduler.tasks[0]()
+    assert future.cancelled()
+    scheduler.tasks.clear()
+
+    # a call discarded before it runs fails its future instead of leaving it pending
+    future = module.call_sync(scheduler, plugin, lambda: 1)
+    scheduler.tasks.clear()
+    assert isinstance(future.exception(timeout=0), RuntimeError)
@@ -0,0 +1,78 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <pybind11/embed.h>
+
+#include "endstone/python/type_caster.h"
+
+namespace py = pybind11;
+
+class TypeCasterTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite()
+    {
+        interpreter_.emplace();
+    }
+
+    static void TearDownTestSuite()
+    {
+        interpreter_.reset();
+    }
+
+    static endstone::UUID createUUID()
+    {
+        endstone::UUID uuid;
+        for (std::uint8_t i = 0; i < 16; i++) {
+            uuid.data[i] = static_cast<std::uint8_t>(0x10 * i + i);
+        }
+        return uuid;
+    }
+
+    inline static std::optional<py::scoped_interpreter> interpreter_;
+};
+
+TEST_F(TypeCasterTest, CastUUIDToPython)
+{
+    const auto uuid = createUUID();
+    auto obj = py::cast(uuid);
+
+    ASSERT_TRUE(py::isinstance(obj, py::module_::import("uuid").attr("UUID")));
+    EXPECT_EQ(obj.attr("hex").cast<std::string>(), "00112233445566778899aabbccddeeff");
+    EXPECT_EQ(py::str(obj).cast<std::string>(), uuid.str());
+}
+
+TEST_F(TypeCasterTest, CastUUIDFromPython)
+{
+    auto obj = py::module_::import("uuid").attr("UUID")("00112233-4455-6677-8899-aabbccddeeff");
+    EXPECT_EQ(obj.cast<endstone::UUID>(), createUUID());
+
+    // the highest bit must survive the conversion
+    obj = py::module_::import("uuid").attr("UUID")("ffffffff-ffff-ffff-ffff-ffffffffffff");
+    const auto uuid = obj.cast<endstone::UUID>();
+    for (const auto byte : uuid.data) {
+        EXPECT_EQ(byte, 0xFF);
+    }
+}
+
+TEST_F(TypeCasterTest, RejectNonUUID)
+{
+    EXPECT_THROW(py::str("00112233-4455-6677-8899-aabbccddeeff").cast<endstone::UUID>(), py::cast_error);
+    EXPECT_FALSE(PyErr_Occurred());
+}
@@ -0,0 +1,78 @@
+import importlib
+import os.path
+import zipfile
+
+import pytest
+
+
+@pytest.fixture
+def cls(monkeypatch):
+    module = importlib.import_module("endstone._internal.wheel_cache")
+    installs = []
+
+    def pip_install(self, files):
+        installs.append(list(files))
+        return not any("broken" in os.path.basename(file) for file in files)
+
+    monkeypatch.setattr(module.WheelCache, "_pip_install", pip_install)
+    monkeypatch.setattr(module.WheelCache, "installs", installs, raising=False)
+    return module.WheelCache
+
+
+def make_wheel(directory, name, content="1"):
+    path = directory / f"{name}-0.1.0-py3-none-any.whl"
+    with zipfile.ZipFile(path, "w") as f:
+        f.writestr(f"{name}-0.1.0.dist-info/METADATA", f"Metadata-Version: 2.1\nName: {name}\nVersion: 0.1.0\n")
+        f.writestr(f"{name}/__init__.py", content)
+    return str(path)
+
+
+def test_install_once(cls, tmp_path):
+    prefix = str(tmp_path / ".local")
+    wheels = [make_wheel(tmp_path, "endstone_a"), make_wheel(tmp_path, "endstone_b")]
+
+    result = cls(prefix, "tag").sync(wheels)
+    assert result.installed == 2
+    assert result.dists == {wheels[0]: "endstone_a", wheels[1]: "endstone_b"}
+    assert cls.installs == [wheels]
+
+    # a new instance (i.e. a restart) must not install anything again
+    result = cls(prefix, "tag").sync(wheels)
+    assert result.cached == 2
+    assert result.installed == 0
+    assert len(cls.installs) == 1
+
+
+def test_reinstall_changed(cls, tmp_path):
+    prefix = str(tmp_path / ".local")
+    wheels = [make_wheel(tmp_path, "endstone_a"), make_wheel(tmp_path, "endstone_b")]
+    cls(prefix, "tag").sync(wheels)
+
+    make_wheel(tmp_path, "endstone_b", content="2")
+    result = cls(prefix, "tag").sync(wheels)
+    assert result.cached == 1
+    assert result.installed == 1
+    assert cls.installs[-1] == [wheels[1]]
+
+
+def test_reinstall_on_tag_change(cls, tmp_path):
+    prefix = str(tmp_path / ".local")
+    wheels = [make_wheel(tmp_path, "endstone_a")]
+    cls(prefix, "tag").sync(wheels)
+
+    result = cls(prefix, "other").sync(wheels)
+    assert result.installed == 1
+
+
+def test_isolate_broken_wheel(cls, tmp_path):
+    prefix = str(tmp_path / ".local")
+    wheels = [make_wheel(tmp_path, "endstone_a"), make_wheel(tmp_path, "endstone_broken")]
+
+    result = cls(prefix, "tag").sync(wheels)
+    assert result.installed == 1
+    assert result.failed == [wheels[1]]
+
+    # failed wheels are retried on the next sync
+    result = cls(prefix, "tag").sync(wheels)
+    assert result.cached == 1
+    assert result.failed == [wheels[1]]
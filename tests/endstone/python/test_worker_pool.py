@@ -0,0 +1,22 @@
+import importlib
+import os
+import sys
+
+import pytest
+
+
+def get_preload():
+    return os.environ.get("LD_PRELOAD")
+
+
+@pytest.mark.skipif(sys.version_info >= (3, 14), reason="workers are sub-interpreters of the same process")
+def test_workers_are_not_preloaded(monkeypatch, tmp_path):
+    module = importlib.import_module("endstone._internal.worker_pool")
+    preload = str(tmp_path / "libendstone_runtime.so")
+    monkeypatch.setenv("LD_PRELOAD", preload)
+
+    with module.create_worker_pool(max_workers=1) as pool:
+        assert pool.submit(get_preload).result(timeout=60) is None
+
+    # the server keeps its own environment
+    assert os.environ["LD_PRELOAD"] == preload